@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+struct MatchingConfig {
+    std::chrono::milliseconds window{0};   // 0 = match each booking as it is created
+    size_t candidatesPerBooking = 8;       // Nearest drivers considered per booking
+    double maxPickupKm = 5.0;
+    double averageSpeedKmh = 25.0;         // Converts pickup distance to ETA
+};
+
+// One feasible booking/driver pairing and its cost (e.g. pickup ETA)
+struct MatchEdge {
+    std::uint32_t booking;
+    std::uint32_t driver;
+    double cost;
+};
+
+// Minimum-cost bipartite assignment over a sparse booking x driver cost matrix.
+// Only the listed edges are feasible. Every booking also has a private "unmatched"
+// option at unmatchedCost, so the solver minimises total cost plus unmatchedCost per
+// booking left over. Each booking is added with one shortest augmenting path
+// (Dijkstra on reduced costs), which only visits the candidate edges of bookings
+// that path touches.
+class BatchMatcher {
+private:
+    // Edges grouped by booking (CSR)
+    std::vector<std::uint32_t> rowStart;
+    std::vector<std::uint32_t> edgeDriver;
+    std::vector<double> edgeCost;
+
+    std::vector<double> bookingPotential;
+    std::vector<double> driverPotential;
+    std::vector<int> driverOwner;      // Booking holding each column, -1 if free; columns past
+                                       // the real drivers are the per-booking unmatched options
+    std::vector<int> assignment;       // Column assigned to each booking during the solve
+    std::vector<int> result;           // Driver per booking, -1 if unmatched
+
+    // Per-augmentation scratch
+    std::vector<double> distance;
+    std::vector<int> previousBooking;
+    std::vector<std::uint32_t> visitedDrivers;
+    std::vector<std::uint32_t> settledDrivers;
+    std::vector<char> finalized;
+
+    void augment(std::uint32_t booking);
+
+public:
+    // Returns the driver index for every booking, -1 if left unmatched. A negative
+    // unmatchedCost means "match as many bookings as possible", then minimise cost.
+    const std::vector<int>& solve(size_t bookingCount, size_t driverCount, const std::vector<MatchEdge>& edges,
+                                  double unmatchedCost = -1.0);
+
+    const std::vector<int>& getAssignment() const { return result; }
+    size_t getMatchedCount() const;
+    double getTotalCost() const;
+};
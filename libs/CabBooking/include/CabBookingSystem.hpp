@@ -9,10 +9,22 @@
 #include "Payment.hpp"
 #include "FareCalculator.hpp"
 #include "NotificationService.hpp"
+#include "SpatialIndex.hpp"
+#include "LocationIngestor.hpp"
+#include "BatchMatcher.hpp"
+#include "HistoryIndex.hpp"
 #include <vector>
 #include <memory>
 #include <unordered_map>
 
+// Running totals over successful payments
+struct RevenueSummary {
+    double grossAmount = 0.0;
+    double platformFees = 0.0;
+    double driverPayouts = 0.0;
+    int paymentCount = 0;
+};
+
 class CabBookingSystem {
 private:
     // Data storage
@@ -24,9 +36,34 @@ private:
     std::unordered_map<std::string, std::shared_ptr<Payment>> payments;
     std::unordered_map<std::string, std::shared_ptr<Location>> locations;
     
+    // Per-customer and per-driver history, appended as entities are created
+    HistoryIndex customerBookings;
+    HistoryIndex driverBookings;
+    HistoryIndex customerTrips;
+    HistoryIndex driverTrips;
+    HistoryIndex customerPayments;
+    HistoryIndex driverPayments;
+    
+    // Revenue aggregates, kept current by processPayment and refundPayment
+    RevenueSummary revenue;
+    std::unordered_map<std::string, RevenueSummary> driverRevenue;
+    std::unordered_map<std::string, RevenueSummary> customerRevenue;
+    
+    // Live positions of drivers with a vehicle, and of all vehicles
+    SpatialIndex driverIndex;
+    SpatialIndex vehicleIndex;
+    
     // Services
     std::shared_ptr<FareCalculator> fareCalculator;
     std::shared_ptr<NotificationService> notificationService;
+    std::shared_ptr<LocationIngestor> locationIngestor;
+    std::shared_ptr<SurgeEngine> surgeEngine;
+    
+    // Matching window: bookings wait here until runMatchingRound assigns them together
+    MatchingConfig matchingConfig;
+    BatchMatcher batchMatcher;
+    std::vector<std::string> pendingMatches;
+    std::chrono::steady_clock::time_point windowOpened;
     
     // System state
     int nextCustomerId;
@@ -36,6 +73,10 @@ private:
     int nextBookingId;
     int nextPaymentId;
     int nextLocationId;
+    
+    void recordRevenue(const Payment& payment, double sign);
+    // Back to AVAILABLE and into the driver index, e.g. when its booking is reassigned
+    void releaseDriver(const std::string& driverId);
 
 public:
     CabBookingSystem();
@@ -76,24 +117,52 @@ public:
     std::shared_ptr<Booking> createBooking(const std::string& customerId, const std::string& pickupLocationId,
                                           const std::string& dropLocationId, const std::string& vehicleType);
     std::shared_ptr<Driver> findNearestDriver(const std::string& pickupLocationId, const std::string& vehicleType);
+    std::vector<std::shared_ptr<Driver>> findNearestDrivers(double latitude, double longitude,
+                                                            const std::string& vehicleType, int count) const;
     bool assignDriverToBooking(const std::string& bookingId, const std::string& driverId);
+    
+    // Batch matching. With a non-zero window, createBooking queues the booking and
+    // runMatchingRound assigns every queued booking at once by minimum total pickup
+    // ETA. Call it periodically; it does nothing until the window has elapsed unless
+    // forced. Returns the number of bookings matched.
+    void setMatchingConfig(const MatchingConfig& config);
+    const MatchingConfig& getMatchingConfig() const;
+    size_t runMatchingRound(bool force = false);
+    size_t getPendingMatchCount() const;
     bool cancelBooking(const std::string& bookingId, const std::string& reason);
     std::vector<std::shared_ptr<Booking>> getCustomerBookings(const std::string& customerId) const;
     std::vector<std::shared_ptr<Booking>> getDriverBookings(const std::string& driverId) const;
     
+    // History lists are oldest first; the paged overloads return the newest first,
+    // skipping the `offset` most recent entries
+    std::vector<std::shared_ptr<Booking>> getCustomerBookings(const std::string& customerId, size_t offset,
+                                                              size_t limit) const;
+    std::vector<std::shared_ptr<Booking>> getDriverBookings(const std::string& driverId, size_t offset,
+                                                            size_t limit) const;
+    
     // Trip management
     std::shared_ptr<Trip> startTrip(const std::string& bookingId);
-    bool updateTripLocation(const std::string& tripId, double latitude, double longitude);
+    // Moves the driver and appends the point to the trip's GPS trace; a negative
+    // timestamp means now. False if the trip is unknown or the point is older
+    // than the last one recorded, in which case nothing moves.
+    bool updateTripLocation(const std::string& tripId, double latitude, double longitude,
+                            std::int64_t timestampMs = -1);
     std::shared_ptr<Trip> completeTrip(const std::string& tripId, double actualFare);
     bool cancelTrip(const std::string& tripId);
     std::vector<std::shared_ptr<Trip>> getCustomerTrips(const std::string& customerId) const;
     std::vector<std::shared_ptr<Trip>> getDriverTrips(const std::string& driverId) const;
+    std::vector<std::shared_ptr<Trip>> getCustomerTrips(const std::string& customerId, size_t offset, size_t limit) const;
+    std::vector<std::shared_ptr<Trip>> getDriverTrips(const std::string& driverId, size_t offset, size_t limit) const;
     
     // Payment management
     std::shared_ptr<Payment> processPayment(const std::string& tripId, PaymentMethod method);
     bool refundPayment(const std::string& paymentId);
     std::vector<std::shared_ptr<Payment>> getCustomerPayments(const std::string& customerId) const;
     std::vector<std::shared_ptr<Payment>> getDriverPayments(const std::string& driverId) const;
+    std::vector<std::shared_ptr<Payment>> getCustomerPayments(const std::string& customerId, size_t offset,
+                                                              size_t limit) const;
+    std::vector<std::shared_ptr<Payment>> getDriverPayments(const std::string& driverId, size_t offset,
+                                                            size_t limit) const;
     
     // Rating and feedback
     bool rateTrip(const std::string& tripId, double customerRating, const std::string& customerFeedback,
@@ -102,13 +171,26 @@ public:
     // System utilities
     void updateDriverLocation(const std::string& driverId, double latitude, double longitude);
     void updateVehicleLocation(const std::string& vehicleId, double latitude, double longitude);
+    
+    // Buffered GPS ingestion: pings may be submitted from any thread and are applied,
+    // latest position per driver, by applyLocationUpdates on the system's thread
+    std::uint32_t getDriverLocationSource(const std::string& driverId) const;
+    bool submitDriverLocation(std::uint32_t source, double latitude, double longitude, std::int64_t timestampMs);
+    size_t applyLocationUpdates();
     double calculateEstimatedFare(const std::string& pickupLocationId, const std::string& dropLocationId,
                                  const std::string& vehicleType);
+    
+    // Feeds the positions of drivers able to take a ride to the surge engine as supply
+    size_t publishSurgeSupply();
     std::vector<std::shared_ptr<Vehicle>> getNearbyVehicles(const std::string& locationId, double radiusKm) const;
+    const SpatialIndex& getDriverIndex() const;
+    const SpatialIndex& getVehicleIndex() const;
     
     // Getters for services
     std::shared_ptr<FareCalculator> getFareCalculator() const;
     std::shared_ptr<NotificationService> getNotificationService() const;
+    std::shared_ptr<LocationIngestor> getLocationIngestor() const;
+    std::shared_ptr<SurgeEngine> getSurgeEngine() const;
     
     // System statistics
     int getTotalCustomers() const;
@@ -118,4 +200,7 @@ public:
     int getTotalBookings() const;
     int getTotalPayments() const;
     double getTotalRevenue() const;
+    RevenueSummary getRevenueSummary() const;
+    RevenueSummary getDriverRevenue(const std::string& driverId) const;
+    RevenueSummary getCustomerRevenue(const std::string& customerId) const;
 }; 
\ No newline at end of file
@@ -2,8 +2,28 @@
 
 #include "Location.hpp"
 #include "Vehicle.hpp"
+#include "SurgeEngine.hpp"
 #include <memory>
 #include <map>
+#include <vector>
+
+struct TripRequest {
+    double pickupLatitude;
+    double pickupLongitude;
+    double dropLatitude;
+    double dropLongitude;
+    VehicleType vehicleType;
+    int waitingMinutes = 0;
+};
+
+struct FareQuote {
+    double distanceKm = 0.0;
+    double baseFare = 0.0;
+    double dynamicPricing = 0.0;
+    double additionalCharges = 0.0;
+    double surgeMultiplier = 1.0;
+    double totalFare = 0.0;
+};
 
 class FareCalculator {
 private:
@@ -28,6 +48,9 @@ private:
     int peakHourEnd;
     int nightHourStart;
     int nightHourEnd;
+    
+    // Zone surge; when set it replaces the global demand multiplier
+    std::shared_ptr<SurgeEngine> surgeEngine;
 
 public:
     FareCalculator();
@@ -41,6 +64,12 @@ public:
     double calculateDynamicPricing(double baseFare, int currentHour, double demandLevel);
     double calculateAdditionalCharges(double baseFare, int waitingMinutes = 0);
     
+    // Batch pricing: rates, time-of-day multiplier and the surge snapshot are resolved
+    // once per call, then each request costs a distance and a zone lookup
+    void quoteFares(const TripRequest* requests, size_t count, FareQuote* quotes, int currentHour = -1) const;
+    std::vector<FareQuote> quoteFares(const std::vector<TripRequest>& requests, int currentHour = -1) const;
+    FareQuote quoteFare(const TripRequest& request, int currentHour = -1) const;
+    
     // Configuration methods
     void setBaseRate(const std::string& vehicleType, double rate);
     void setPerKmRate(const std::string& vehicleType, double rate);
@@ -54,6 +83,8 @@ public:
     void setPlatformFee(double fee);
     void setPeakHours(int start, int end);
     void setNightHours(int start, int end);
+    void setSurgeEngine(std::shared_ptr<SurgeEngine> engine);
+    std::shared_ptr<SurgeEngine> getSurgeEngine() const;
     
     // Getters
     double getBaseRate(const std::string& vehicleType) const;
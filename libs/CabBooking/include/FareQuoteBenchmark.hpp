@@ -0,0 +1,49 @@
+#pragma once
+
+#include "FareCalculator.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct FareQuoteBenchmarkConfig {
+    size_t quoteCount = 100000;          // Trips per batch
+    size_t iterations = 20;
+    double centerLatitude = 12.9716;
+    double centerLongitude = 77.5946;
+    double cityRadiusKm = 20.0;
+    size_t surgeBookings = 20000;        // Demand recorded before the snapshot is computed
+    size_t surgeDrivers = 2000;          // Supply spread over the same area
+    int hour = 18;                       // Fixed so every path prices the same time of day
+    unsigned seed = 11;
+};
+
+struct FareQuoteBenchmarkReport {
+    size_t quoteCount = 0;
+    size_t surgedZones = 0;              // Zones in the snapshot with a multiplier above 1.0
+    double batchNsPerQuote = 0.0;        // quoteFares over the whole batch
+    double singleNsPerQuote = 0.0;       // quoteFare one trip at a time
+    double calculateFareNsPerCall = 0.0; // calculateFare with prebuilt Location and Vehicle objects
+    std::uint64_t mismatches = 0;        // Batch total differs from quoteFare or calculateFare
+    double maxFareDifference = 0.0;
+    bool consistent = true;
+    double wallSeconds = 0.0;
+};
+
+// Reproduces the README's batch quoting figures. Random trips over a city are
+// priced with FareCalculator::quoteFares, quoteFare and calculateFare under the
+// same surge snapshot and hour, and every batch quote is checked against the
+// other two.
+class FareQuoteBenchmark {
+private:
+    FareQuoteBenchmarkConfig config;
+
+public:
+    // Fares may differ by rounding only
+    static const double FARE_TOLERANCE;
+
+    explicit FareQuoteBenchmark(const FareQuoteBenchmarkConfig& config);
+
+    FareQuoteBenchmarkReport run();
+
+    static void printReport(const std::string& label, const FareQuoteBenchmarkReport& report);
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Structure-of-arrays point buffer. Each point also caches its unit vector on the
+// sphere, so distances to it need no trigonometry: the chord length comes from a
+// dot-product-style sum and maps monotonically to great-circle distance.
+class GeoBatch {
+private:
+    std::vector<double> latitudes;
+    std::vector<double> longitudes;
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> z;
+
+public:
+    void reserve(size_t count);
+    void push_back(double lat, double lon);
+    void set(size_t index, double lat, double lon);
+    void swapRemove(size_t index); // Moves the last point into index
+    void clear();
+    size_t size() const { return latitudes.size(); }
+    bool empty() const { return latitudes.empty(); }
+
+    double getLatitude(size_t index) const { return latitudes[index]; }
+    double getLongitude(size_t index) const { return longitudes[index]; }
+    const double* xData() const { return x.data(); }
+    const double* yData() const { return y.data(); }
+    const double* zData() const { return z.data(); }
+    const double* latitudeData() const { return latitudes.data(); }
+    const double* longitudeData() const { return longitudes.data(); }
+};
+
+enum class GeoKernel {
+    AUTO,   // Best kernel this CPU supports
+    SCALAR,
+    SSE2,
+    AVX2
+};
+
+// Batch great-circle distance kernels. x86 builds pick AVX2 or SSE2 at runtime;
+// other targets use the scalar loop. Results match Location::haversineDistance
+// to well under a millimetre, except close to the antipode where both lose precision.
+class GeoDistance {
+public:
+    static const double EARTH_RADIUS_KM;
+
+    // out[i] = distance in km from (lat, lon) to points[i]
+    static void distancesKm(double lat, double lon, const GeoBatch& points, double* out);
+    static std::vector<double> distancesKm(double lat, double lon, const GeoBatch& points);
+
+    // Exact radius test on cached unit vectors; appends matching indexes
+    static size_t withinRadius(double lat, double lon, double radiusKm, const GeoBatch& points,
+                               std::vector<std::uint32_t>& indexes);
+
+    // Radius test over plain lat/lon arrays: a vectorized equirectangular bound
+    // rejects most points, survivors are confirmed with the Haversine formula
+    static size_t withinRadius(double lat, double lon, double radiusKm, const double* latitudes,
+                               const double* longitudes, size_t count, std::vector<std::uint32_t>& indexes);
+
+    // The same operations pinned to one kernel, for accuracy checks and benchmarks.
+    // A kernel this CPU or build cannot run falls back to the scalar loop.
+    static void distancesKm(GeoKernel kernel, double lat, double lon, const GeoBatch& points, double* out);
+    static size_t withinRadius(GeoKernel kernel, double lat, double lon, double radiusKm, const GeoBatch& points,
+                               std::vector<std::uint32_t>& indexes);
+    static size_t withinRadius(GeoKernel kernel, double lat, double lon, double radiusKm, const double* latitudes,
+                               const double* longitudes, size_t count, std::vector<std::uint32_t>& indexes);
+
+    static double equirectangularKm(double lat1, double lon1, double lat2, double lon2);
+
+    static bool isKernelAvailable(GeoKernel kernel);
+    static const char* getKernelName();
+    static const char* getKernelName(GeoKernel kernel);
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "GeoDistance.hpp"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+struct GeoKernelBenchmarkConfig {
+    size_t accuracyQueries = 200;         // Random query points for the accuracy check
+    size_t accuracyPoints = 1001;         // Points per query: half nearby, half anywhere on the globe
+    size_t benchmarkPoints = 100000;      // Spread over a city, as SpatialIndex cells hold them
+    size_t benchmarkIterations = 200;
+    double centerLatitude = 12.9716;
+    double centerLongitude = 77.5946;
+    double cityRadiusKm = 20.0;
+    double radiusKm = 2.0;                // Radius for the withinRadius timings
+    unsigned seed = 5;
+};
+
+struct GeoKernelResult {
+    std::string kernel;
+    double maxErrorKm = 0.0;              // Against Location::haversineDistance
+    double maxAntipodalErrorKm = 0.0;     // The same, within ANTIPODAL_BAND_KM of the antipode
+    double maxScalarDifferenceKm = 0.0;   // Against the scalar kernel on the same input
+    std::uint64_t distanceFailures = 0;   // Outside tolerance of either, edge cases included
+    std::uint64_t radiusMismatches = 0;   // withinRadius results that disagree with brute force
+    double distanceNsPerPoint = 0.0;      // distancesKm on a GeoBatch
+    double radiusNsPerPoint = 0.0;        // withinRadius on a GeoBatch
+    double prefilterNsPerPoint = 0.0;     // withinRadius on lat/lon arrays
+};
+
+struct GeoKernelReport {
+    std::vector<GeoKernelResult> kernels; // Every kernel this CPU can run, scalar first
+    std::string defaultKernel;
+    double haversineNsPerPoint = 0.0;     // Scalar Location::haversineDistance loop
+    std::uint64_t distancesChecked = 0;
+    bool accurate = true;
+    double wallSeconds = 0.0;
+};
+
+// Accuracy check and microbenchmark for the GeoDistance kernels. Each kernel is run
+// pinned on the same inputs and compared with the scalar kernel and with the
+// Haversine reference, including edge cases and every batch length up to a few
+// vector widths so the SIMD tail handling is covered. The timings are the ones
+// quoted in the README.
+class GeoKernelBenchmark {
+private:
+    GeoKernelBenchmarkConfig config;
+
+    void checkRandom(GeoKernel kernel, GeoKernelResult& result, GeoKernelReport& report) const;
+    void checkEdgeCases(GeoKernel kernel, GeoKernelResult& result, GeoKernelReport& report) const;
+    void benchmark(GeoKernel kernel, GeoKernelResult& result) const;
+    double benchmarkHaversine() const;
+
+public:
+    // Distance tolerances; near-antipodal pairs are ill-conditioned for both formulas
+    static const double ANTIPODAL_BAND_KM;
+    static const double DISTANCE_TOLERANCE_KM;
+    static const double ANTIPODAL_TOLERANCE_KM;
+    static const double KERNEL_TOLERANCE_KM;
+
+    explicit GeoKernelBenchmark(const GeoKernelBenchmarkConfig& config);
+
+    GeoKernelReport run();
+
+    static void printReport(const std::string& label, const GeoKernelReport& report);
+};
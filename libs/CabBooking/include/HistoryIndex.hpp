@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+// Per-owner ID lists (customer -> bookings, driver -> trips, ...). IDs are appended
+// when the entity is created or assigned, so each list is in time order and a
+// history query costs O(result) instead of a scan of every entity. An ID moved to
+// another owner is removed from the old owner's list, so pages stay exact.
+class HistoryIndex {
+private:
+    std::unordered_map<std::string, std::vector<std::string>> entries;
+    size_t totalEntries = 0;
+
+public:
+    void append(const std::string& owner, const std::string& id);
+    // Searches from the newest entry, since reassignments usually concern recent IDs
+    bool remove(const std::string& owner, const std::string& id);
+    void clear();
+
+    // Oldest first; nullptr if the owner has no entries
+    const std::vector<std::string>* find(const std::string& owner) const;
+    size_t count(const std::string& owner) const;
+    size_t size() const { return totalEntries; }
+
+    // Newest first: skips the `offset` most recent entries and returns up to `limit`
+    std::vector<std::string> page(const std::string& owner, size_t offset, size_t limit) const;
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "LocationIngestor.hpp"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+struct IngestorStressConfig {
+    size_t writerThreads = 4;
+    size_t sources = 64;              // Few sources, so writers keep colliding on the same slot
+    size_t pingsPerWriter = 200000;
+    double reorderedShare = 0.1;      // Pings sent with an older timestamp, as after network reordering
+    unsigned seed = 1;
+};
+
+struct IngestorStressReport {
+    std::uint64_t pingsSent = 0;
+    std::uint64_t pingsStale = 0;
+    std::uint64_t updatesApplied = 0;
+    std::uint64_t mismatchedPairs = 0;   // Applied position does not belong to the applied timestamp
+    std::uint64_t timestampRegressions = 0; // A source was applied with an older timestamp than before
+    std::uint64_t finalMismatches = 0;   // Source did not end on its newest ping
+    bool consistent = true;
+    double pingsPerSecond = 0.0;
+    double wallSeconds = 0.0;
+};
+
+// Multi-writer stress check of LocationIngestor. Writer threads submit pings for a
+// small set of sources while one consumer drains continuously. Every ping's
+// position is a function of its source and timestamp, so the consumer can check
+// that each applied update pairs a timestamp with that same ping's position, that
+// timestamps never go backwards, and that every source ends on its newest ping.
+class IngestorStressTest {
+private:
+    IngestorStressConfig config;
+
+public:
+    explicit IngestorStressTest(const IngestorStressConfig& config);
+
+    IngestorStressReport run();
+
+    // Position of the ping a source sends at a timestamp
+    static void positionFor(std::uint32_t source, std::int64_t timestampMs, double& lat, double& lon);
+
+    static void printReport(const std::string& label, const IngestorStressReport& report);
+};
@@ -39,6 +39,8 @@ public:
     
     // Utility methods
     double calculateDistance(const Location& other) const;
+    double calculateDistance(double lat, double lon) const;
+    static double haversineDistance(double lat1, double lon1, double lat2, double lon2);
     std::string getFullAddress() const;
     bool isValid() const;
 }; 
\ No newline at end of file
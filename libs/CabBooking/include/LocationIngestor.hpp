@@ -0,0 +1,87 @@
+#pragma once
+
+#include "MpscRing.hpp"
+#include <string>
+#include <vector>
+#include <deque>
+#include <atomic>
+#include <memory>
+#include <functional>
+#include <unordered_map>
+#include <cstdint>
+
+// Lock-free ingestion of GPS pings. Producers on any thread overwrite a per-source
+// latest-position slot; the first ping since the last drain also enqueues the
+// source on its shard's MPSC ring, so a burst of pings costs one queue entry.
+// A single consumer drains the rings and applies the coalesced positions.
+//
+// Each slot's position and timestamp are published together under a per-slot
+// seqlock: writers to the same source take turns (an odd sequence marks a write in
+// progress) and the consumer retries a read that overlapped a write, so it never
+// pairs one ping's timestamp with another ping's position.
+class LocationIngestor {
+public:
+    using ApplyFunction = std::function<void(const std::string& sourceId, double lat, double lon,
+                                             std::int64_t timestampMs)>;
+
+    static const std::uint32_t INVALID_SOURCE = 0xFFFFFFFFu;
+
+private:
+    static const size_t CHUNK_SIZE = 4096;
+    static const size_t MAX_CHUNKS = 1024;
+
+    struct SourceSlot {
+        std::atomic<std::uint32_t> sequence;   // Seqlock; odd while a writer holds the slot
+        std::atomic<std::uint64_t> position;   // Fixed-point lat/lon packed into one word
+        std::atomic<std::int64_t> timestampMs;
+        std::atomic<bool> dirty;
+    };
+
+    // Bounded multi-producer ring of dirty source indexes
+    struct Shard {
+        MpscRing<std::uint32_t> ring;
+        std::atomic<bool> overflowed;
+
+        explicit Shard(size_t capacity) : ring(capacity), overflowed(false) {}
+    };
+
+    std::unique_ptr<std::atomic<SourceSlot*>[]> chunks;
+    std::vector<std::unique_ptr<SourceSlot[]>> ownedChunks;
+    std::deque<std::string> sourceIds;
+    std::unordered_map<std::string, std::uint32_t> sourceIndex;
+    std::atomic<std::uint32_t> sourceCount;
+    std::vector<std::unique_ptr<Shard>> shards;
+
+    std::atomic<std::uint64_t> received;
+    std::atomic<std::uint64_t> coalesced;
+    std::atomic<std::uint64_t> stale;
+    std::uint64_t published;
+
+    SourceSlot* slotFor(std::uint32_t source) const;
+    static bool writeSlot(SourceSlot& slot, std::uint64_t position, std::int64_t timestampMs);
+    static void readSlot(const SourceSlot& slot, std::uint64_t& position, std::int64_t& timestampMs);
+    void applySlot(std::uint32_t source, const ApplyFunction& apply);
+
+public:
+    explicit LocationIngestor(size_t shardCount = 16, size_t shardCapacity = 1 << 14);
+
+    // Registration and lookup run on the owning thread, not concurrently with each other
+    std::uint32_t registerSource(const std::string& sourceId);
+    std::uint32_t findSource(const std::string& sourceId) const;
+    const std::string& getSourceId(std::uint32_t source) const;
+    size_t getSourceCount() const;
+
+    // Lock-free; safe from any number of threads. Pings older than the stored one are dropped.
+    bool submit(std::uint32_t source, double lat, double lon, std::int64_t timestampMs);
+
+    // Single consumer: applies each source updated since the last drain once, with its latest position
+    size_t drain(const ApplyFunction& apply);
+
+    std::uint64_t getReceivedCount() const;
+    std::uint64_t getCoalescedCount() const;
+    std::uint64_t getStaleCount() const;
+    std::uint64_t getPublishedCount() const;
+
+    static std::uint64_t packPosition(double lat, double lon);
+    static void unpackPosition(std::uint64_t packed, double& lat, double& lon);
+};
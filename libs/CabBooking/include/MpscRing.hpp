@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// Bounded multi-producer, single-consumer ring (Vyukov). Each cell carries a
+// sequence number: a producer claims a cell by advancing head, writes the item and
+// publishes it by bumping the sequence; the consumer pops in order and hands the
+// cell back for the next lap. push never blocks and fails when the ring is full.
+// Capacity is rounded up to a power of two.
+template <typename T>
+class MpscRing {
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T item;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;
+    std::atomic<size_t> head; // Next cell producers claim
+    size_t tail;              // Consumer only
+
+public:
+    static size_t roundUpToPowerOfTwo(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    explicit MpscRing(size_t capacity)
+        : cells(new Cell[roundUpToPowerOfTwo(capacity)]), mask(roundUpToPowerOfTwo(capacity) - 1), head(0), tail(0) {
+        for (size_t i = 0; i <= mask; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    // Any thread. Leaves item untouched and returns false if the ring is full.
+    bool push(T&& item) {
+        size_t pos = head.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells[pos & mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+
+            if (difference == 0) {
+                if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.item = std::move(item);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false; // Full
+            } else {
+                pos = head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool push(const T& item) {
+        T copy(item);
+        return push(std::move(copy));
+    }
+
+    // Consumer thread only
+    bool pop(T& item) {
+        Cell& cell = cells[tail & mask];
+        if (cell.sequence.load(std::memory_order_acquire) != tail + 1) {
+            return false;
+        }
+
+        item = std::move(cell.item);
+        cell.sequence.store(tail + mask + 1, std::memory_order_release);
+        tail++;
+        return true;
+    }
+
+    size_t capacity() const { return mask + 1; }
+};
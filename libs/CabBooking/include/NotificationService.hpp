@@ -1,8 +1,16 @@
 #pragma once
 
+#include "MpscRing.hpp"
 #include <string>
 #include <vector>
+#include <deque>
 #include <memory>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <cstdint>
 
 enum class NotificationType {
     SMS,
@@ -18,6 +26,12 @@ enum class NotificationPriority {
     URGENT
 };
 
+enum class NotificationStatus {
+    PENDING,
+    SENT,
+    FAILED
+};
+
 class Notification {
 private:
     std::string notificationId;
@@ -26,7 +40,7 @@ private:
     std::string message;
     NotificationType type;
     NotificationPriority priority;
-    std::string status; // "PENDING", "SENT", "FAILED"
+    std::atomic<NotificationStatus> status; // Set by dispatcher threads, read by anyone
     std::chrono::system_clock::time_point timestamp;
     std::string metadata; // JSON string for additional data
 
@@ -42,35 +56,130 @@ public:
     std::string getMessage() const;
     NotificationType getType() const;
     NotificationPriority getPriority() const;
-    std::string getStatus() const;
+    NotificationStatus getStatus() const;
     std::chrono::system_clock::time_point getTimestamp() const;
     std::string getMetadata() const;
     
     // Setters
-    void setStatus(const std::string& status);
+    void setStatus(NotificationStatus status);
     void setMetadata(const std::string& metadata);
     
     // Utility methods
     std::string getTypeString() const;
     std::string getPriorityString() const;
+    std::string getStatusString() const;
     bool isSent() const;
     bool isFailed() const;
 };
 
+class NotificationTransport;
+
+struct DispatchConfig {
+    size_t laneCapacity = 4096;            // Per priority; a full lane rejects new notifications
+    size_t dispatcherThreads = 2;
+    size_t maxBatchSize = 64;              // Per channel
+    std::chrono::microseconds maxBatchDelay{2000}; // Oldest message in a batch waits at most this long
+    size_t maxQueuedBatches = 64;          // Backpressure from dispatchers to the collector
+};
+
+struct NotificationStats {
+    std::uint64_t accepted = 0;
+    std::uint64_t rejected = 0;            // Lane full
+    std::uint64_t sent = 0;
+    std::uint64_t failed = 0;
+    std::uint64_t batches = 0;
+    double p50LatencyMs = 0.0;             // Enqueue to delivery, over recent notifications
+    double p99LatencyMs = 0.0;
+    double maxLatencyMs = 0.0;
+};
+
+// Sends notifications through a pluggable NotificationTransport. By default each
+// notification is delivered synchronously on the caller's thread. After
+// startDispatch, sendNotification only pushes onto a bounded lock-free lane per
+// priority. A collector thread drains the lanes, most urgent first, into
+// per-channel batches, and a dispatcher pool hands full or timed-out batches to
+// the transport. A batch holding an URGENT notification ships at the end of the
+// collector's current pass instead of waiting for its delay.
 class NotificationService {
 private:
-    std::vector<std::shared_ptr<Notification>> notificationQueue;
-    bool smsEnabled;
-    bool emailEnabled;
-    bool pushEnabled;
+    struct Pending {
+        std::shared_ptr<Notification> notification;
+        std::chrono::steady_clock::time_point enqueuedAt;
+    };
+
+    using Lane = MpscRing<Pending>;
+
+    struct Batch {
+        NotificationType channel;
+        NotificationPriority priority;     // Highest in the batch
+        std::vector<Pending> items;
+
+        bool operator<(const Batch& other) const { return priority < other.priority; }
+    };
+
+    static const size_t CHANNEL_COUNT = 4;
+    static const size_t PRIORITY_COUNT = 4;
+    static const size_t LATENCY_SAMPLES = 8192;
+
+    std::shared_ptr<NotificationTransport> transport; // Accessed with atomic_load/atomic_store
+    std::atomic<bool> smsEnabled;
+    std::atomic<bool> emailEnabled;
+    std::atomic<bool> pushEnabled;
     std::string smsProvider;
     std::string emailProvider;
+    
+    // Recently delivered notifications, oldest first
+    std::deque<std::shared_ptr<Notification>> history;
+    size_t historyLimit;
+    mutable std::mutex historyMutex;
+    
+    // Asynchronous dispatch
+    DispatchConfig dispatchConfig;
+    std::vector<std::unique_ptr<Lane>> lanes;
+    std::atomic<bool> dispatching;
+    std::atomic<size_t> activeSenders;     // Senders that may still touch the lanes
+    std::mutex controlMutex;               // Serializes startDispatch and stopDispatch
+    std::atomic<bool> stopping;
+    std::thread collector;
+    std::vector<std::thread> dispatchers;
+    std::mutex wakeMutex;
+    std::condition_variable collectorWake;
+    std::atomic<bool> collectorIdle;
+    
+    std::vector<Batch> readyBatches;       // Heap ordered by priority
+    std::mutex batchMutex;
+    std::condition_variable batchReady;
+    std::condition_variable batchTaken;
+    std::condition_variable drained;
+    bool collectorFinished;
+    
+    std::atomic<std::uint64_t> accepted;
+    std::atomic<std::uint64_t> rejected;
+    std::atomic<std::uint64_t> completed;  // Sent or failed
+    std::atomic<std::uint64_t> sent;
+    std::atomic<std::uint64_t> failed;
+    std::atomic<std::uint64_t> batchCount;
+    std::vector<double> recentLatencyMs;   // Ring of recent samples
+    size_t nextLatencySlot;
+    mutable std::mutex latencyMutex;
+    
+    bool isChannelEnabled(NotificationType type) const;
+    void deliverBatch(NotificationType channel, std::vector<Pending>& items);
+    void recordDelivered(const std::vector<std::shared_ptr<Notification>>& notifications);
+    void collectLoop();
+    void dispatchLoop();
+    void queueBatch(Batch&& batch);
 
 public:
     NotificationService();
+    ~NotificationService();
     
-    // Core notification methods
-    void sendNotification(std::shared_ptr<Notification> notification);
+    NotificationService(const NotificationService&) = delete;
+    NotificationService& operator=(const NotificationService&) = delete;
+    
+    // Core notification methods. Returns false if the notification was rejected
+    // because its priority lane is full.
+    bool sendNotification(std::shared_ptr<Notification> notification);
     void sendSMS(const std::string& phoneNumber, const std::string& message);
     void sendEmail(const std::string& email, const std::string& subject, const std::string& body);
     void sendPushNotification(const std::string& userId, const std::string& title, const std::string& message);
@@ -99,10 +208,22 @@ public:
     void setPushEnabled(bool enabled);
     void setSMSProvider(const std::string& provider);
     void setEmailProvider(const std::string& provider);
+    void setTransport(std::shared_ptr<NotificationTransport> transport);
+    std::shared_ptr<NotificationTransport> getTransport() const;
+    
+    // Asynchronous dispatch. stopDispatch waits for senders still pushing onto the
+    // lanes, then delivers everything accepted before returning; flush waits for
+    // that without stopping.
+    void startDispatch(const DispatchConfig& config = DispatchConfig());
+    void stopDispatch();
+    void flush();
+    bool isDispatching() const;
+    NotificationStats getStats() const;
     
     // Utility methods
-    std::vector<std::shared_ptr<Notification>> getNotificationQueue() const;
+    std::vector<std::shared_ptr<Notification>> getNotificationQueue() const; // Recently delivered
     void clearQueue();
+    void setHistoryLimit(size_t limit);
     bool isSMSEnabled() const;
     bool isEmailEnabled() const;
     bool isPushEnabled() const;
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "NotificationService.hpp"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+// Delivery backend for NotificationService. A batch always holds notifications of
+// one channel, so a transport can submit it in one provider call (bulk SMS, a
+// batched push request, ...). Dispatcher threads may call deliver concurrently.
+class NotificationTransport {
+public:
+    virtual ~NotificationTransport() = default;
+
+    // Returns false if the whole batch failed
+    virtual bool deliver(NotificationType channel, const std::vector<std::shared_ptr<Notification>>& batch) = 0;
+};
+
+// Prints each notification, as the service always has
+class ConsoleTransport : public NotificationTransport {
+public:
+    bool deliver(NotificationType channel, const std::vector<std::shared_ptr<Notification>>& batch) override;
+};
+
+// In-process stand-in for a provider, for benchmarks: each call costs a fixed
+// round trip plus a per-message amount, and nothing is printed
+class LocalTransport : public NotificationTransport {
+private:
+    std::chrono::microseconds perBatchLatency;
+    std::chrono::microseconds perMessageLatency;
+    std::atomic<std::uint64_t> delivered[4];
+    std::atomic<std::uint64_t> calls;
+
+public:
+    explicit LocalTransport(std::chrono::microseconds perBatchLatency = std::chrono::microseconds(0),
+                            std::chrono::microseconds perMessageLatency = std::chrono::microseconds(0));
+
+    bool deliver(NotificationType channel, const std::vector<std::shared_ptr<Notification>>& batch) override;
+
+    std::uint64_t getDeliveredCount(NotificationType channel) const;
+    std::uint64_t getCallCount() const;
+};
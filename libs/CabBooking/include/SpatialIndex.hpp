@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Vehicle.hpp"
+#include "GeoDistance.hpp"
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <functional>
+#include <cstdint>
+
+struct SpatialEntry {
+    std::string id;
+    double latitude;
+    double longitude;
+    VehicleType type;
+};
+
+struct SpatialMatch {
+    std::string id;
+    double distanceKm;
+};
+
+// Uniform lat/lon grid over live positions. Each cell keeps flat arrays of
+// entries, so moving an object is an in-place update (or a swap-remove plus
+// append when it crosses a cell) and queries only visit cells near the query point.
+class SpatialIndex {
+public:
+    using Filter = std::function<bool(const SpatialEntry&)>;
+
+private:
+    struct Slot {
+        std::int64_t cellKey;
+        size_t position;
+    };
+
+    // Entries plus a parallel SoA copy of their positions for the batch distance kernel
+    struct Cell {
+        std::vector<SpatialEntry> entries;
+        GeoBatch points;
+    };
+
+    double cellDegrees;
+    int lonCells;
+    std::unordered_map<std::int64_t, Cell> cells;
+    std::unordered_map<std::string, Slot> slots;
+
+    int latCellOf(double lat) const;
+    int lonCellOf(double lon) const;
+    std::int64_t cellKey(int latCell, int lonCell) const;
+    double ringLowerBoundKm(double lat, int ring) const;
+    void removeFromCell(const Slot& slot);
+    void scanCell(std::int64_t key, double lat, double lon, VehicleType type, bool anyType,
+                  const Filter& filter, double radiusKm, std::vector<SpatialMatch>& out) const;
+    std::vector<SpatialMatch> nearest(double lat, double lon, size_t k, VehicleType type, bool anyType,
+                                      const Filter& filter) const;
+    std::vector<SpatialMatch> withinRadius(double lat, double lon, double radiusKm, VehicleType type,
+                                           bool anyType, const Filter& filter) const;
+
+public:
+    explicit SpatialIndex(double cellDegrees = 0.01); // ~1.1 km cells
+
+    void upsert(const std::string& id, double lat, double lon, VehicleType type);
+    bool remove(const std::string& id);
+    bool contains(const std::string& id) const;
+    size_t size() const;
+    void clear();
+
+    // Closest k entries, nearest first
+    std::vector<SpatialMatch> findNearest(double lat, double lon, size_t k, const Filter& filter = nullptr) const;
+    std::vector<SpatialMatch> findNearest(double lat, double lon, size_t k, VehicleType type,
+                                          const Filter& filter = nullptr) const;
+
+    // Every entry within radiusKm, nearest first
+    std::vector<SpatialMatch> findWithinRadius(double lat, double lon, double radiusKm,
+                                               const Filter& filter = nullptr) const;
+    std::vector<SpatialMatch> findWithinRadius(double lat, double lon, double radiusKm, VehicleType type,
+                                               const Filter& filter = nullptr) const;
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "SpatialIndex.hpp"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+struct SpatialIndexBenchmarkConfig {
+    size_t driverCount = 100000;
+    size_t queries = 1000;
+    size_t scanQueries = 50;          // Brute-force scans are slow; time fewer of them
+    size_t nearestCount = 5;
+    double radiusKm = 2.0;
+    size_t moves = 100000;            // Position updates timed after the queries
+    double moveKm = 0.1;              // Typical distance between two pings
+    double centerLatitude = 12.9716;
+    double centerLongitude = 77.5946;
+    double cityRadiusKm = 20.0;       // A 40 km wide city
+    unsigned seed = 13;
+};
+
+struct SpatialIndexBenchmarkReport {
+    size_t driverCount = 0;
+    double nearestMicros = 0.0;       // findNearest, per query
+    double radiusMicros = 0.0;        // findWithinRadius, per query
+    double scanMicros = 0.0;          // Haversine over every driver plus partial_sort, per query
+    double upsertNs = 0.0;            // upsert of a moving driver, per update
+    double averageRadiusMatches = 0.0;
+    std::uint64_t mismatches = 0;     // Index results that differ from brute force
+    bool consistent = true;
+    double wallSeconds = 0.0;
+};
+
+// Reproduces the README's spatial index figures. Drivers are spread uniformly
+// over a city; nearest and radius queries on the index are timed against a
+// brute-force scan, and the scanned queries are checked to return the same
+// drivers at the same distances.
+class SpatialIndexBenchmark {
+private:
+    SpatialIndexBenchmarkConfig config;
+
+public:
+    static const double DISTANCE_TOLERANCE_KM;
+
+    explicit SpatialIndexBenchmark(const SpatialIndexBenchmarkConfig& config);
+
+    SpatialIndexBenchmarkReport run();
+
+    static void printReport(const std::string& label, const SpatialIndexBenchmarkReport& report);
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
+#include <atomic>
+#include <cstdint>
+
+// Immutable zone multipliers published by SurgeEngine::recompute. Zones without
+// surge are omitted, so lookups default to 1.0.
+struct SurgeSnapshot {
+    std::unordered_map<std::int64_t, double> zoneMultipliers;
+    std::uint64_t version = 0;
+    std::chrono::system_clock::time_point computedAt;
+
+    double getMultiplier(std::int64_t zone) const;
+};
+
+// Zone-based surge pricing. Bookings add demand to their pickup zone, driver
+// positions set supply, and a periodic recompute turns the demand/supply ratio of
+// each zone into a multiplier. Readers take the current snapshot without locking
+// out the writer, so quoting never waits on a recompute.
+class SurgeEngine {
+private:
+    double zoneDegrees;
+    double maxMultiplier;
+    double sensitivity;          // Multiplier increase per unit of excess demand ratio
+    double demandHalfLifeSeconds;
+
+    std::mutex inputMutex;                           // Guards demand, supply, lastDecay and nextVersion
+    std::unordered_map<std::int64_t, double> demand; // Exponentially decayed booking counts
+    std::unordered_map<std::int64_t, int> supply;    // Available drivers per zone
+    std::chrono::steady_clock::time_point lastDecay;
+    std::uint64_t nextVersion;
+
+    std::shared_ptr<const SurgeSnapshot> snapshot;   // Accessed with atomic_load/atomic_store
+
+    std::thread ticker;
+    std::mutex tickerMutex;
+    std::condition_variable tickerWake;
+    std::atomic<bool> running;
+
+    void tickLoop(std::chrono::milliseconds interval);
+
+public:
+    explicit SurgeEngine(double zoneDegrees = 0.02, double maxMultiplier = 3.0, double sensitivity = 0.5,
+                         double demandHalfLifeSeconds = 300.0);
+    ~SurgeEngine();
+
+    SurgeEngine(const SurgeEngine&) = delete;
+    SurgeEngine& operator=(const SurgeEngine&) = delete;
+
+    std::int64_t zoneOf(double lat, double lon) const;
+
+    // Inputs; safe from any thread
+    void recordDemand(double lat, double lon, double weight = 1.0);
+    void setSupply(const std::vector<std::pair<double, double>>& availableDriverPositions);
+
+    // Decays demand, recomputes every zone and publishes a new snapshot
+    void recompute();
+
+    // Background recompute every interval until stop()
+    void start(std::chrono::milliseconds interval);
+    void stop();
+    bool isRunning() const { return running; }
+
+    std::shared_ptr<const SurgeSnapshot> getSnapshot() const;
+    double getMultiplier(double lat, double lon) const;
+    double getZoneDegrees() const { return zoneDegrees; }
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Location.hpp"
+#include "TripTrace.hpp"
 #include <string>
 #include <memory>
 #include <chrono>
@@ -35,6 +36,7 @@ private:
     double driverRating;
     std::string customerFeedback;
     std::string driverFeedback;
+    TripTrace trace;
 
 public:
     Trip(const std::string& id, const std::string& customerId, 
@@ -60,6 +62,7 @@ public:
     double getDriverRating() const;
     std::string getCustomerFeedback() const;
     std::string getDriverFeedback() const;
+    const TripTrace& getTrace() const;
     
     // Setters
     void setDriverId(const std::string& driverId);
@@ -82,6 +85,7 @@ public:
     double getDuration() const; // in minutes
     bool isActive() const;
     void calculateDistance();
+    bool recordLocation(double latitude, double longitude, std::int64_t timestampMs);
     void startTrip();
     void completeTrip();
     void cancelTrip();
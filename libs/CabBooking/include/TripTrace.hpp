@@ -0,0 +1,70 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+struct TracePoint {
+    double latitude;
+    double longitude;
+    std::int64_t timestampMs;
+};
+
+// Compact GPS trace of a trip. Points are stored as fixed-point lat/lon (1e-6
+// degrees, about 11 cm) and millisecond timestamps, each encoded as a zigzag varint
+// delta from the previous point, so a 1 Hz trace costs a few bytes per point
+// instead of 24. A checkpoint every KEYFRAME_INTERVAL points records the decoder
+// state, so any point can be decoded without replaying the whole trace.
+class TripTrace {
+public:
+    static const double COORDINATE_SCALE;
+    static const size_t KEYFRAME_INTERVAL = 64;
+
+private:
+    struct Checkpoint {
+        size_t byteOffset;        // Start of the checkpoint's first point
+        std::int64_t latitude;    // Fixed-point state before that point
+        std::int64_t longitude;
+        std::int64_t timestampMs;
+    };
+
+    std::vector<std::uint8_t> bytes;
+    std::vector<Checkpoint> checkpoints;
+    size_t pointCount;
+
+    // Decoder state after the last point
+    std::int64_t lastLatitude;
+    std::int64_t lastLongitude;
+    std::int64_t lastTimestampMs;
+    double distanceKm;            // Along the stored (quantized) points
+
+    void appendFixed(std::int64_t lat, std::int64_t lon, std::int64_t timestampMs);
+
+public:
+    TripTrace();
+
+    // Rebuilds a trace from getEncoded() output; an invalid buffer yields an empty trace
+    static TripTrace fromEncoded(const std::vector<std::uint8_t>& encoded);
+
+    // Appends a point; returns false if its timestamp is earlier than the last point's
+    bool append(double latitude, double longitude, std::int64_t timestampMs);
+
+    size_t size() const { return pointCount; }
+    bool empty() const { return pointCount == 0; }
+    size_t getEncodedSize() const { return bytes.size(); }
+    const std::vector<std::uint8_t>& getEncoded() const { return bytes; }
+
+    // Random access: seeks to the nearest checkpoint, then decodes forward
+    TracePoint at(size_t index) const;
+    std::vector<TracePoint> decode(size_t first = 0, size_t count = SIZE_MAX) const;
+
+    // Maintained while appending
+    double getDistanceKm() const { return distanceKm; }
+    // Full decode and Haversine sum, for audits of the maintained value
+    double recomputeDistanceKm() const;
+
+    // Douglas-Peucker simplification: drops points within toleranceMeters of the
+    // simplified path. The distance of the result is shorter, so fares should be
+    // audited against the original trace.
+    TripTrace simplified(double toleranceMeters) const;
+};
@@ -0,0 +1,178 @@
+#include "../include/BatchMatcher.hpp"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+namespace {
+    const double INF = std::numeric_limits<double>::infinity();
+
+    using QueueEntry = std::pair<double, std::uint32_t>;
+}
+
+const std::vector<int>& BatchMatcher::solve(size_t bookingCount, size_t driverCount,
+                                            const std::vector<MatchEdge>& edges, double unmatchedCost) {
+    // Shift costs so the zero potentials start feasible
+    double minCost = 0.0;
+    double maxCost = 0.0;
+    for (const auto& edge : edges) {
+        minCost = std::min(minCost, edge.cost);
+        maxCost = std::max(maxCost, edge.cost);
+    }
+    if (unmatchedCost < 0) {
+        // Higher than any complete set of real edges, so cardinality always wins
+        unmatchedCost = (maxCost - minCost + 1.0) * (bookingCount + 1);
+    } else {
+        unmatchedCost -= minCost;
+    }
+
+    // Bucket edges by booking; the last slot of each row is its unmatched column
+    rowStart.assign(bookingCount + 1, 0);
+    for (const auto& edge : edges) {
+        if (edge.booking < bookingCount && edge.driver < driverCount) {
+            rowStart[edge.booking + 1]++;
+        }
+    }
+    for (size_t i = 0; i < bookingCount; ++i) {
+        rowStart[i + 1] += rowStart[i] + 1;
+    }
+    edgeDriver.resize(rowStart[bookingCount]);
+    edgeCost.resize(rowStart[bookingCount]);
+    std::vector<std::uint32_t> fill(rowStart.begin(), rowStart.end() - 1);
+    for (const auto& edge : edges) {
+        if (edge.booking < bookingCount && edge.driver < driverCount) {
+            std::uint32_t slot = fill[edge.booking]++;
+            edgeDriver[slot] = edge.driver;
+            edgeCost[slot] = edge.cost - minCost;
+        }
+    }
+    for (size_t i = 0; i < bookingCount; ++i) {
+        edgeDriver[fill[i]] = static_cast<std::uint32_t>(driverCount + i);
+        edgeCost[fill[i]] = unmatchedCost;
+    }
+
+    size_t columns = driverCount + bookingCount;
+    bookingPotential.assign(bookingCount, 0.0);
+    driverPotential.assign(columns, 0.0);
+    driverOwner.assign(columns, -1);
+    assignment.assign(bookingCount, -1);
+    distance.assign(columns, INF);
+    previousBooking.assign(columns, -1);
+    finalized.assign(columns, 0);
+
+    for (std::uint32_t booking = 0; booking < bookingCount; ++booking) {
+        augment(booking);
+    }
+
+    // Restore the caller's costs for getTotalCost
+    for (size_t i = 0; i < bookingCount; ++i) {
+        for (std::uint32_t e = rowStart[i]; e + 1 < rowStart[i + 1]; ++e) {
+            edgeCost[e] += minCost;
+        }
+    }
+
+    result.assign(bookingCount, -1);
+    for (size_t i = 0; i < bookingCount; ++i) {
+        if (assignment[i] >= 0 && static_cast<size_t>(assignment[i]) < driverCount) {
+            result[i] = assignment[i];
+        }
+    }
+    return result;
+}
+
+void BatchMatcher::augment(std::uint32_t booking) {
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> frontier;
+    visitedDrivers.clear();
+    settledDrivers.clear();
+
+    auto relax = [&](std::uint32_t from, double base) {
+        for (std::uint32_t e = rowStart[from]; e < rowStart[from + 1]; ++e) {
+            std::uint32_t driver = edgeDriver[e];
+            if (finalized[driver]) {
+                continue;
+            }
+            double reduced = base + edgeCost[e] - bookingPotential[from] - driverPotential[driver];
+            if (reduced < distance[driver]) {
+                if (distance[driver] == INF) {
+                    visitedDrivers.push_back(driver);
+                }
+                distance[driver] = reduced;
+                previousBooking[driver] = static_cast<int>(from);
+                frontier.push({reduced, driver});
+            }
+        }
+    };
+
+    relax(booking, 0.0);
+
+    int freeDriver = -1;
+    double pathCost = 0.0;
+    while (!frontier.empty()) {
+        QueueEntry top = frontier.top();
+        frontier.pop();
+        std::uint32_t driver = top.second;
+        if (finalized[driver] || top.first > distance[driver]) {
+            continue;
+        }
+        finalized[driver] = 1;
+        settledDrivers.push_back(driver);
+
+        if (driverOwner[driver] < 0) {
+            freeDriver = static_cast<int>(driver);
+            pathCost = top.first;
+            break;
+        }
+        // The owner's matched edge is tight, so it is reached at the same distance
+        relax(static_cast<std::uint32_t>(driverOwner[driver]), top.first);
+    }
+
+    if (freeDriver >= 0) {
+        // Keep reduced costs non-negative and matched edges tight
+        bookingPotential[booking] += pathCost;
+        for (std::uint32_t driver : settledDrivers) {
+            double slack = pathCost - distance[driver];
+            driverPotential[driver] -= slack;
+            if (driverOwner[driver] >= 0) {
+                bookingPotential[driverOwner[driver]] += slack;
+            }
+        }
+
+        // Flip the alternating path
+        int driver = freeDriver;
+        while (driver >= 0) {
+            int owner = previousBooking[driver];
+            int displaced = assignment[owner];
+            assignment[owner] = driver;
+            driverOwner[driver] = owner;
+            driver = owner == static_cast<int>(booking) ? -1 : displaced;
+        }
+    }
+
+    for (std::uint32_t driver : visitedDrivers) {
+        distance[driver] = INF;
+        previousBooking[driver] = -1;
+        finalized[driver] = 0;
+    }
+}
+
+size_t BatchMatcher::getMatchedCount() const {
+    return static_cast<size_t>(std::count_if(result.begin(), result.end(),
+                                             [](int driver) { return driver >= 0; }));
+}
+
+double BatchMatcher::getTotalCost() const {
+    double total = 0.0;
+    for (size_t booking = 0; booking < result.size(); ++booking) {
+        if (result[booking] < 0) {
+            continue;
+        }
+        for (std::uint32_t e = rowStart[booking]; e + 1 < rowStart[booking + 1]; ++e) {
+            if (edgeDriver[e] == static_cast<std::uint32_t>(result[booking])) {
+                total += edgeCost[e];
+                break;
+            }
+        }
+    }
+    return total;
+}
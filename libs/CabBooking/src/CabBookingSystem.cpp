@@ -1,4 +1,46 @@
 #include "../include/CabBookingSystem.hpp"
+#include <cmath>
+
+namespace {
+    bool parseVehicleType(const std::string& name, VehicleType& type) {
+        static const std::pair<const char*, VehicleType> names[] = {
+            {"SEDAN", VehicleType::SEDAN}, {"SUV", VehicleType::SUV},
+            {"HATCHBACK", VehicleType::HATCHBACK}, {"BIKE", VehicleType::BIKE},
+            {"AUTO", VehicleType::AUTO}, {"PREMIUM", VehicleType::PREMIUM}
+        };
+        for (const auto& entry : names) {
+            if (name == entry.first) {
+                type = entry.second;
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    // Resolves history IDs against an entity map, skipping IDs it no longer holds
+    template <typename T>
+    std::vector<std::shared_ptr<T>> resolve(const std::vector<std::string>& ids,
+                                            const std::unordered_map<std::string, std::shared_ptr<T>>& store) {
+        std::vector<std::shared_ptr<T>> result;
+        result.reserve(ids.size());
+        for (const auto& id : ids) {
+            auto it = store.find(id);
+            if (it != store.end()) {
+                result.push_back(it->second);
+            }
+        }
+        return result;
+    }
+    
+    template <typename T>
+    std::vector<std::shared_ptr<T>> resolve(const std::vector<std::string>* ids,
+                                            const std::unordered_map<std::string, std::shared_ptr<T>>& store) {
+        if (!ids) {
+            return {};
+        }
+        return resolve(*ids, store);
+    }
+}
 
 CabBookingSystem::CabBookingSystem() 
     : nextCustomerId(1), nextDriverId(1), nextVehicleId(1), nextTripId(1), 
@@ -6,6 +48,9 @@ CabBookingSystem::CabBookingSystem()
     
     fareCalculator = std::make_shared<FareCalculator>();
     notificationService = std::make_shared<NotificationService>();
+    locationIngestor = std::make_shared<LocationIngestor>();
+    surgeEngine = std::make_shared<SurgeEngine>();
+    fareCalculator->setSurgeEngine(surgeEngine);
 }
 
 // Customer management
@@ -51,6 +96,7 @@ std::shared_ptr<Driver> CabBookingSystem::registerDriver(const std::string& name
     std::string driverId = "DRIVER_" + std::to_string(nextDriverId++);
     auto driver = std::make_shared<Driver>(driverId, name, email, phone, password, license);
     drivers[driverId] = driver;
+    locationIngestor->registerSource(driverId);
     return driver;
 }
 
@@ -98,6 +144,7 @@ std::shared_ptr<Vehicle> CabBookingSystem::addVehicle(const std::string& license
     std::string vehicleId = "VEH_" + std::to_string(nextVehicleId++);
     auto vehicle = std::make_shared<Vehicle>(vehicleId, licensePlate, model, brand, year, type, capacity, baseFare, perKmRate, isAC);
     vehicles[vehicleId] = vehicle;
+    vehicleIndex.upsert(vehicleId, vehicle->getCurrentLatitude(), vehicle->getCurrentLongitude(), type);
     return vehicle;
 }
 
@@ -108,6 +155,8 @@ std::shared_ptr<Vehicle> CabBookingSystem::assignVehicleToDriver(const std::stri
     if (vehicleIt != vehicles.end() && driverIt != drivers.end()) {
         vehicleIt->second->setDriverId(driverId);
         driverIt->second->assignVehicle(vehicleId);
+        driverIndex.upsert(driverId, driverIt->second->getCurrentLatitude(),
+                           driverIt->second->getCurrentLongitude(), vehicleIt->second->getType());
         return vehicleIt->second;
     }
     return nullptr;
@@ -163,12 +212,23 @@ std::shared_ptr<Booking> CabBookingSystem::createBooking(const std::string& cust
         return nullptr;
     }
     
+    // Count the request as demand in its pickup zone before quoting
+    surgeEngine->recordDemand(pickupIt->second->getLatitude(), pickupIt->second->getLongitude());
+    
     // Calculate estimated fare
     double estimatedFare = calculateEstimatedFare(pickupLocationId, dropLocationId, vehicleType);
     
     std::string bookingId = "BOOK_" + std::to_string(nextBookingId++);
     auto booking = std::make_shared<Booking>(bookingId, customerId, pickupIt->second, dropIt->second, vehicleType, estimatedFare);
     bookings[bookingId] = booking;
+    customerBookings.append(customerId, bookingId);
+    
+    if (matchingConfig.window.count() > 0) {
+        if (pendingMatches.empty()) {
+            windowOpened = std::chrono::steady_clock::now();
+        }
+        pendingMatches.push_back(bookingId);
+    }
     
     // Update customer status
     customerIt->second->setHasActiveBooking(true);
@@ -182,31 +242,27 @@ std::shared_ptr<Driver> CabBookingSystem::findNearestDriver(const std::string& p
         return nullptr;
     }
     
-    std::shared_ptr<Driver> nearestDriver = nullptr;
-    double minDistance = std::numeric_limits<double>::max();
-    
-    for (const auto& pair : drivers) {
-        if (!pair.second->canAcceptRide()) {
-            continue;
-        }
-        
-        // Check if driver has the required vehicle type
-        auto vehicleIt = vehicles.find(pair.second->getVehicleId());
-        if (vehicleIt == vehicles.end() || vehicleIt->second->getVehicleTypeString() != vehicleType) {
-            continue;
-        }
-        
-        double distance = pickupIt->second->calculateDistance(Location("temp", "", 
-                                                                      pair.second->getCurrentLatitude(), 
-                                                                      pair.second->getCurrentLongitude(), "", "", "", ""));
-        
-        if (distance < minDistance) {
-            minDistance = distance;
-            nearestDriver = pair.second;
-        }
+    auto nearest = findNearestDrivers(pickupIt->second->getLatitude(), pickupIt->second->getLongitude(), vehicleType, 1);
+    return nearest.empty() ? nullptr : nearest.front();
+}
+
+std::vector<std::shared_ptr<Driver>> CabBookingSystem::findNearestDrivers(double latitude, double longitude,
+                                                                          const std::string& vehicleType, int count) const {
+    std::vector<std::shared_ptr<Driver>> result;
+    VehicleType type;
+    if (count <= 0 || !parseVehicleType(vehicleType, type)) {
+        return result;
     }
     
-    return nearestDriver;
+    auto matches = driverIndex.findNearest(latitude, longitude, count, type, [this](const SpatialEntry& entry) {
+        auto driverIt = drivers.find(entry.id);
+        return driverIt != drivers.end() && driverIt->second->canAcceptRide();
+    });
+    
+    for (const auto& match : matches) {
+        result.push_back(drivers.at(match.id));
+    }
+    return result;
 }
 
 bool CabBookingSystem::assignDriverToBooking(const std::string& bookingId, const std::string& driverId) {
@@ -222,16 +278,146 @@ bool CabBookingSystem::assignDriverToBooking(const std::string& bookingId, const
         return false;
     }
     
+    // A reassigned booking moves to the new driver's history, so each booking is listed once
+    std::string previousDriverId = bookingIt->second->getDriverId();
+    if (previousDriverId != driverId) {
+        driverBookings.remove(previousDriverId, bookingId);
+        driverBookings.append(driverId, bookingId);
+        releaseDriver(previousDriverId);
+    }
     bookingIt->second->assignDriver(driverId, vehicleIt->second->getVehicleId());
+    driverIt->second->setCurrentStatus("BUSY");
     return true;
 }
 
+void CabBookingSystem::releaseDriver(const std::string& driverId) {
+    auto driverIt = drivers.find(driverId);
+    if (driverIt == drivers.end()) {
+        return;
+    }
+    
+    driverIt->second->setCurrentStatus("AVAILABLE");
+    auto vehicleIt = vehicles.find(driverIt->second->getVehicleId());
+    if (vehicleIt != vehicles.end()) {
+        driverIndex.upsert(driverId, driverIt->second->getCurrentLatitude(),
+                           driverIt->second->getCurrentLongitude(), vehicleIt->second->getType());
+    }
+}
+
+void CabBookingSystem::setMatchingConfig(const MatchingConfig& config) {
+    matchingConfig = config;
+}
+
+const MatchingConfig& CabBookingSystem::getMatchingConfig() const {
+    return matchingConfig;
+}
+
+size_t CabBookingSystem::getPendingMatchCount() const {
+    return pendingMatches.size();
+}
+
+size_t CabBookingSystem::runMatchingRound(bool force) {
+    auto now = std::chrono::steady_clock::now();
+    if (pendingMatches.empty() || (!force && now - windowOpened < matchingConfig.window)) {
+        return 0;
+    }
+    
+    // Drop bookings that were cancelled, assigned elsewhere or timed out while waiting
+    std::vector<std::shared_ptr<Booking>> open;
+    for (const auto& bookingId : pendingMatches) {
+        auto bookingIt = bookings.find(bookingId);
+        if (bookingIt == bookings.end() || bookingIt->second->getStatus() != BookingStatus::PENDING) {
+            continue;
+        }
+        if (bookingIt->second->isExpired()) {
+            bookingIt->second->setStatus(BookingStatus::EXPIRED);
+            auto customerIt = customers.find(bookingIt->second->getCustomerId());
+            if (customerIt != customers.end()) {
+                customerIt->second->setHasActiveBooking(false);
+            }
+            continue;
+        }
+        open.push_back(bookingIt->second);
+    }
+    
+    // Sparse cost matrix: each booking only sees its nearest available drivers
+    std::vector<MatchEdge> edges;
+    std::vector<std::string> candidateDrivers;
+    std::unordered_map<std::string, std::uint32_t> driverColumns;
+    auto available = [this](const SpatialEntry& entry) {
+        auto driverIt = drivers.find(entry.id);
+        return driverIt != drivers.end() && driverIt->second->canAcceptRide();
+    };
+    
+    for (size_t i = 0; i < open.size(); ++i) {
+        VehicleType type;
+        if (!parseVehicleType(open[i]->getVehicleType(), type)) {
+            continue;
+        }
+        auto pickup = open[i]->getPickupLocation();
+        auto matches = driverIndex.findNearest(pickup->getLatitude(), pickup->getLongitude(),
+                                               matchingConfig.candidatesPerBooking, type, available);
+        for (const auto& match : matches) {
+            if (match.distanceKm > matchingConfig.maxPickupKm) {
+                break;
+            }
+            auto column = driverColumns.emplace(match.id, static_cast<std::uint32_t>(candidateDrivers.size()));
+            if (column.second) {
+                candidateDrivers.push_back(match.id);
+            }
+            double etaMinutes = match.distanceKm / matchingConfig.averageSpeedKmh * 60.0;
+            edges.push_back({static_cast<std::uint32_t>(i), column.first->second, etaMinutes});
+        }
+    }
+    
+    const auto& assignment = batchMatcher.solve(open.size(), candidateDrivers.size(), edges);
+    
+    size_t matched = 0;
+    pendingMatches.clear();
+    for (size_t i = 0; i < open.size(); ++i) {
+        if (assignment[i] < 0) {
+            pendingMatches.push_back(open[i]->getBookingId());
+            continue;
+        }
+        
+        const std::string& driverId = candidateDrivers[assignment[i]];
+        if (!assignDriverToBooking(open[i]->getBookingId(), driverId)) {
+            pendingMatches.push_back(open[i]->getBookingId());
+            continue;
+        }
+        
+        auto driver = drivers.at(driverId);
+        auto pickup = open[i]->getPickupLocation();
+        double pickupKm = Location::haversineDistance(driver->getCurrentLatitude(), driver->getCurrentLongitude(),
+                                                      pickup->getLatitude(), pickup->getLongitude());
+        int etaMinutes = static_cast<int>(std::ceil(pickupKm / matchingConfig.averageSpeedKmh * 60.0));
+        open[i]->setEstimatedWaitTime(etaMinutes);
+        
+        auto vehicle = vehicles.at(driver->getVehicleId());
+        notificationService->notifyDriverAssigned(open[i]->getCustomerId(), driver->getName(),
+                                                  vehicle->getBrand() + " " + vehicle->getModel() + " (" +
+                                                  vehicle->getLicensePlate() + ")", etaMinutes);
+        matched++;
+    }
+    
+    windowOpened = now;
+    return matched;
+}
+
 bool CabBookingSystem::cancelBooking(const std::string& bookingId, const std::string& reason) {
     auto bookingIt = bookings.find(bookingId);
     if (bookingIt == bookings.end()) {
         return false;
     }
     
+    // Release a driver that was assigned but never started the trip
+    if (bookingIt->second->getStatus() == BookingStatus::ASSIGNED && !bookingIt->second->getTrip()) {
+        auto driverIt = drivers.find(bookingIt->second->getDriverId());
+        if (driverIt != drivers.end()) {
+            driverIt->second->setCurrentStatus("AVAILABLE");
+        }
+    }
+    
     bookingIt->second->cancelBooking();
     
     // Update customer status
@@ -247,23 +433,21 @@ bool CabBookingSystem::cancelBooking(const std::string& bookingId, const std::st
 }
 
 std::vector<std::shared_ptr<Booking>> CabBookingSystem::getCustomerBookings(const std::string& customerId) const {
-    std::vector<std::shared_ptr<Booking>> result;
-    for (const auto& pair : bookings) {
-        if (pair.second->getCustomerId() == customerId) {
-            result.push_back(pair.second);
-        }
-    }
-    return result;
+    return resolve(customerBookings.find(customerId), bookings);
 }
 
 std::vector<std::shared_ptr<Booking>> CabBookingSystem::getDriverBookings(const std::string& driverId) const {
-    std::vector<std::shared_ptr<Booking>> result;
-    for (const auto& pair : bookings) {
-        if (pair.second->getDriverId() == driverId) {
-            result.push_back(pair.second);
-        }
-    }
-    return result;
+    return resolve(driverBookings.find(driverId), bookings);
+}
+
+std::vector<std::shared_ptr<Booking>> CabBookingSystem::getCustomerBookings(const std::string& customerId, size_t offset,
+                                                                            size_t limit) const {
+    return resolve(customerBookings.page(customerId, offset, limit), bookings);
+}
+
+std::vector<std::shared_ptr<Booking>> CabBookingSystem::getDriverBookings(const std::string& driverId, size_t offset,
+                                                                          size_t limit) const {
+    return resolve(driverBookings.page(driverId, offset, limit), bookings);
 }
 
 // Trip management
@@ -283,6 +467,8 @@ std::shared_ptr<Trip> CabBookingSystem::startTrip(const std::string& bookingId)
     trip->setStatus(TripStatus::ACCEPTED);
     
     trips[tripId] = trip;
+    customerTrips.append(trip->getCustomerId(), tripId);
+    driverTrips.append(trip->getDriverId(), tripId);
     bookingIt->second->setTrip(trip);
     
     // Send notifications
@@ -294,22 +480,31 @@ std::shared_ptr<Trip> CabBookingSystem::startTrip(const std::string& bookingId)
     return trip;
 }
 
-bool CabBookingSystem::updateTripLocation(const std::string& tripId, double latitude, double longitude) {
+bool CabBookingSystem::updateTripLocation(const std::string& tripId, double latitude, double longitude,
+                                          std::int64_t timestampMs) {
     auto tripIt = trips.find(tripId);
     if (tripIt == trips.end()) {
         return false;
     }
     
+    if (timestampMs < 0) {
+        timestampMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+    // An out-of-order point is stale; keep the driver where the newer one put it
+    if (!tripIt->second->recordLocation(latitude, longitude, timestampMs)) {
+        return false;
+    }
+    
     // Update driver location
     auto driverIt = drivers.find(tripIt->second->getDriverId());
     if (driverIt != drivers.end()) {
-        driverIt->second->updateLocation(latitude, longitude);
+        updateDriverLocation(driverIt->first, latitude, longitude);
     }
     
     // Update vehicle location
-    auto vehicleIt = vehicles.find(tripIt->second->getVehicleId());
-    if (vehicleIt != vehicles.end()) {
-        vehicleIt->second->updateLocation(latitude, longitude);
+    if (driverIt == drivers.end() || driverIt->second->getVehicleId() != tripIt->second->getVehicleId()) {
+        updateVehicleLocation(tripIt->second->getVehicleId(), latitude, longitude);
     }
     
     return true;
@@ -322,6 +517,7 @@ std::shared_ptr<Trip> CabBookingSystem::completeTrip(const std::string& tripId,
     }
     
     tripIt->second->completeTrip();
+    tripIt->second->calculateDistance();
     tripIt->second->setActualFare(actualFare);
     
     // Update customer status
@@ -338,6 +534,7 @@ std::shared_ptr<Trip> CabBookingSystem::completeTrip(const std::string& tripId,
         driverIt->second->addCompletedTrip(tripIt->second);
         driverIt->second->addEarnings(actualFare * 0.85); // Driver gets 85% of fare
         driverIt->second->incrementTotalTrips();
+        driverIt->second->setCurrentStatus("AVAILABLE");
     }
     
     // Send notification
@@ -362,27 +559,30 @@ bool CabBookingSystem::cancelTrip(const std::string& tripId) {
         customerIt->second->setHasActiveBooking(false);
     }
     
+    auto driverIt = drivers.find(tripIt->second->getDriverId());
+    if (driverIt != drivers.end()) {
+        driverIt->second->setCurrentStatus("AVAILABLE");
+    }
+    
     return true;
 }
 
 std::vector<std::shared_ptr<Trip>> CabBookingSystem::getCustomerTrips(const std::string& customerId) const {
-    std::vector<std::shared_ptr<Trip>> result;
-    for (const auto& pair : trips) {
-        if (pair.second->getCustomerId() == customerId) {
-            result.push_back(pair.second);
-        }
-    }
-    return result;
+    return resolve(customerTrips.find(customerId), trips);
 }
 
 std::vector<std::shared_ptr<Trip>> CabBookingSystem::getDriverTrips(const std::string& driverId) const {
-    std::vector<std::shared_ptr<Trip>> result;
-    for (const auto& pair : trips) {
-        if (pair.second->getDriverId() == driverId) {
-            result.push_back(pair.second);
-        }
-    }
-    return result;
+    return resolve(driverTrips.find(driverId), trips);
+}
+
+std::vector<std::shared_ptr<Trip>> CabBookingSystem::getCustomerTrips(const std::string& customerId, size_t offset,
+                                                                      size_t limit) const {
+    return resolve(customerTrips.page(customerId, offset, limit), trips);
+}
+
+std::vector<std::shared_ptr<Trip>> CabBookingSystem::getDriverTrips(const std::string& driverId, size_t offset,
+                                                                    size_t limit) const {
+    return resolve(driverTrips.page(driverId, offset, limit), trips);
 }
 
 // Payment management
@@ -398,6 +598,11 @@ std::shared_ptr<Payment> CabBookingSystem::processPayment(const std::string& tri
     
     payment->processPayment();
     payments[paymentId] = payment;
+    customerPayments.append(payment->getCustomerId(), paymentId);
+    driverPayments.append(payment->getDriverId(), paymentId);
+    if (payment->isSuccessful()) {
+        recordRevenue(*payment, 1.0);
+    }
     
     tripIt->second->setIsPaid(true);
     tripIt->second->setPaymentMethod(payment->getMethodString());
@@ -417,28 +622,40 @@ bool CabBookingSystem::refundPayment(const std::string& paymentId) {
         return false;
     }
     
+    if (paymentIt->second->isSuccessful()) {
+        recordRevenue(*paymentIt->second, -1.0);
+    }
     paymentIt->second->refund();
     return true;
 }
 
-std::vector<std::shared_ptr<Payment>> CabBookingSystem::getCustomerPayments(const std::string& customerId) const {
-    std::vector<std::shared_ptr<Payment>> result;
-    for (const auto& pair : payments) {
-        if (pair.second->getCustomerId() == customerId) {
-            result.push_back(pair.second);
-        }
+void CabBookingSystem::recordRevenue(const Payment& payment, double sign) {
+    int count = sign > 0 ? 1 : -1;
+    for (RevenueSummary* summary : {&revenue, &driverRevenue[payment.getDriverId()],
+                                    &customerRevenue[payment.getCustomerId()]}) {
+        summary->grossAmount += sign * payment.getAmount();
+        summary->platformFees += sign * payment.getPlatformFee();
+        summary->driverPayouts += sign * payment.getDriverAmount();
+        summary->paymentCount += count;
     }
-    return result;
+}
+
+std::vector<std::shared_ptr<Payment>> CabBookingSystem::getCustomerPayments(const std::string& customerId) const {
+    return resolve(customerPayments.find(customerId), payments);
 }
 
 std::vector<std::shared_ptr<Payment>> CabBookingSystem::getDriverPayments(const std::string& driverId) const {
-    std::vector<std::shared_ptr<Payment>> result;
-    for (const auto& pair : payments) {
-        if (pair.second->getDriverId() == driverId) {
-            result.push_back(pair.second);
-        }
-    }
-    return result;
+    return resolve(driverPayments.find(driverId), payments);
+}
+
+std::vector<std::shared_ptr<Payment>> CabBookingSystem::getCustomerPayments(const std::string& customerId, size_t offset,
+                                                                            size_t limit) const {
+    return resolve(customerPayments.page(customerId, offset, limit), payments);
+}
+
+std::vector<std::shared_ptr<Payment>> CabBookingSystem::getDriverPayments(const std::string& driverId, size_t offset,
+                                                                          size_t limit) const {
+    return resolve(driverPayments.page(driverId, offset, limit), payments);
 }
 
 // Rating and feedback
@@ -492,6 +709,8 @@ void CabBookingSystem::updateDriverLocation(const std::string& driverId, double
         auto vehicleIt = vehicles.find(driverIt->second->getVehicleId());
         if (vehicleIt != vehicles.end()) {
             vehicleIt->second->updateLocation(latitude, longitude);
+            vehicleIndex.upsert(vehicleIt->first, latitude, longitude, vehicleIt->second->getType());
+            driverIndex.upsert(driverId, latitude, longitude, vehicleIt->second->getType());
         }
     }
 }
@@ -500,9 +719,26 @@ void CabBookingSystem::updateVehicleLocation(const std::string& vehicleId, doubl
     auto vehicleIt = vehicles.find(vehicleId);
     if (vehicleIt != vehicles.end()) {
         vehicleIt->second->updateLocation(latitude, longitude);
+        vehicleIndex.upsert(vehicleId, latitude, longitude, vehicleIt->second->getType());
     }
 }
 
+std::uint32_t CabBookingSystem::getDriverLocationSource(const std::string& driverId) const {
+    return locationIngestor->findSource(driverId);
+}
+
+bool CabBookingSystem::submitDriverLocation(std::uint32_t source, double latitude, double longitude,
+                                            std::int64_t timestampMs) {
+    return locationIngestor->submit(source, latitude, longitude, timestampMs);
+}
+
+size_t CabBookingSystem::applyLocationUpdates() {
+    return locationIngestor->drain([this](const std::string& driverId, double latitude, double longitude,
+                                          std::int64_t) {
+        updateDriverLocation(driverId, latitude, longitude);
+    });
+}
+
 double CabBookingSystem::calculateEstimatedFare(const std::string& pickupLocationId, const std::string& dropLocationId,
                                                const std::string& vehicleType) {
     auto pickupIt = locations.find(pickupLocationId);
@@ -512,10 +748,29 @@ double CabBookingSystem::calculateEstimatedFare(const std::string& pickupLocatio
         return 0.0;
     }
     
-    // Create a temporary vehicle for fare calculation
-    auto tempVehicle = std::make_shared<Vehicle>("temp", "", "", "", 2020, VehicleType::SEDAN, 4, 50.0, 12.0);
+    TripRequest request;
+    request.pickupLatitude = pickupIt->second->getLatitude();
+    request.pickupLongitude = pickupIt->second->getLongitude();
+    request.dropLatitude = dropIt->second->getLatitude();
+    request.dropLongitude = dropIt->second->getLongitude();
+    if (!parseVehicleType(vehicleType, request.vehicleType)) {
+        request.vehicleType = VehicleType::SEDAN;
+    }
     
-    return fareCalculator->calculateFare(pickupIt->second, dropIt->second, tempVehicle);
+    return fareCalculator->quoteFare(request).totalFare;
+}
+
+size_t CabBookingSystem::publishSurgeSupply() {
+    std::vector<std::pair<double, double>> positions;
+    positions.reserve(drivers.size());
+    for (const auto& pair : drivers) {
+        if (pair.second->canAcceptRide()) {
+            positions.emplace_back(pair.second->getCurrentLatitude(), pair.second->getCurrentLongitude());
+        }
+    }
+    
+    surgeEngine->setSupply(positions);
+    return positions.size();
 }
 
 std::vector<std::shared_ptr<Vehicle>> CabBookingSystem::getNearbyVehicles(const std::string& locationId, double radiusKm) const {
@@ -524,24 +779,28 @@ std::vector<std::shared_ptr<Vehicle>> CabBookingSystem::getNearbyVehicles(const
         return {};
     }
     
+    auto matches = vehicleIndex.findWithinRadius(locationIt->second->getLatitude(), locationIt->second->getLongitude(),
+                                                 radiusKm, [this](const SpatialEntry& entry) {
+        auto vehicleIt = vehicles.find(entry.id);
+        return vehicleIt != vehicles.end() && vehicleIt->second->isAvailable();
+    });
+    
     std::vector<std::shared_ptr<Vehicle>> result;
-    for (const auto& pair : vehicles) {
-        if (!pair.second->isAvailable()) {
-            continue;
-        }
-        
-        double distance = locationIt->second->calculateDistance(Location("temp", "", 
-                                                                        pair.second->getCurrentLatitude(), 
-                                                                        pair.second->getCurrentLongitude(), "", "", "", ""));
-        
-        if (distance <= radiusKm) {
-            result.push_back(pair.second);
-        }
+    for (const auto& match : matches) {
+        result.push_back(vehicles.at(match.id));
     }
     
     return result;
 }
 
+const SpatialIndex& CabBookingSystem::getDriverIndex() const {
+    return driverIndex;
+}
+
+const SpatialIndex& CabBookingSystem::getVehicleIndex() const {
+    return vehicleIndex;
+}
+
 // Getters for services
 std::shared_ptr<FareCalculator> CabBookingSystem::getFareCalculator() const {
     return fareCalculator;
@@ -551,6 +810,14 @@ std::shared_ptr<NotificationService> CabBookingSystem::getNotificationService()
     return notificationService;
 }
 
+std::shared_ptr<LocationIngestor> CabBookingSystem::getLocationIngestor() const {
+    return locationIngestor;
+}
+
+std::shared_ptr<SurgeEngine> CabBookingSystem::getSurgeEngine() const {
+    return surgeEngine;
+}
+
 // System statistics
 int CabBookingSystem::getTotalCustomers() const {
     return customers.size();
@@ -577,11 +844,19 @@ int CabBookingSystem::getTotalPayments() const {
 }
 
 double CabBookingSystem::getTotalRevenue() const {
-    double totalRevenue = 0.0;
-    for (const auto& pair : payments) {
-        if (pair.second->isSuccessful()) {
-            totalRevenue += pair.second->getPlatformFee();
-        }
-    }
-    return totalRevenue;
+    return revenue.platformFees;
+}
+
+RevenueSummary CabBookingSystem::getRevenueSummary() const {
+    return revenue;
+}
+
+RevenueSummary CabBookingSystem::getDriverRevenue(const std::string& driverId) const {
+    auto it = driverRevenue.find(driverId);
+    return it != driverRevenue.end() ? it->second : RevenueSummary();
+}
+
+RevenueSummary CabBookingSystem::getCustomerRevenue(const std::string& customerId) const {
+    auto it = customerRevenue.find(customerId);
+    return it != customerRevenue.end() ? it->second : RevenueSummary();
 } 
\ No newline at end of file
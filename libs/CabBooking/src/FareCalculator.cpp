@@ -1,6 +1,45 @@
 #include "../include/FareCalculator.hpp"
 #include <sstream>
 #include <iomanip>
+#include <chrono>
+#include <ctime>
+
+namespace {
+    const VehicleType ALL_VEHICLE_TYPES[] = {
+        VehicleType::SEDAN, VehicleType::SUV, VehicleType::HATCHBACK,
+        VehicleType::BIKE, VehicleType::AUTO, VehicleType::PREMIUM
+    };
+    const size_t VEHICLE_TYPE_COUNT = sizeof(ALL_VEHICLE_TYPES) / sizeof(ALL_VEHICLE_TYPES[0]);
+
+    const char* vehicleTypeName(VehicleType type) {
+        switch (type) {
+            case VehicleType::SEDAN: return "SEDAN";
+            case VehicleType::SUV: return "SUV";
+            case VehicleType::HATCHBACK: return "HATCHBACK";
+            case VehicleType::BIKE: return "BIKE";
+            case VehicleType::AUTO: return "AUTO";
+            case VehicleType::PREMIUM: return "PREMIUM";
+            default: return "UNKNOWN";
+        }
+    }
+
+    // Local hour, recomputed only when the cached hour has run out
+    int currentLocalHour() {
+        thread_local std::time_t hourStart = 0;
+        thread_local std::time_t hourEnd = 0;
+        thread_local int hour = 0;
+
+        std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+        if (now < hourStart || now >= hourEnd) {
+            std::tm local;
+            localtime_r(&now, &local);
+            hour = local.tm_hour;
+            hourStart = now - local.tm_min * 60 - local.tm_sec;
+            hourEnd = hourStart + 3600;
+        }
+        return hour;
+    }
+}
 
 FareCalculator::FareCalculator() 
     : peakHourMultiplier(1.5), nightMultiplier(1.3), weatherMultiplier(1.0),
@@ -32,13 +71,15 @@ double FareCalculator::calculateFare(std::shared_ptr<Location> pickup, std::shar
     
     // Get current hour if not provided
     if (currentHour == -1) {
-        auto now = std::chrono::system_clock::now();
-        auto time_t = std::chrono::system_clock::to_time_t(now);
-        std::tm* tm = std::localtime(&time_t);
-        currentHour = tm->tm_hour;
+        currentHour = currentLocalHour();
+    }
+    
+    double demandLevel = demandMultiplier;
+    if (surgeEngine && pickup) {
+        demandLevel = surgeEngine->getMultiplier(pickup->getLatitude(), pickup->getLongitude());
     }
     
-    double dynamicPricing = calculateDynamicPricing(baseFare, currentHour, demandMultiplier);
+    double dynamicPricing = calculateDynamicPricing(baseFare, currentHour, demandLevel);
     double additionalCharges = calculateAdditionalCharges(baseFare);
     
     return baseFare + dynamicPricing + additionalCharges;
@@ -80,6 +121,55 @@ double FareCalculator::calculateAdditionalCharges(double baseFare, int waitingMi
     return charges;
 }
 
+void FareCalculator::quoteFares(const TripRequest* requests, size_t count, FareQuote* quotes,
+                                int currentHour) const {
+    if (currentHour == -1) {
+        currentHour = currentLocalHour();
+    }
+    
+    // Resolve everything that is shared by the batch up front
+    double baseRateByType[VEHICLE_TYPE_COUNT];
+    double perKmRateByType[VEHICLE_TYPE_COUNT];
+    for (size_t i = 0; i < VEHICLE_TYPE_COUNT; ++i) {
+        baseRateByType[i] = getBaseRate(vehicleTypeName(ALL_VEHICLE_TYPES[i]));
+        perKmRateByType[i] = getPerKmRate(vehicleTypeName(ALL_VEHICLE_TYPES[i]));
+    }
+    double timeMultiplier = getCurrentMultiplier(currentHour, 1.0);
+    std::shared_ptr<const SurgeSnapshot> surge = surgeEngine ? surgeEngine->getSnapshot() : nullptr;
+    
+    for (size_t i = 0; i < count; ++i) {
+        const TripRequest& request = requests[i];
+        FareQuote& quote = quotes[i];
+        size_t type = static_cast<size_t>(request.vehicleType);
+        if (type >= VEHICLE_TYPE_COUNT) {
+            quote = FareQuote();
+            continue;
+        }
+        
+        quote.distanceKm = Location::haversineDistance(request.pickupLatitude, request.pickupLongitude,
+                                                       request.dropLatitude, request.dropLongitude);
+        quote.baseFare = baseRateByType[type] + quote.distanceKm * perKmRateByType[type];
+        quote.surgeMultiplier = surge
+            ? surge->getMultiplier(surgeEngine->zoneOf(request.pickupLatitude, request.pickupLongitude))
+            : demandMultiplier;
+        quote.dynamicPricing = quote.baseFare * (timeMultiplier * quote.surgeMultiplier - 1.0);
+        quote.additionalCharges = request.waitingMinutes * waitingCharge + quote.baseFare * platformFee;
+        quote.totalFare = quote.baseFare + quote.dynamicPricing + quote.additionalCharges;
+    }
+}
+
+std::vector<FareQuote> FareCalculator::quoteFares(const std::vector<TripRequest>& requests, int currentHour) const {
+    std::vector<FareQuote> quotes(requests.size());
+    quoteFares(requests.data(), requests.size(), quotes.data(), currentHour);
+    return quotes;
+}
+
+FareQuote FareCalculator::quoteFare(const TripRequest& request, int currentHour) const {
+    FareQuote quote;
+    quoteFares(&request, 1, &quote, currentHour);
+    return quote;
+}
+
 void FareCalculator::setBaseRate(const std::string& vehicleType, double rate) {
     baseRates[vehicleType] = rate;
 }
@@ -130,6 +220,14 @@ void FareCalculator::setNightHours(int start, int end) {
     nightHourEnd = end;
 }
 
+void FareCalculator::setSurgeEngine(std::shared_ptr<SurgeEngine> engine) {
+    surgeEngine = engine;
+}
+
+std::shared_ptr<SurgeEngine> FareCalculator::getSurgeEngine() const {
+    return surgeEngine;
+}
+
 double FareCalculator::getBaseRate(const std::string& vehicleType) const {
     auto it = baseRates.find(vehicleType);
     return it != baseRates.end() ? it->second : 50.0;
@@ -0,0 +1,138 @@
+#include "../include/FareQuoteBenchmark.hpp"
+#include "../include/GeoDistance.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <random>
+
+const double FareQuoteBenchmark::FARE_TOLERANCE = 1e-9;
+
+namespace {
+    const double KM_PER_DEGREE = GeoDistance::EARTH_RADIUS_KM * M_PI / 180.0;
+    const VehicleType VEHICLE_TYPES[] = {VehicleType::SEDAN, VehicleType::SUV, VehicleType::HATCHBACK,
+                                         VehicleType::BIKE, VehicleType::AUTO, VehicleType::PREMIUM};
+
+    double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Uniform point in a disc around the centre
+    std::pair<double, double> cityPoint(const FareQuoteBenchmarkConfig& config, std::mt19937& rng) {
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        double distance = config.cityRadiusKm * std::sqrt(unit(rng)) / KM_PER_DEGREE;
+        double bearing = 2.0 * M_PI * unit(rng);
+        double lonScale = 1.0 / std::cos(config.centerLatitude * M_PI / 180.0);
+        return {config.centerLatitude + distance * std::cos(bearing),
+                config.centerLongitude + distance * std::sin(bearing) * lonScale};
+    }
+
+    double relativeDifference(double a, double b) {
+        return std::abs(a - b) / std::max(1.0, std::abs(b));
+    }
+}
+
+FareQuoteBenchmark::FareQuoteBenchmark(const FareQuoteBenchmarkConfig& config) : config(config) {
+    this->config.quoteCount = std::max<size_t>(1, config.quoteCount);
+    this->config.iterations = std::max<size_t>(1, config.iterations);
+}
+
+FareQuoteBenchmarkReport FareQuoteBenchmark::run() {
+    auto wallStart = std::chrono::steady_clock::now();
+    FareQuoteBenchmarkReport report;
+    report.quoteCount = config.quoteCount;
+    std::mt19937 rng(config.seed);
+
+    // Demand concentrated near the centre, supply spread evenly, so some zones surge
+    auto surge = std::make_shared<SurgeEngine>();
+    FareQuoteBenchmarkConfig hotspot = config;
+    hotspot.cityRadiusKm = config.cityRadiusKm / 4.0;
+    for (size_t i = 0; i < config.surgeBookings; ++i) {
+        auto point = cityPoint(hotspot, rng);
+        surge->recordDemand(point.first, point.second);
+    }
+    std::vector<std::pair<double, double>> drivers;
+    for (size_t i = 0; i < config.surgeDrivers; ++i) {
+        drivers.push_back(cityPoint(config, rng));
+    }
+    surge->setSupply(drivers);
+    surge->recompute();
+    report.surgedZones = surge->getSnapshot()->zoneMultipliers.size();
+
+    FareCalculator calculator;
+    calculator.setSurgeEngine(surge);
+
+    std::vector<TripRequest> requests(config.quoteCount);
+    std::vector<std::shared_ptr<Location>> pickups, drops;
+    pickups.reserve(config.quoteCount);
+    drops.reserve(config.quoteCount);
+    for (size_t i = 0; i < config.quoteCount; ++i) {
+        auto pickup = cityPoint(config, rng);
+        auto drop = cityPoint(config, rng);
+        requests[i] = {pickup.first, pickup.second, drop.first, drop.second, VEHICLE_TYPES[i % 6]};
+        pickups.push_back(std::make_shared<Location>("P" + std::to_string(i), "", pickup.first, pickup.second,
+                                                     "", "", "", ""));
+        drops.push_back(std::make_shared<Location>("D" + std::to_string(i), "", drop.first, drop.second,
+                                                   "", "", "", ""));
+    }
+    std::vector<std::shared_ptr<Vehicle>> vehicles;
+    for (size_t t = 0; t < 6; ++t) {
+        vehicles.push_back(std::make_shared<Vehicle>("V" + std::to_string(t), "KA" + std::to_string(t), "Model",
+                                                     "Brand", 2020, VEHICLE_TYPES[t], 4, 50.0, 12.0));
+    }
+
+    size_t n = config.quoteCount;
+    double perQuote = 1e9 / (static_cast<double>(config.iterations) * n);
+    std::vector<FareQuote> batch(n), single(n);
+    std::vector<double> fares(n);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t k = 0; k < config.iterations; ++k) {
+        calculator.quoteFares(requests.data(), n, batch.data(), config.hour);
+    }
+    report.batchNsPerQuote = elapsedSeconds(start) * perQuote;
+
+    start = std::chrono::steady_clock::now();
+    for (size_t k = 0; k < config.iterations; ++k) {
+        for (size_t i = 0; i < n; ++i) {
+            single[i] = calculator.quoteFare(requests[i], config.hour);
+        }
+    }
+    report.singleNsPerQuote = elapsedSeconds(start) * perQuote;
+
+    start = std::chrono::steady_clock::now();
+    for (size_t k = 0; k < config.iterations; ++k) {
+        for (size_t i = 0; i < n; ++i) {
+            fares[i] = calculator.calculateFare(pickups[i], drops[i], vehicles[i % 6], config.hour);
+        }
+    }
+    report.calculateFareNsPerCall = elapsedSeconds(start) * perQuote;
+
+    for (size_t i = 0; i < n; ++i) {
+        double difference = std::max(relativeDifference(batch[i].totalFare, single[i].totalFare),
+                                     relativeDifference(batch[i].totalFare, fares[i]));
+        report.maxFareDifference = std::max(report.maxFareDifference, difference);
+        if (difference > FARE_TOLERANCE) {
+            report.mismatches++;
+        }
+    }
+    report.consistent = report.mismatches == 0;
+    report.wallSeconds = elapsedSeconds(wallStart);
+    return report;
+}
+
+void FareQuoteBenchmark::printReport(const std::string& label, const FareQuoteBenchmarkReport& report) {
+    std::cout << "=== " << label << " ===" << std::endl;
+    std::cout << "Quotes per batch: " << report.quoteCount << ", surged zones: " << report.surgedZones << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "quoteFares (batch): " << report.batchNsPerQuote << " ns/quote" << std::endl;
+    std::cout << "quoteFare (single): " << report.singleNsPerQuote << " ns/quote" << std::endl;
+    std::cout << "calculateFare: " << report.calculateFareNsPerCall << " ns/call" << std::endl;
+    std::cout << std::scientific << std::setprecision(1) << "Max relative fare difference: "
+              << report.maxFareDifference << std::fixed << std::setprecision(2) << ", mismatches: "
+              << report.mismatches << std::endl;
+    std::cout << "Consistent: " << (report.consistent ? "yes" : "NO") << std::endl;
+    std::cout << "Wall time: " << report.wallSeconds << " s" << std::endl;
+}
@@ -0,0 +1,405 @@
+#include "../include/GeoDistance.hpp"
+#include "../include/Location.hpp"
+#include <algorithm>
+#include <cmath>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define GEO_DISTANCE_X86 1
+#include <immintrin.h>
+#endif
+
+const double GeoDistance::EARTH_RADIUS_KM = 6371.0;
+
+namespace {
+    const double DEG_TO_RAD = M_PI / 180.0;
+    const double KM_PER_DEGREE = GeoDistance::EARTH_RADIUS_KM * DEG_TO_RAD;
+    const double SERIES_LIMIT = 0.1;      // Half-chord below which the asin series is exact to ~1e-12
+    const double PREFILTER_MARGIN = 1.005; // Slack for the flat-earth approximation
+
+    // Query point in kernel-ready form
+    struct Query {
+        double x, y, z;
+    };
+
+    Query toQuery(double lat, double lon) {
+        double latRad = lat * DEG_TO_RAD;
+        double lonRad = lon * DEG_TO_RAD;
+        return {std::cos(latRad) * std::cos(lonRad), std::cos(latRad) * std::sin(lonRad), std::sin(latRad)};
+    }
+
+    // asin(h) for small h; odd Taylor terms through h^9
+    inline double asinSeries(double h) {
+        double h2 = h * h;
+        return h * (1.0 + h2 * (1.0 / 6 + h2 * (3.0 / 40 + h2 * (15.0 / 336 + h2 * (105.0 / 3456)))));
+    }
+
+    inline double chordSquaredToKm(double c2) {
+        double h = std::sqrt(c2) * 0.5;
+        return 2.0 * GeoDistance::EARTH_RADIUS_KM * (h > SERIES_LIMIT ? std::asin(std::min(1.0, h)) : asinSeries(h));
+    }
+
+    inline double chordSquared(const Query& q, const double* x, const double* y, const double* z, size_t i) {
+        double dx = x[i] - q.x, dy = y[i] - q.y, dz = z[i] - q.z;
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    // Lower bound on distance in degrees^2 for the equirectangular prefilter
+    inline double boxDistanceSquared(double lat, double lon, double cosMin, double pointLat, double pointLon) {
+        double dLat = pointLat - lat;
+        double dLon = std::abs(pointLon - lon);
+        dLon = std::min(dLon, 360.0 - dLon) * cosMin;
+        return dLat * dLat + dLon * dLon;
+    }
+
+    using DistanceKernel = void (*)(const Query&, const double*, const double*, const double*, size_t, double*);
+    using RadiusKernel = size_t (*)(const Query&, double, const double*, const double*, const double*, size_t,
+                                    std::vector<std::uint32_t>&);
+    using PrefilterKernel = size_t (*)(double, double, double, double, const double*, const double*, size_t,
+                                       std::vector<std::uint32_t>&);
+
+    void distancesScalar(const Query& q, const double* x, const double* y, const double* z, size_t n, double* out) {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = chordSquaredToKm(chordSquared(q, x, y, z, i));
+        }
+    }
+
+    size_t radiusScalar(const Query& q, double maxChordSquared, const double* x, const double* y, const double* z,
+                        size_t n, std::vector<std::uint32_t>& indexes) {
+        size_t found = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (chordSquared(q, x, y, z, i) <= maxChordSquared) {
+                indexes.push_back(static_cast<std::uint32_t>(i));
+                found++;
+            }
+        }
+        return found;
+    }
+
+    size_t prefilterScalar(double lat, double lon, double cosMin, double maxDegSquared, const double* lats,
+                           const double* lons, size_t n, std::vector<std::uint32_t>& candidates) {
+        size_t found = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (boxDistanceSquared(lat, lon, cosMin, lats[i], lons[i]) <= maxDegSquared) {
+                candidates.push_back(static_cast<std::uint32_t>(i));
+                found++;
+            }
+        }
+        return found;
+    }
+
+#ifdef GEO_DISTANCE_X86
+    __attribute__((target("sse2")))
+    void distancesSse2(const Query& q, const double* x, const double* y, const double* z, size_t n, double* out) {
+        const __m128d qx = _mm_set1_pd(q.x), qy = _mm_set1_pd(q.y), qz = _mm_set1_pd(q.z);
+        const __m128d half = _mm_set1_pd(0.5), one = _mm_set1_pd(1.0), scale = _mm_set1_pd(2.0 * GeoDistance::EARTH_RADIUS_KM);
+        const __m128d c3 = _mm_set1_pd(1.0 / 6), c5 = _mm_set1_pd(3.0 / 40), c7 = _mm_set1_pd(15.0 / 336),
+                      c9 = _mm_set1_pd(105.0 / 3456), limit = _mm_set1_pd(SERIES_LIMIT);
+
+        size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128d dx = _mm_sub_pd(_mm_loadu_pd(x + i), qx);
+            __m128d dy = _mm_sub_pd(_mm_loadu_pd(y + i), qy);
+            __m128d dz = _mm_sub_pd(_mm_loadu_pd(z + i), qz);
+            __m128d c2 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy)), _mm_mul_pd(dz, dz));
+            __m128d h = _mm_mul_pd(_mm_sqrt_pd(c2), half);
+            __m128d h2 = _mm_mul_pd(h, h);
+            __m128d poly = _mm_add_pd(c7, _mm_mul_pd(h2, c9));
+            poly = _mm_add_pd(c5, _mm_mul_pd(h2, poly));
+            poly = _mm_add_pd(c3, _mm_mul_pd(h2, poly));
+            poly = _mm_add_pd(one, _mm_mul_pd(h2, poly));
+            _mm_storeu_pd(out + i, _mm_mul_pd(scale, _mm_mul_pd(h, poly)));
+
+            int far = _mm_movemask_pd(_mm_cmpgt_pd(h, limit));
+            for (int lane = 0; far; ++lane, far >>= 1) {
+                if (far & 1) out[i + lane] = chordSquaredToKm(chordSquared(q, x, y, z, i + lane));
+            }
+        }
+        distancesScalar(q, x + i, y + i, z + i, n - i, out + i);
+    }
+
+    __attribute__((target("avx2")))
+    void distancesAvx2(const Query& q, const double* x, const double* y, const double* z, size_t n, double* out) {
+        const __m256d qx = _mm256_set1_pd(q.x), qy = _mm256_set1_pd(q.y), qz = _mm256_set1_pd(q.z);
+        const __m256d half = _mm256_set1_pd(0.5), one = _mm256_set1_pd(1.0), scale = _mm256_set1_pd(2.0 * GeoDistance::EARTH_RADIUS_KM);
+        const __m256d c3 = _mm256_set1_pd(1.0 / 6), c5 = _mm256_set1_pd(3.0 / 40), c7 = _mm256_set1_pd(15.0 / 336),
+                      c9 = _mm256_set1_pd(105.0 / 3456), limit = _mm256_set1_pd(SERIES_LIMIT);
+
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d dx = _mm256_sub_pd(_mm256_loadu_pd(x + i), qx);
+            __m256d dy = _mm256_sub_pd(_mm256_loadu_pd(y + i), qy);
+            __m256d dz = _mm256_sub_pd(_mm256_loadu_pd(z + i), qz);
+            __m256d c2 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)), _mm256_mul_pd(dz, dz));
+            __m256d h = _mm256_mul_pd(_mm256_sqrt_pd(c2), half);
+            __m256d h2 = _mm256_mul_pd(h, h);
+            __m256d poly = _mm256_add_pd(c7, _mm256_mul_pd(h2, c9));
+            poly = _mm256_add_pd(c5, _mm256_mul_pd(h2, poly));
+            poly = _mm256_add_pd(c3, _mm256_mul_pd(h2, poly));
+            poly = _mm256_add_pd(one, _mm256_mul_pd(h2, poly));
+            _mm256_storeu_pd(out + i, _mm256_mul_pd(scale, _mm256_mul_pd(h, poly)));
+
+            int far = _mm256_movemask_pd(_mm256_cmp_pd(h, limit, _CMP_GT_OQ));
+            for (int lane = 0; far; ++lane, far >>= 1) {
+                if (far & 1) out[i + lane] = chordSquaredToKm(chordSquared(q, x, y, z, i + lane));
+            }
+        }
+        distancesScalar(q, x + i, y + i, z + i, n - i, out + i);
+    }
+
+    __attribute__((target("sse2")))
+    size_t radiusSse2(const Query& q, double maxChordSquared, const double* x, const double* y, const double* z,
+                      size_t n, std::vector<std::uint32_t>& indexes) {
+        const __m128d qx = _mm_set1_pd(q.x), qy = _mm_set1_pd(q.y), qz = _mm_set1_pd(q.z);
+        const __m128d threshold = _mm_set1_pd(maxChordSquared);
+        size_t found = 0, i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128d dx = _mm_sub_pd(_mm_loadu_pd(x + i), qx);
+            __m128d dy = _mm_sub_pd(_mm_loadu_pd(y + i), qy);
+            __m128d dz = _mm_sub_pd(_mm_loadu_pd(z + i), qz);
+            __m128d c2 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy)), _mm_mul_pd(dz, dz));
+            int hits = _mm_movemask_pd(_mm_cmple_pd(c2, threshold));
+            for (int lane = 0; hits; ++lane, hits >>= 1) {
+                if (hits & 1) { indexes.push_back(static_cast<std::uint32_t>(i + lane)); found++; }
+            }
+        }
+        for (; i < n; ++i) {
+            if (chordSquared(q, x, y, z, i) <= maxChordSquared) { indexes.push_back(static_cast<std::uint32_t>(i)); found++; }
+        }
+        return found;
+    }
+
+    __attribute__((target("avx2")))
+    size_t radiusAvx2(const Query& q, double maxChordSquared, const double* x, const double* y, const double* z,
+                      size_t n, std::vector<std::uint32_t>& indexes) {
+        const __m256d qx = _mm256_set1_pd(q.x), qy = _mm256_set1_pd(q.y), qz = _mm256_set1_pd(q.z);
+        const __m256d threshold = _mm256_set1_pd(maxChordSquared);
+        size_t found = 0, i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d dx = _mm256_sub_pd(_mm256_loadu_pd(x + i), qx);
+            __m256d dy = _mm256_sub_pd(_mm256_loadu_pd(y + i), qy);
+            __m256d dz = _mm256_sub_pd(_mm256_loadu_pd(z + i), qz);
+            __m256d c2 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)), _mm256_mul_pd(dz, dz));
+            int hits = _mm256_movemask_pd(_mm256_cmp_pd(c2, threshold, _CMP_LE_OQ));
+            for (int lane = 0; hits; ++lane, hits >>= 1) {
+                if (hits & 1) { indexes.push_back(static_cast<std::uint32_t>(i + lane)); found++; }
+            }
+        }
+        for (; i < n; ++i) {
+            if (chordSquared(q, x, y, z, i) <= maxChordSquared) { indexes.push_back(static_cast<std::uint32_t>(i)); found++; }
+        }
+        return found;
+    }
+
+    __attribute__((target("avx2")))
+    size_t prefilterAvx2(double lat, double lon, double cosMin, double maxDegSquared, const double* lats,
+                         const double* lons, size_t n, std::vector<std::uint32_t>& candidates) {
+        const __m256d qLat = _mm256_set1_pd(lat), qLon = _mm256_set1_pd(lon), cosV = _mm256_set1_pd(cosMin);
+        const __m256d full = _mm256_set1_pd(360.0), threshold = _mm256_set1_pd(maxDegSquared);
+        const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+        size_t found = 0, i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d dLat = _mm256_sub_pd(_mm256_loadu_pd(lats + i), qLat);
+            __m256d dLon = _mm256_and_pd(_mm256_sub_pd(_mm256_loadu_pd(lons + i), qLon), absMask);
+            dLon = _mm256_mul_pd(_mm256_min_pd(dLon, _mm256_sub_pd(full, dLon)), cosV);
+            __m256d d2 = _mm256_add_pd(_mm256_mul_pd(dLat, dLat), _mm256_mul_pd(dLon, dLon));
+            int hits = _mm256_movemask_pd(_mm256_cmp_pd(d2, threshold, _CMP_LE_OQ));
+            for (int lane = 0; hits; ++lane, hits >>= 1) {
+                if (hits & 1) { candidates.push_back(static_cast<std::uint32_t>(i + lane)); found++; }
+            }
+        }
+        for (; i < n; ++i) {
+            if (boxDistanceSquared(lat, lon, cosMin, lats[i], lons[i]) <= maxDegSquared) {
+                candidates.push_back(static_cast<std::uint32_t>(i));
+                found++;
+            }
+        }
+        return found;
+    }
+#endif
+
+    struct KernelSet {
+        DistanceKernel distances;
+        RadiusKernel radius;
+        PrefilterKernel prefilter;
+        const char* name;
+    };
+
+    const KernelSet SCALAR_KERNELS = {distancesScalar, radiusScalar, prefilterScalar, "scalar"};
+#ifdef GEO_DISTANCE_X86
+    const KernelSet SSE2_KERNELS = {distancesSse2, radiusSse2, prefilterScalar, "sse2"};
+    const KernelSet AVX2_KERNELS = {distancesAvx2, radiusAvx2, prefilterAvx2, "avx2"};
+#endif
+
+    bool supports(GeoKernel kernel) {
+#ifdef GEO_DISTANCE_X86
+        __builtin_cpu_init();
+        if (kernel == GeoKernel::AVX2) return __builtin_cpu_supports("avx2");
+        if (kernel == GeoKernel::SSE2) return __builtin_cpu_supports("sse2");
+#endif
+        return kernel == GeoKernel::SCALAR || kernel == GeoKernel::AUTO;
+    }
+
+    const KernelSet& selectKernels() {
+#ifdef GEO_DISTANCE_X86
+        if (supports(GeoKernel::AVX2)) {
+            return AVX2_KERNELS;
+        }
+        if (supports(GeoKernel::SSE2)) {
+            return SSE2_KERNELS;
+        }
+#endif
+        return SCALAR_KERNELS;
+    }
+
+    const KernelSet& kernels() {
+        static const KernelSet& selected = selectKernels();
+        return selected;
+    }
+
+    const KernelSet& kernels(GeoKernel kernel) {
+        if (kernel == GeoKernel::AUTO) {
+            return kernels();
+        }
+#ifdef GEO_DISTANCE_X86
+        if (kernel == GeoKernel::AVX2 && supports(kernel)) {
+            return AVX2_KERNELS;
+        }
+        if (kernel == GeoKernel::SSE2 && supports(kernel)) {
+            return SSE2_KERNELS;
+        }
+#endif
+        return SCALAR_KERNELS;
+    }
+}
+
+void GeoBatch::reserve(size_t count) {
+    latitudes.reserve(count);
+    longitudes.reserve(count);
+    x.reserve(count);
+    y.reserve(count);
+    z.reserve(count);
+}
+
+void GeoBatch::push_back(double lat, double lon) {
+    Query unit = toQuery(lat, lon);
+    latitudes.push_back(lat);
+    longitudes.push_back(lon);
+    x.push_back(unit.x);
+    y.push_back(unit.y);
+    z.push_back(unit.z);
+}
+
+void GeoBatch::set(size_t index, double lat, double lon) {
+    Query unit = toQuery(lat, lon);
+    latitudes[index] = lat;
+    longitudes[index] = lon;
+    x[index] = unit.x;
+    y[index] = unit.y;
+    z[index] = unit.z;
+}
+
+void GeoBatch::swapRemove(size_t index) {
+    size_t last = latitudes.size() - 1;
+    if (index != last) {
+        latitudes[index] = latitudes[last];
+        longitudes[index] = longitudes[last];
+        x[index] = x[last];
+        y[index] = y[last];
+        z[index] = z[last];
+    }
+    latitudes.pop_back();
+    longitudes.pop_back();
+    x.pop_back();
+    y.pop_back();
+    z.pop_back();
+}
+
+void GeoBatch::clear() {
+    latitudes.clear();
+    longitudes.clear();
+    x.clear();
+    y.clear();
+    z.clear();
+}
+
+void GeoDistance::distancesKm(double lat, double lon, const GeoBatch& points, double* out) {
+    distancesKm(GeoKernel::AUTO, lat, lon, points, out);
+}
+
+void GeoDistance::distancesKm(GeoKernel kernel, double lat, double lon, const GeoBatch& points, double* out) {
+    kernels(kernel).distances(toQuery(lat, lon), points.xData(), points.yData(), points.zData(), points.size(), out);
+}
+
+std::vector<double> GeoDistance::distancesKm(double lat, double lon, const GeoBatch& points) {
+    std::vector<double> out(points.size());
+    distancesKm(lat, lon, points, out.data());
+    return out;
+}
+
+size_t GeoDistance::withinRadius(double lat, double lon, double radiusKm, const GeoBatch& points,
+                                 std::vector<std::uint32_t>& indexes) {
+    return withinRadius(GeoKernel::AUTO, lat, lon, radiusKm, points, indexes);
+}
+
+size_t GeoDistance::withinRadius(GeoKernel kernel, double lat, double lon, double radiusKm, const GeoBatch& points,
+                                 std::vector<std::uint32_t>& indexes) {
+    if (radiusKm < 0) {
+        return 0;
+    }
+
+    // Chord length is monotonic in arc length, so compare squared chords directly
+    double halfAngle = std::min(M_PI / 2, radiusKm / (2.0 * EARTH_RADIUS_KM));
+    double maxChord = 2.0 * std::sin(halfAngle);
+    return kernels(kernel).radius(toQuery(lat, lon), maxChord * maxChord, points.xData(), points.yData(),
+                                  points.zData(), points.size(), indexes);
+}
+
+size_t GeoDistance::withinRadius(double lat, double lon, double radiusKm, const double* latitudes,
+                                 const double* longitudes, size_t count, std::vector<std::uint32_t>& indexes) {
+    return withinRadius(GeoKernel::AUTO, lat, lon, radiusKm, latitudes, longitudes, count, indexes);
+}
+
+size_t GeoDistance::withinRadius(GeoKernel kernel, double lat, double lon, double radiusKm, const double* latitudes,
+                                 const double* longitudes, size_t count, std::vector<std::uint32_t>& indexes) {
+    if (radiusKm < 0) {
+        return 0;
+    }
+
+    // Longitude degrees are shortest at the poleward edge of the search band
+    double spanDegrees = radiusKm * PREFILTER_MARGIN / KM_PER_DEGREE;
+    double poleward = std::min(90.0, std::abs(lat) + spanDegrees);
+    double cosMin = std::cos(poleward * DEG_TO_RAD);
+
+    size_t start = indexes.size();
+    kernels(kernel).prefilter(lat, lon, cosMin, spanDegrees * spanDegrees, latitudes, longitudes, count, indexes);
+
+    // Confirm survivors exactly, compacting in place
+    size_t kept = start;
+    for (size_t i = start; i < indexes.size(); ++i) {
+        std::uint32_t index = indexes[i];
+        if (Location::haversineDistance(lat, lon, latitudes[index], longitudes[index]) <= radiusKm) {
+            indexes[kept++] = index;
+        }
+    }
+    indexes.resize(kept);
+    return kept - start;
+}
+
+double GeoDistance::equirectangularKm(double lat1, double lon1, double lat2, double lon2) {
+    double dLon = std::abs(lon2 - lon1);
+    dLon = std::min(dLon, 360.0 - dLon) * std::cos((lat1 + lat2) * 0.5 * DEG_TO_RAD);
+    double dLat = lat2 - lat1;
+    return KM_PER_DEGREE * std::sqrt(dLat * dLat + dLon * dLon);
+}
+
+bool GeoDistance::isKernelAvailable(GeoKernel kernel) {
+    return supports(kernel);
+}
+
+const char* GeoDistance::getKernelName() {
+    return kernels().name;
+}
+
+const char* GeoDistance::getKernelName(GeoKernel kernel) {
+    return kernels(kernel).name;
+}
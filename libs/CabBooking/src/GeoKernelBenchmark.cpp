@@ -0,0 +1,281 @@
+#include "../include/GeoKernelBenchmark.hpp"
+#include "../include/Location.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <random>
+
+const double GeoKernelBenchmark::ANTIPODAL_BAND_KM = 10.0;
+const double GeoKernelBenchmark::DISTANCE_TOLERANCE_KM = 1e-6;
+const double GeoKernelBenchmark::ANTIPODAL_TOLERANCE_KM = 1e-3;
+const double GeoKernelBenchmark::KERNEL_TOLERANCE_KM = 1e-9;
+
+namespace {
+    const double KM_PER_DEGREE = GeoDistance::EARTH_RADIUS_KM * M_PI / 180.0;
+    const double CHECK_RADII_KM[] = {0.5, 5.0, 40.0, 3000.0};
+
+    double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    double wrapLongitude(double lon) {
+        if (lon > 180.0) return lon - 360.0;
+        if (lon < -180.0) return lon + 360.0;
+        return lon;
+    }
+
+    bool isNearAntipode(double referenceKm) {
+        return referenceKm > M_PI * GeoDistance::EARTH_RADIUS_KM - GeoKernelBenchmark::ANTIPODAL_BAND_KM;
+    }
+
+    double toleranceFor(double referenceKm) {
+        return isNearAntipode(referenceKm) ? GeoKernelBenchmark::ANTIPODAL_TOLERANCE_KM
+                                           : GeoKernelBenchmark::DISTANCE_TOLERANCE_KM;
+    }
+
+    struct Points {
+        GeoBatch batch;
+        std::vector<double> latitudes;
+        std::vector<double> longitudes;
+
+        void add(double lat, double lon) {
+            batch.push_back(lat, lon);
+            latitudes.push_back(lat);
+            longitudes.push_back(lon);
+        }
+    };
+
+    // Points that disagree with brute force, ignoring ties within tolerance of the radius
+    std::uint64_t radiusMismatches(double lat, double lon, double radiusKm, const Points& points,
+                                   const std::vector<std::uint32_t>& found) {
+        std::vector<bool> inside(points.latitudes.size(), false);
+        for (std::uint32_t index : found) {
+            inside[index] = true;
+        }
+        std::uint64_t mismatches = 0;
+        for (size_t i = 0; i < inside.size(); ++i) {
+            double reference = Location::haversineDistance(lat, lon, points.latitudes[i], points.longitudes[i]);
+            if (inside[i] != (reference <= radiusKm) && std::abs(reference - radiusKm) > toleranceFor(reference)) {
+                mismatches++;
+            }
+        }
+        return mismatches;
+    }
+
+    // Distances plus radius results of one kernel against the scalar kernel and brute force
+    void compare(GeoKernel kernel, double lat, double lon, const Points& points, double radiusKm,
+                 GeoKernelResult& result, GeoKernelReport& report) {
+        size_t n = points.latitudes.size();
+        std::vector<double> distances(n), scalar(n);
+        GeoDistance::distancesKm(kernel, lat, lon, points.batch, distances.data());
+        GeoDistance::distancesKm(GeoKernel::SCALAR, lat, lon, points.batch, scalar.data());
+
+        for (size_t i = 0; i < n; ++i) {
+            double reference = Location::haversineDistance(lat, lon, points.latitudes[i], points.longitudes[i]);
+            double error = std::abs(distances[i] - reference);
+            double difference = std::abs(distances[i] - scalar[i]);
+            double& maxError = isNearAntipode(reference) ? result.maxAntipodalErrorKm : result.maxErrorKm;
+            maxError = std::max(maxError, error);
+            result.maxScalarDifferenceKm = std::max(result.maxScalarDifferenceKm, difference);
+            if (error > toleranceFor(reference) || difference > GeoKernelBenchmark::KERNEL_TOLERANCE_KM) {
+                result.distanceFailures++;
+            }
+        }
+        report.distancesChecked += n;
+
+        std::vector<std::uint32_t> cached, arrays, scalarCached;
+        GeoDistance::withinRadius(kernel, lat, lon, radiusKm, points.batch, cached);
+        GeoDistance::withinRadius(GeoKernel::SCALAR, lat, lon, radiusKm, points.batch, scalarCached);
+        GeoDistance::withinRadius(kernel, lat, lon, radiusKm, points.latitudes.data(), points.longitudes.data(),
+                                  n, arrays);
+        result.radiusMismatches += radiusMismatches(lat, lon, radiusKm, points, cached) +
+                                   radiusMismatches(lat, lon, radiusKm, points, arrays);
+        if (cached != scalarCached) {
+            result.radiusMismatches++;
+        }
+    }
+}
+
+GeoKernelBenchmark::GeoKernelBenchmark(const GeoKernelBenchmarkConfig& config) : config(config) {
+    this->config.benchmarkIterations = std::max<size_t>(1, config.benchmarkIterations);
+}
+
+void GeoKernelBenchmark::checkRandom(GeoKernel kernel, GeoKernelResult& result, GeoKernelReport& report) const {
+    std::mt19937 rng(config.seed);
+    std::uniform_real_distribution<double> anyLat(-90.0, 90.0), anyLon(-180.0, 180.0), nearby(-0.3, 0.3);
+
+    for (size_t q = 0; q < config.accuracyQueries; ++q) {
+        double lat = anyLat(rng), lon = anyLon(rng);
+        Points points;
+        for (size_t i = 0; i < config.accuracyPoints; ++i) {
+            if (i % 2) {
+                points.add(std::max(-90.0, std::min(90.0, lat + nearby(rng))), wrapLongitude(lon + nearby(rng)));
+            } else {
+                points.add(anyLat(rng), anyLon(rng));
+            }
+        }
+        for (double radiusKm : CHECK_RADII_KM) {
+            compare(kernel, lat, lon, points, radiusKm, result, report);
+        }
+    }
+}
+
+void GeoKernelBenchmark::checkEdgeCases(GeoKernel kernel, GeoKernelResult& result, GeoKernelReport& report) const {
+    const double queries[][2] = {
+        {90.0, 0.0}, {-90.0, 0.0}, {90.0, 123.0}, {0.0, 180.0}, {0.0, -180.0},
+        {10.0, 179.9999}, {-45.0, -179.9999}, {0.0, 0.0}, {12.9716, 77.5946}, {89.9999, -60.0}
+    };
+
+    for (const auto& query : queries) {
+        double lat = query[0], lon = query[1];
+        const double edges[][2] = {
+            {lat, lon},                                              // Identical
+            {90.0, 0.0}, {-90.0, 0.0}, {90.0, lon},                  // Poles
+            {lat, 180.0}, {lat, -180.0}, {lat, 179.99999}, {lat, -179.99999}, // Antimeridian
+            {-lat, wrapLongitude(lon + 180.0)},                      // Antipode
+            {lat, wrapLongitude(lon + 1e-7)},                        // About a centimetre
+            {std::min(90.0, lat + 1e-5), lon},                       // About a metre
+            {std::max(-90.0, lat - 0.01), wrapLongitude(lon - 0.01)},
+            {-lat, lon}, {0.0, wrapLongitude(lon + 90.0)}
+        };
+
+        // Grow the batch one point at a time so every tail length is exercised
+        Points points;
+        for (const auto& edge : edges) {
+            points.add(edge[0], edge[1]);
+            for (double radiusKm : CHECK_RADII_KM) {
+                compare(kernel, lat, lon, points, radiusKm, result, report);
+            }
+        }
+
+        double identical = 0.0;
+        GeoBatch self;
+        self.push_back(lat, lon);
+        GeoDistance::distancesKm(kernel, lat, lon, self, &identical);
+        if (identical != 0.0) {
+            result.distanceFailures++;
+        }
+    }
+}
+
+void GeoKernelBenchmark::benchmark(GeoKernel kernel, GeoKernelResult& result) const {
+    std::mt19937 rng(config.seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    Points points;
+    points.batch.reserve(config.benchmarkPoints);
+    double lonScale = 1.0 / std::cos(config.centerLatitude * M_PI / 180.0);
+    for (size_t i = 0; i < config.benchmarkPoints; ++i) {
+        double distance = config.cityRadiusKm * std::sqrt(unit(rng)) / KM_PER_DEGREE;
+        double bearing = 2.0 * M_PI * unit(rng);
+        points.add(config.centerLatitude + distance * std::cos(bearing),
+                   config.centerLongitude + distance * std::sin(bearing) * lonScale);
+    }
+
+    size_t n = config.benchmarkPoints;
+    size_t iterations = config.benchmarkIterations;
+    double perPoint = 1e9 / (static_cast<double>(iterations) * std::max<size_t>(1, n));
+    std::vector<double> out(n);
+    std::vector<std::uint32_t> indexes;
+    double sink = 0.0;
+
+    // Nudge the query each iteration so nothing can be hoisted out of the loop
+    auto start = std::chrono::steady_clock::now();
+    for (size_t k = 0; k < iterations; ++k) {
+        GeoDistance::distancesKm(kernel, config.centerLatitude, config.centerLongitude + k * 1e-5, points.batch, out.data());
+        sink += out[k % std::max<size_t>(1, n)];
+    }
+    result.distanceNsPerPoint = elapsedSeconds(start) * perPoint;
+
+    start = std::chrono::steady_clock::now();
+    for (size_t k = 0; k < iterations; ++k) {
+        indexes.clear();
+        GeoDistance::withinRadius(kernel, config.centerLatitude, config.centerLongitude + k * 1e-5, config.radiusKm,
+                                  points.batch, indexes);
+        sink += indexes.size();
+    }
+    result.radiusNsPerPoint = elapsedSeconds(start) * perPoint;
+
+    start = std::chrono::steady_clock::now();
+    for (size_t k = 0; k < iterations; ++k) {
+        indexes.clear();
+        GeoDistance::withinRadius(kernel, config.centerLatitude, config.centerLongitude + k * 1e-5, config.radiusKm,
+                                  points.latitudes.data(), points.longitudes.data(), n, indexes);
+        sink += indexes.size();
+    }
+    result.prefilterNsPerPoint = elapsedSeconds(start) * perPoint;
+
+    volatile double keep = sink;
+    (void)keep;
+}
+
+double GeoKernelBenchmark::benchmarkHaversine() const {
+    std::mt19937 rng(config.seed);
+    std::uniform_real_distribution<double> offset(-1.0, 1.0);
+    double span = config.cityRadiusKm / KM_PER_DEGREE;
+    std::vector<double> latitudes(config.benchmarkPoints), longitudes(config.benchmarkPoints);
+    for (size_t i = 0; i < config.benchmarkPoints; ++i) {
+        latitudes[i] = config.centerLatitude + span * offset(rng);
+        longitudes[i] = config.centerLongitude + span * offset(rng);
+    }
+
+    std::vector<double> out(config.benchmarkPoints);
+    double sink = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t k = 0; k < config.benchmarkIterations; ++k) {
+        double lon = config.centerLongitude + k * 1e-5;
+        for (size_t i = 0; i < config.benchmarkPoints; ++i) {
+            out[i] = Location::haversineDistance(config.centerLatitude, lon, latitudes[i], longitudes[i]);
+        }
+        sink += out.empty() ? 0.0 : out[k % out.size()];
+    }
+    double seconds = elapsedSeconds(start);
+    volatile double keep = sink;
+    (void)keep;
+    return seconds * 1e9 / (static_cast<double>(config.benchmarkIterations) * std::max<size_t>(1, config.benchmarkPoints));
+}
+
+GeoKernelReport GeoKernelBenchmark::run() {
+    auto wallStart = std::chrono::steady_clock::now();
+    GeoKernelReport report;
+    report.defaultKernel = GeoDistance::getKernelName();
+
+    for (GeoKernel kernel : {GeoKernel::SCALAR, GeoKernel::SSE2, GeoKernel::AVX2}) {
+        if (!GeoDistance::isKernelAvailable(kernel)) {
+            continue;
+        }
+        GeoKernelResult result;
+        result.kernel = GeoDistance::getKernelName(kernel);
+        checkRandom(kernel, result, report);
+        checkEdgeCases(kernel, result, report);
+        benchmark(kernel, result);
+        if (result.distanceFailures > 0 || result.radiusMismatches > 0) {
+            report.accurate = false;
+        }
+        report.kernels.push_back(result);
+    }
+
+    report.haversineNsPerPoint = benchmarkHaversine();
+    report.wallSeconds = elapsedSeconds(wallStart);
+    return report;
+}
+
+void GeoKernelBenchmark::printReport(const std::string& label, const GeoKernelReport& report) {
+    std::cout << "=== " << label << " ===" << std::endl;
+    std::cout << "Default kernel: " << report.defaultKernel << ", distances checked: " << report.distancesChecked << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Scalar Location::haversineDistance: " << report.haversineNsPerPoint << " ns/point" << std::endl;
+    for (const auto& result : report.kernels) {
+        std::cout << std::setw(7) << result.kernel << ": distancesKm " << result.distanceNsPerPoint
+                  << " ns, withinRadius " << result.radiusNsPerPoint << " ns, lat/lon withinRadius "
+                  << result.prefilterNsPerPoint << " ns per point" << std::endl;
+        std::cout << std::scientific << std::setprecision(1)
+                  << "         max error " << result.maxErrorKm << " km (" << result.maxAntipodalErrorKm
+                  << " km near the antipode), vs scalar " << result.maxScalarDifferenceKm
+                  << " km, distance failures " << result.distanceFailures << ", radius mismatches "
+                  << result.radiusMismatches << std::fixed << std::setprecision(2) << std::endl;
+    }
+    std::cout << "Accurate: " << (report.accurate ? "yes" : "NO") << std::endl;
+    std::cout << "Wall time: " << report.wallSeconds << " s" << std::endl;
+}
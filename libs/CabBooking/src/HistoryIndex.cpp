@@ -0,0 +1,61 @@
+#include "../include/HistoryIndex.hpp"
+#include <algorithm>
+#include <iterator>
+
+void HistoryIndex::append(const std::string& owner, const std::string& id) {
+    if (owner.empty()) {
+        return;
+    }
+    entries[owner].push_back(id);
+    totalEntries++;
+}
+
+bool HistoryIndex::remove(const std::string& owner, const std::string& id) {
+    auto it = entries.find(owner);
+    if (it == entries.end()) {
+        return false;
+    }
+
+    auto& ids = it->second;
+    auto found = std::find(ids.rbegin(), ids.rend(), id);
+    if (found == ids.rend()) {
+        return false;
+    }
+    ids.erase(std::next(found).base());
+    totalEntries--;
+    if (ids.empty()) {
+        entries.erase(it);
+    }
+    return true;
+}
+
+void HistoryIndex::clear() {
+    entries.clear();
+    totalEntries = 0;
+}
+
+const std::vector<std::string>* HistoryIndex::find(const std::string& owner) const {
+    auto it = entries.find(owner);
+    return it != entries.end() ? &it->second : nullptr;
+}
+
+size_t HistoryIndex::count(const std::string& owner) const {
+    auto ids = find(owner);
+    return ids ? ids->size() : 0;
+}
+
+std::vector<std::string> HistoryIndex::page(const std::string& owner, size_t offset, size_t limit) const {
+    std::vector<std::string> result;
+    auto ids = find(owner);
+    if (!ids || offset >= ids->size()) {
+        return result;
+    }
+
+    size_t available = ids->size() - offset;
+    size_t take = std::min(limit, available);
+    result.reserve(take);
+    for (size_t i = 0; i < take; ++i) {
+        result.push_back((*ids)[available - 1 - i]);
+    }
+    return result;
+}
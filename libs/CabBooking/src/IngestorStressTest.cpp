@@ -0,0 +1,130 @@
+#include "../include/IngestorStressTest.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <thread>
+
+namespace {
+    const std::int64_t NO_PING = std::numeric_limits<std::int64_t>::min();
+
+    double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+IngestorStressTest::IngestorStressTest(const IngestorStressConfig& config) : config(config) {
+    this->config.writerThreads = std::max<size_t>(1, config.writerThreads);
+    this->config.sources = std::max<size_t>(1, config.sources);
+}
+
+void IngestorStressTest::positionFor(std::uint32_t source, std::int64_t timestampMs, double& lat, double& lon) {
+    std::uint64_t hash = (source + 1) * 0x9E3779B97F4A7C15ull ^ static_cast<std::uint64_t>(timestampMs) * 0xBF58476D1CE4E5B9ull;
+    hash ^= hash >> 31;
+    // Whole multiples of 1e-4 degrees survive the ingestor's fixed-point packing exactly
+    lat = static_cast<double>(hash % 1800001) / 1e4 - 90.0;
+    lon = static_cast<double>((hash >> 21) % 3600001) / 1e4 - 180.0;
+}
+
+IngestorStressReport IngestorStressTest::run() {
+    auto wallStart = std::chrono::steady_clock::now();
+    IngestorStressReport report;
+
+    LocationIngestor ingestor(4, 1 << 10);
+    for (size_t i = 0; i < config.sources; ++i) {
+        ingestor.registerSource("D" + std::to_string(i));
+    }
+
+    // Timestamps come from one shared clock, so writers racing on a slot carry
+    // close but distinct timestamps, and the newer one must win with its own position
+    std::atomic<std::int64_t> clock(0);
+    std::vector<std::vector<std::int64_t>> newestSent(config.writerThreads,
+                                                      std::vector<std::int64_t>(config.sources, NO_PING));
+    std::atomic<size_t> running(config.writerThreads);
+    std::atomic<bool> go(false);
+
+    std::vector<std::int64_t> lastApplied(config.sources, NO_PING);
+    auto check = [&](const std::string& sourceId, double lat, double lon, std::int64_t timestampMs) {
+        std::uint32_t source = ingestor.findSource(sourceId);
+        double expectedLat, expectedLon;
+        positionFor(source, timestampMs, expectedLat, expectedLon);
+        if (LocationIngestor::packPosition(lat, lon) != LocationIngestor::packPosition(expectedLat, expectedLon)) {
+            report.mismatchedPairs++;
+        }
+        if (timestampMs < lastApplied[source]) {
+            report.timestampRegressions++;
+        }
+        lastApplied[source] = timestampMs;
+        report.updatesApplied++;
+    };
+
+    std::vector<std::thread> writers;
+    for (size_t t = 0; t < config.writerThreads; ++t) {
+        writers.emplace_back([&, t]() {
+            std::mt19937 rng(config.seed + static_cast<unsigned>(t) * 7919u);
+            std::uniform_real_distribution<double> unit(0.0, 1.0);
+            std::vector<std::int64_t>& newest = newestSent[t];
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+
+            for (size_t i = 0; i < config.pingsPerWriter; ++i) {
+                auto source = static_cast<std::uint32_t>(rng() % config.sources);
+                std::int64_t timestampMs = clock.fetch_add(1, std::memory_order_relaxed);
+                if (unit(rng) < config.reorderedShare) {
+                    timestampMs -= 1 + static_cast<std::int64_t>(rng() % 64);
+                }
+                double lat, lon;
+                positionFor(source, timestampMs, lat, lon);
+                ingestor.submit(source, lat, lon, timestampMs);
+                newest[source] = std::max(newest[source], timestampMs);
+            }
+            running.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    auto rushStart = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    while (running.load(std::memory_order_acquire) > 0) {
+        ingestor.drain(check);
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    double rushSeconds = elapsedSeconds(rushStart);
+    ingestor.drain(check);
+
+    for (size_t source = 0; source < config.sources; ++source) {
+        std::int64_t newest = NO_PING;
+        for (const auto& sent : newestSent) {
+            newest = std::max(newest, sent[source]);
+        }
+        if (lastApplied[source] != newest) {
+            report.finalMismatches++;
+        }
+    }
+
+    report.pingsSent = config.writerThreads * config.pingsPerWriter;
+    report.pingsStale = ingestor.getStaleCount();
+    report.consistent = report.mismatchedPairs == 0 && report.timestampRegressions == 0 && report.finalMismatches == 0;
+    if (rushSeconds > 0) {
+        report.pingsPerSecond = report.pingsSent / rushSeconds;
+    }
+    report.wallSeconds = elapsedSeconds(wallStart);
+    return report;
+}
+
+void IngestorStressTest::printReport(const std::string& label, const IngestorStressReport& report) {
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "=== " << label << " ===" << std::endl;
+    std::cout << "Pings: " << report.pingsSent << " sent, " << report.pingsStale << " stale, "
+              << report.updatesApplied << " updates applied" << std::endl;
+    std::cout << "Mismatched pairs: " << report.mismatchedPairs << ", timestamp regressions: "
+              << report.timestampRegressions << ", wrong final position: " << report.finalMismatches << std::endl;
+    std::cout << "Throughput: " << report.pingsPerSecond << " pings/sec" << std::endl;
+    std::cout << "Consistent: " << (report.consistent ? "yes" : "NO") << std::endl;
+    std::cout << "Wall time: " << report.wallSeconds << " s" << std::endl;
+}
@@ -69,13 +69,21 @@ void Location::setPostalCode(const std::string& postalCode) {
 }
 
 double Location::calculateDistance(const Location& other) const {
+    return haversineDistance(latitude, longitude, other.latitude, other.longitude);
+}
+
+double Location::calculateDistance(double lat, double lon) const {
+    return haversineDistance(latitude, longitude, lat, lon);
+}
+
+double Location::haversineDistance(double lat1, double lon1, double lat2, double lon2) {
     // Haversine formula to calculate distance between two points on Earth
     const double R = 6371.0; // Earth's radius in kilometers
     
-    double lat1Rad = latitude * M_PI / 180.0;
-    double lat2Rad = other.latitude * M_PI / 180.0;
-    double deltaLat = (other.latitude - latitude) * M_PI / 180.0;
-    double deltaLon = (other.longitude - longitude) * M_PI / 180.0;
+    double lat1Rad = lat1 * M_PI / 180.0;
+    double lat2Rad = lat2 * M_PI / 180.0;
+    double deltaLat = (lat2 - lat1) * M_PI / 180.0;
+    double deltaLon = (lon2 - lon1) * M_PI / 180.0;
     
     double a = sin(deltaLat / 2) * sin(deltaLat / 2) +
                cos(lat1Rad) * cos(lat2Rad) *
@@ -0,0 +1,202 @@
+#include "../include/LocationIngestor.hpp"
+#include <cmath>
+#include <limits>
+
+namespace {
+    const double FIXED_POINT_SCALE = 1e7; // ~1 cm resolution
+}
+
+LocationIngestor::LocationIngestor(size_t shardCount, size_t shardCapacity)
+    : chunks(new std::atomic<SourceSlot*>[MAX_CHUNKS]), sourceCount(0),
+      received(0), coalesced(0), stale(0), published(0) {
+    for (size_t i = 0; i < MAX_CHUNKS; ++i) {
+        chunks[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    if (shardCount == 0) {
+        shardCount = 1;
+    }
+    for (size_t i = 0; i < shardCount; ++i) {
+        shards.push_back(std::make_unique<Shard>(shardCapacity));
+    }
+}
+
+std::uint32_t LocationIngestor::registerSource(const std::string& sourceId) {
+    auto it = sourceIndex.find(sourceId);
+    if (it != sourceIndex.end()) {
+        return it->second;
+    }
+
+    std::uint32_t source = sourceCount.load(std::memory_order_relaxed);
+    size_t chunk = source / CHUNK_SIZE;
+    if (chunk >= MAX_CHUNKS) {
+        return INVALID_SOURCE;
+    }
+
+    if (source % CHUNK_SIZE == 0) {
+        std::unique_ptr<SourceSlot[]> slots(new SourceSlot[CHUNK_SIZE]);
+        for (size_t i = 0; i < CHUNK_SIZE; ++i) {
+            slots[i].sequence.store(0, std::memory_order_relaxed);
+            slots[i].position.store(0, std::memory_order_relaxed);
+            slots[i].timestampMs.store(std::numeric_limits<std::int64_t>::min(), std::memory_order_relaxed);
+            slots[i].dirty.store(false, std::memory_order_relaxed);
+        }
+        chunks[chunk].store(slots.get(), std::memory_order_release);
+        ownedChunks.push_back(std::move(slots));
+    }
+
+    sourceIds.push_back(sourceId);
+    sourceIndex[sourceId] = source;
+    sourceCount.store(source + 1, std::memory_order_release);
+    return source;
+}
+
+std::uint32_t LocationIngestor::findSource(const std::string& sourceId) const {
+    auto it = sourceIndex.find(sourceId);
+    return it != sourceIndex.end() ? it->second : INVALID_SOURCE;
+}
+
+const std::string& LocationIngestor::getSourceId(std::uint32_t source) const {
+    return sourceIds[source];
+}
+
+size_t LocationIngestor::getSourceCount() const {
+    return sourceCount.load(std::memory_order_acquire);
+}
+
+LocationIngestor::SourceSlot* LocationIngestor::slotFor(std::uint32_t source) const {
+    if (source >= sourceCount.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    SourceSlot* chunk = chunks[source / CHUNK_SIZE].load(std::memory_order_acquire);
+    return chunk ? &chunk[source % CHUNK_SIZE] : nullptr;
+}
+
+// Stores the ping unless the slot already holds a newer one
+bool LocationIngestor::writeSlot(SourceSlot& slot, std::uint64_t position, std::int64_t timestampMs) {
+    std::uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    do {
+        while (sequence & 1u) {
+            sequence = slot.sequence.load(std::memory_order_relaxed);
+        }
+    } while (!slot.sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire,
+                                                  std::memory_order_relaxed));
+    // Odd sequence is visible before either field changes
+    std::atomic_thread_fence(std::memory_order_release);
+
+    bool newer = timestampMs >= slot.timestampMs.load(std::memory_order_relaxed);
+    if (newer) {
+        slot.position.store(position, std::memory_order_relaxed);
+        slot.timestampMs.store(timestampMs, std::memory_order_relaxed);
+    }
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+    return newer;
+}
+
+void LocationIngestor::readSlot(const SourceSlot& slot, std::uint64_t& position, std::int64_t& timestampMs) {
+    std::uint32_t before, after;
+    do {
+        before = slot.sequence.load(std::memory_order_acquire);
+        position = slot.position.load(std::memory_order_relaxed);
+        timestampMs = slot.timestampMs.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = slot.sequence.load(std::memory_order_relaxed);
+    } while ((before & 1u) || before != after);
+}
+
+bool LocationIngestor::submit(std::uint32_t source, double lat, double lon, std::int64_t timestampMs) {
+    SourceSlot* slot = slotFor(source);
+    if (!slot || lat < -90.0 || lat > 90.0 || lon < -180.0 || lon > 180.0) {
+        return false;
+    }
+    received.fetch_add(1, std::memory_order_relaxed);
+
+    // Network reordering: keep only the newest ping. Timestamps only grow, so a ping
+    // older than the stored one can be dropped without taking the slot.
+    if (timestampMs < slot->timestampMs.load(std::memory_order_relaxed) ||
+        !writeSlot(*slot, packPosition(lat, lon), timestampMs)) {
+        stale.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Already queued since the last drain: the consumer will pick up this position
+    if (slot->dirty.exchange(true)) {
+        coalesced.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    Shard& shard = *shards[source % shards.size()];
+    if (!shard.ring.push(source)) {
+        shard.overflowed.store(true, std::memory_order_release);
+    }
+    return true;
+}
+
+void LocationIngestor::applySlot(std::uint32_t source, const ApplyFunction& apply) {
+    SourceSlot* slot = slotFor(source);
+    // Clear before reading so a ping landing after this point re-queues the source; the
+    // exchange also makes every write that queued the source visible to the read below
+    slot->dirty.exchange(false);
+
+    std::uint64_t position;
+    std::int64_t timestampMs;
+    readSlot(*slot, position, timestampMs);
+    double lat, lon;
+    unpackPosition(position, lat, lon);
+    apply(sourceIds[source], lat, lon, timestampMs);
+    published++;
+}
+
+size_t LocationIngestor::drain(const ApplyFunction& apply) {
+    size_t applied = 0;
+    size_t registered = getSourceCount();
+
+    for (size_t shardIndex = 0; shardIndex < shards.size(); ++shardIndex) {
+        Shard& shard = *shards[shardIndex];
+
+        std::uint32_t source;
+        while (shard.ring.pop(source)) {
+            applySlot(source, apply);
+            applied++;
+        }
+
+        // Ring was full at some point: dirty sources may be missing from it
+        if (shard.overflowed.exchange(false, std::memory_order_acq_rel)) {
+            for (size_t candidate = shardIndex; candidate < registered; candidate += shards.size()) {
+                if (slotFor(static_cast<std::uint32_t>(candidate))->dirty.load()) {
+                    applySlot(static_cast<std::uint32_t>(candidate), apply);
+                    applied++;
+                }
+            }
+        }
+    }
+    return applied;
+}
+
+std::uint64_t LocationIngestor::getReceivedCount() const {
+    return received.load(std::memory_order_relaxed);
+}
+
+std::uint64_t LocationIngestor::getCoalescedCount() const {
+    return coalesced.load(std::memory_order_relaxed);
+}
+
+std::uint64_t LocationIngestor::getStaleCount() const {
+    return stale.load(std::memory_order_relaxed);
+}
+
+std::uint64_t LocationIngestor::getPublishedCount() const {
+    return published;
+}
+
+std::uint64_t LocationIngestor::packPosition(double lat, double lon) {
+    auto latFixed = static_cast<std::int32_t>(std::lround(lat * FIXED_POINT_SCALE));
+    auto lonFixed = static_cast<std::int32_t>(std::lround(lon * FIXED_POINT_SCALE));
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(latFixed)) << 32) |
+           static_cast<std::uint32_t>(lonFixed);
+}
+
+void LocationIngestor::unpackPosition(std::uint64_t packed, double& lat, double& lon) {
+    lat = static_cast<std::int32_t>(static_cast<std::uint32_t>(packed >> 32)) / FIXED_POINT_SCALE;
+    lon = static_cast<std::int32_t>(static_cast<std::uint32_t>(packed)) / FIXED_POINT_SCALE;
+}
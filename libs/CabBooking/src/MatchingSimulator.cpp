@@ -0,0 +1,203 @@
+#include "../include/MatchingSimulator.hpp"
+#include "../include/Location.hpp"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+
+namespace {
+    const double KM_PER_DEGREE = 6371.0 * M_PI / 180.0;
+
+    double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+MatchingSimulator::MatchingSimulator(const MatchingSimulationConfig& config)
+    : config(config), rng(config.seed), nextSequence(0), now(0.0), totalPickupEta(0.0), totalMatchDelay(0.0) {
+}
+
+void MatchingSimulator::schedule(double time, EventType type, size_t index) {
+    events.push({time, nextSequence++, type, index});
+}
+
+void MatchingSimulator::randomPoint(double& lat, double& lon) {
+    // Uniform over the city disc
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    double radius = config.cityRadiusKm * std::sqrt(unit(rng));
+    double angle = 2.0 * M_PI * unit(rng);
+    lat = config.centerLatitude + radius * std::sin(angle) / KM_PER_DEGREE;
+    lon = config.centerLongitude +
+          radius * std::cos(angle) / (KM_PER_DEGREE * std::cos(config.centerLatitude * M_PI / 180.0));
+}
+
+MatchingSimulationReport MatchingSimulator::run() {
+    auto wallStart = std::chrono::steady_clock::now();
+
+    drivers.resize(config.driverCount);
+    for (size_t i = 0; i < drivers.size(); ++i) {
+        randomPoint(drivers[i].latitude, drivers[i].longitude);
+        availableDrivers.upsert(std::to_string(i), drivers[i].latitude, drivers[i].longitude, VehicleType::SEDAN);
+    }
+
+    std::exponential_distribution<double> interArrival(config.bookingsPerSecond);
+    schedule(interArrival(rng), EventType::BOOKING_ARRIVAL);
+    if (config.windowSeconds > 0) {
+        schedule(config.windowSeconds, EventType::MATCH_TICK);
+    }
+
+    while (!events.empty() && events.top().time <= config.durationSeconds) {
+        Event event = events.top();
+        events.pop();
+        now = event.time;
+
+        switch (event.type) {
+            case EventType::BOOKING_ARRIVAL: {
+                SimBooking booking;
+                booking.createdAt = now;
+                randomPoint(booking.pickupLatitude, booking.pickupLongitude);
+                randomPoint(booking.dropLatitude, booking.dropLongitude);
+                pending.push_back(booking);
+                report.bookingsGenerated++;
+                schedule(now + interArrival(rng), EventType::BOOKING_ARRIVAL);
+                if (config.windowSeconds <= 0) {
+                    matchGreedy();
+                }
+                break;
+            }
+            case EventType::DRIVER_FREE: {
+                const SimDriver& driver = drivers[event.index];
+                availableDrivers.upsert(std::to_string(event.index), driver.latitude, driver.longitude,
+                                        VehicleType::SEDAN);
+                if (config.windowSeconds <= 0 && !pending.empty()) {
+                    matchGreedy();
+                }
+                break;
+            }
+            case EventType::MATCH_TICK:
+                matchBatch();
+                schedule(now + config.windowSeconds, EventType::MATCH_TICK);
+                break;
+        }
+    }
+
+    report.bookingsExpired += pending.size();
+    if (report.bookingsMatched > 0) {
+        report.averagePickupEtaMinutes = totalPickupEta / report.bookingsMatched;
+        report.averageMatchDelaySeconds = totalMatchDelay / report.bookingsMatched;
+    }
+    if (report.matchingWallSeconds > 0) {
+        report.matchesPerSecond = report.bookingsMatched / report.matchingWallSeconds;
+    }
+    report.wallSeconds = elapsedSeconds(wallStart);
+    return report;
+}
+
+void MatchingSimulator::expireWaiting() {
+    while (!pending.empty() && now - pending.front().createdAt > config.maxWaitSeconds) {
+        pending.pop_front();
+        report.bookingsExpired++;
+    }
+}
+
+void MatchingSimulator::assign(const SimBooking& booking, size_t driver, double pickupKm) {
+    double speedKmPerSecond = config.matching.averageSpeedKmh / 3600.0;
+    double pickupSeconds = pickupKm / speedKmPerSecond;
+    double tripKm = Location::haversineDistance(booking.pickupLatitude, booking.pickupLongitude,
+                                                booking.dropLatitude, booking.dropLongitude);
+
+    availableDrivers.remove(std::to_string(driver));
+    drivers[driver].latitude = booking.dropLatitude;
+    drivers[driver].longitude = booking.dropLongitude;
+    schedule(now + pickupSeconds + tripKm / speedKmPerSecond, EventType::DRIVER_FREE, driver);
+
+    report.bookingsMatched++;
+    totalPickupEta += pickupSeconds / 60.0;
+    totalMatchDelay += now - booking.createdAt;
+}
+
+void MatchingSimulator::matchGreedy() {
+    expireWaiting();
+    auto start = std::chrono::steady_clock::now();
+    report.matchingRounds++;
+
+    // Oldest booking first, each takes the nearest free driver
+    std::deque<SimBooking> waiting;
+    while (!pending.empty()) {
+        SimBooking booking = pending.front();
+        pending.pop_front();
+        auto nearest = availableDrivers.findNearest(booking.pickupLatitude, booking.pickupLongitude, 1);
+        if (nearest.empty() || nearest.front().distanceKm > config.matching.maxPickupKm) {
+            waiting.push_back(booking);
+            continue;
+        }
+        assign(booking, std::stoul(nearest.front().id), nearest.front().distanceKm);
+    }
+    pending.swap(waiting);
+
+    report.matchingWallSeconds += elapsedSeconds(start);
+}
+
+void MatchingSimulator::matchBatch() {
+    expireWaiting();
+    if (pending.empty()) {
+        return;
+    }
+    auto start = std::chrono::steady_clock::now();
+    report.matchingRounds++;
+
+    std::vector<MatchEdge> edges;
+    std::vector<size_t> columnDriver;
+    std::vector<int> driverColumn(drivers.size(), -1);
+    std::vector<double> edgeKm;
+    for (size_t i = 0; i < pending.size(); ++i) {
+        auto candidates = availableDrivers.findNearest(pending[i].pickupLatitude, pending[i].pickupLongitude,
+                                                       config.matching.candidatesPerBooking);
+        for (const auto& candidate : candidates) {
+            if (candidate.distanceKm > config.matching.maxPickupKm) {
+                break;
+            }
+            size_t driver = std::stoul(candidate.id);
+            if (driverColumn[driver] < 0) {
+                driverColumn[driver] = static_cast<int>(columnDriver.size());
+                columnDriver.push_back(driver);
+            }
+            edges.push_back({static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(driverColumn[driver]),
+                             candidate.distanceKm});
+        }
+    }
+
+    const auto& assignment = matcher.solve(pending.size(), columnDriver.size(), edges);
+
+    // Look up each pairing's distance before assign() moves the drivers
+    std::vector<double> pickupKm(pending.size(), 0.0);
+    for (const auto& edge : edges) {
+        if (assignment[edge.booking] == static_cast<int>(edge.driver)) {
+            pickupKm[edge.booking] = edge.cost;
+        }
+    }
+
+    std::deque<SimBooking> waiting;
+    for (size_t i = 0; i < pending.size(); ++i) {
+        if (assignment[i] < 0) {
+            waiting.push_back(pending[i]);
+            continue;
+        }
+        assign(pending[i], columnDriver[assignment[i]], pickupKm[i]);
+    }
+    pending.swap(waiting);
+
+    report.matchingWallSeconds += elapsedSeconds(start);
+}
+
+void MatchingSimulator::printReport(const std::string& label, const MatchingSimulationReport& report) {
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "=== " << label << " ===" << std::endl;
+    std::cout << "Bookings: " << report.bookingsGenerated << " generated, " << report.bookingsMatched
+              << " matched, " << report.bookingsExpired << " expired" << std::endl;
+    std::cout << "Average pickup ETA: " << report.averagePickupEtaMinutes << " min" << std::endl;
+    std::cout << "Average match delay: " << report.averageMatchDelaySeconds << " s" << std::endl;
+    std::cout << "Matching rounds: " << report.matchingRounds << ", " << report.matchesPerSecond
+              << " matches/sec" << std::endl;
+    std::cout << "Wall time: " << report.wallSeconds << " s" << std::endl;
+}
@@ -1,11 +1,13 @@
 #include "../include/NotificationService.hpp"
+#include "../include/NotificationTransport.hpp"
+#include <algorithm>
 #include <iostream>
 
 Notification::Notification(const std::string& id, const std::string& recipientId,
                            const std::string& title, const std::string& message,
                            NotificationType type, NotificationPriority priority)
     : notificationId(id), recipientId(recipientId), title(title), message(message),
-      type(type), priority(priority), status("PENDING"), timestamp(std::chrono::system_clock::now()) {}
+      type(type), priority(priority), status(NotificationStatus::PENDING), timestamp(std::chrono::system_clock::now()) {}
 
 std::string Notification::getNotificationId() const {
     return notificationId;
@@ -31,8 +33,8 @@ NotificationPriority Notification::getPriority() const {
     return priority;
 }
 
-std::string Notification::getStatus() const {
-    return status;
+NotificationStatus Notification::getStatus() const {
+    return status.load(std::memory_order_acquire);
 }
 
 std::chrono::system_clock::time_point Notification::getTimestamp() const {
@@ -43,8 +45,8 @@ std::string Notification::getMetadata() const {
     return metadata;
 }
 
-void Notification::setStatus(const std::string& status) {
-    this->status = status;
+void Notification::setStatus(NotificationStatus status) {
+    this->status.store(status, std::memory_order_release);
 }
 
 void Notification::setMetadata(const std::string& metadata) {
@@ -71,51 +73,293 @@ std::string Notification::getPriorityString() const {
     }
 }
 
+std::string Notification::getStatusString() const {
+    switch (getStatus()) {
+        case NotificationStatus::PENDING: return "PENDING";
+        case NotificationStatus::SENT: return "SENT";
+        case NotificationStatus::FAILED: return "FAILED";
+        default: return "UNKNOWN";
+    }
+}
+
 bool Notification::isSent() const {
-    return status == "SENT";
+    return getStatus() == NotificationStatus::SENT;
 }
 
 bool Notification::isFailed() const {
-    return status == "FAILED";
+    return getStatus() == NotificationStatus::FAILED;
 }
 
 NotificationService::NotificationService() 
-    : smsEnabled(true), emailEnabled(true), pushEnabled(true),
-      smsProvider("Twilio"), emailProvider("SendGrid") {}
+    : transport(std::make_shared<ConsoleTransport>()), smsEnabled(true), emailEnabled(true), pushEnabled(true),
+      smsProvider("Twilio"), emailProvider("SendGrid"), historyLimit(1000), dispatching(false), activeSenders(0), stopping(false),
+      collectorIdle(false), collectorFinished(false), accepted(0), rejected(0), completed(0), sent(0), failed(0),
+      batchCount(0), recentLatencyMs(LATENCY_SAMPLES, 0.0), nextLatencySlot(0) {}
+
+NotificationService::~NotificationService() {
+    stopDispatch();
+}
 
-void NotificationService::sendNotification(std::shared_ptr<Notification> notification) {
-    notificationQueue.push_back(notification);
+bool NotificationService::sendNotification(std::shared_ptr<Notification> notification) {
+    if (!notification) {
+        return false;
+    }
     
-    // Simulate sending notification based on type
-    switch (notification->getType()) {
-        case NotificationType::SMS:
-            if (smsEnabled) {
-                sendSMS(notification->getRecipientId(), notification->getMessage());
-                notification->setStatus("SENT");
-            } else {
-                notification->setStatus("FAILED");
+    Pending pending{notification, std::chrono::steady_clock::now()};
+    accepted.fetch_add(1, std::memory_order_relaxed);
+    
+    // Registering before checking the flag pairs with stopDispatch clearing the flag
+    // before waiting for activeSenders: either this sender sees dispatching off, or
+    // stopDispatch waits for its push before draining the lanes
+    activeSenders.fetch_add(1);
+    if (!dispatching.load()) {
+        activeSenders.fetch_sub(1);
+        std::vector<Pending> items;
+        items.push_back(std::move(pending));
+        deliverBatch(notification->getType(), items);
+        return true;
+    }
+    
+    size_t lane = static_cast<size_t>(notification->getPriority());
+    bool queued = lane < PRIORITY_COUNT && lanes[lane]->push(std::move(pending));
+    activeSenders.fetch_sub(1);
+    if (!queued) {
+        accepted.fetch_sub(1, std::memory_order_relaxed);
+        rejected.fetch_add(1, std::memory_order_relaxed);
+        notification->setStatus(NotificationStatus::FAILED);
+        std::lock_guard<std::mutex> lock(batchMutex);
+        drained.notify_all();
+        return false;
+    }
+    
+    // The collector also wakes on its own timer, so a missed signal only delays the batch
+    if (collectorIdle.load()) {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        collectorWake.notify_one();
+    }
+    return true;
+}
+
+bool NotificationService::isChannelEnabled(NotificationType type) const {
+    switch (type) {
+        case NotificationType::SMS: return smsEnabled;
+        case NotificationType::EMAIL: return emailEnabled;
+        case NotificationType::PUSH: return pushEnabled;
+        case NotificationType::IN_APP: return true;
+        default: return false;
+    }
+}
+
+void NotificationService::deliverBatch(NotificationType channel, std::vector<Pending>& items) {
+    std::vector<std::shared_ptr<Notification>> notifications;
+    notifications.reserve(items.size());
+    for (const auto& item : items) {
+        notifications.push_back(item.notification);
+    }
+    
+    auto activeTransport = std::atomic_load(&transport);
+    bool delivered = isChannelEnabled(channel) && activeTransport && activeTransport->deliver(channel, notifications);
+    auto now = std::chrono::steady_clock::now();
+    
+    for (const auto& notification : notifications) {
+        notification->setStatus(delivered ? NotificationStatus::SENT : NotificationStatus::FAILED);
+    }
+    (delivered ? sent : failed).fetch_add(notifications.size(), std::memory_order_relaxed);
+    batchCount.fetch_add(1, std::memory_order_relaxed);
+    
+    {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+        for (const auto& item : items) {
+            recentLatencyMs[nextLatencySlot % LATENCY_SAMPLES] =
+                std::chrono::duration<double, std::milli>(now - item.enqueuedAt).count();
+            nextLatencySlot++;
+        }
+    }
+    recordDelivered(notifications);
+    
+    std::lock_guard<std::mutex> lock(batchMutex);
+    completed.fetch_add(notifications.size());
+    drained.notify_all();
+}
+
+void NotificationService::recordDelivered(const std::vector<std::shared_ptr<Notification>>& notifications) {
+    std::lock_guard<std::mutex> lock(historyMutex);
+    for (const auto& notification : notifications) {
+        history.push_back(notification);
+    }
+    while (history.size() > historyLimit) {
+        history.pop_front();
+    }
+}
+
+void NotificationService::startDispatch(const DispatchConfig& config) {
+    std::lock_guard<std::mutex> control(controlMutex);
+    if (dispatching) {
+        return;
+    }
+    
+    // No sender holds a lane here: stopDispatch waited for all of them
+    dispatchConfig = config;
+    dispatchConfig.maxBatchSize = std::max<size_t>(1, dispatchConfig.maxBatchSize);
+    dispatchConfig.dispatcherThreads = std::max<size_t>(1, dispatchConfig.dispatcherThreads);
+    dispatchConfig.maxQueuedBatches = std::max<size_t>(1, dispatchConfig.maxQueuedBatches);
+    lanes.clear();
+    for (size_t i = 0; i < PRIORITY_COUNT; ++i) {
+        lanes.push_back(std::make_unique<Lane>(std::max<size_t>(2, dispatchConfig.laneCapacity)));
+    }
+    stopping = false;
+    collectorFinished = false;
+    
+    collector = std::thread(&NotificationService::collectLoop, this);
+    for (size_t i = 0; i < dispatchConfig.dispatcherThreads; ++i) {
+        dispatchers.emplace_back(&NotificationService::dispatchLoop, this);
+    }
+    dispatching.store(true, std::memory_order_release);
+}
+
+void NotificationService::stopDispatch() {
+    std::lock_guard<std::mutex> control(controlMutex);
+    if (!dispatching.exchange(false)) {
+        return;
+    }
+    
+    // New notifications now go out synchronously. Wait for senders that saw the
+    // service dispatching to finish their push, so nothing lands after the drain.
+    while (activeSenders.load() != 0) {
+        std::this_thread::yield();
+    }
+    
+    // The collector drains every lane before it exits
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        stopping = true;
+    }
+    collectorWake.notify_one();
+    collector.join();
+    for (auto& dispatcher : dispatchers) {
+        dispatcher.join();
+    }
+    dispatchers.clear();
+}
+
+void NotificationService::flush() {
+    std::unique_lock<std::mutex> lock(batchMutex);
+    drained.wait(lock, [this] { return completed.load() >= accepted.load(); });
+}
+
+bool NotificationService::isDispatching() const {
+    return dispatching;
+}
+
+void NotificationService::queueBatch(Batch&& batch) {
+    std::unique_lock<std::mutex> lock(batchMutex);
+    batchTaken.wait(lock, [this] { return readyBatches.size() < dispatchConfig.maxQueuedBatches; });
+    readyBatches.push_back(std::move(batch));
+    std::push_heap(readyBatches.begin(), readyBatches.end());
+    batchReady.notify_one();
+}
+
+void NotificationService::collectLoop() {
+    std::vector<Batch> open(CHANNEL_COUNT);
+    const size_t passLimit = dispatchConfig.maxBatchSize * CHANNEL_COUNT;
+    
+    while (true) {
+        bool finishing = stopping.load();
+        
+        // Most urgent lane first; bound each pass so batch timers are still checked under load
+        size_t taken = 0;
+        for (size_t lane = PRIORITY_COUNT; lane-- > 0; ) {
+            Pending item;
+            while (taken < passLimit && lanes[lane]->pop(item)) {
+                NotificationPriority priority = item.notification->getPriority();
+                Batch& batch = open[static_cast<size_t>(item.notification->getType()) % CHANNEL_COUNT];
+                if (batch.items.empty()) {
+                    batch.channel = item.notification->getType();
+                    batch.priority = priority;
+                }
+                batch.priority = std::max(batch.priority, priority);
+                batch.items.push_back(std::move(item));
+                taken++;
+                
+                if (batch.items.size() >= dispatchConfig.maxBatchSize) {
+                    queueBatch(std::move(batch));
+                    batch = Batch();
+                }
             }
-            break;
-        case NotificationType::EMAIL:
-            if (emailEnabled) {
-                sendEmail(notification->getRecipientId(), notification->getTitle(), notification->getMessage());
-                notification->setStatus("SENT");
-            } else {
-                notification->setStatus("FAILED");
+        }
+        
+        // Ship batches holding URGENT notifications, and those whose oldest
+        // notification has waited long enough
+        auto now = std::chrono::steady_clock::now();
+        auto nextDeadline = now + dispatchConfig.maxBatchDelay;
+        for (auto& batch : open) {
+            if (batch.items.empty()) {
+                continue;
             }
-            break;
-        case NotificationType::PUSH:
-            if (pushEnabled) {
-                sendPushNotification(notification->getRecipientId(), notification->getTitle(), notification->getMessage());
-                notification->setStatus("SENT");
+            auto deadline = batch.items.front().enqueuedAt + dispatchConfig.maxBatchDelay;
+            if (deadline <= now || batch.priority == NotificationPriority::URGENT || (finishing && taken == 0)) {
+                queueBatch(std::move(batch));
+                batch = Batch();
             } else {
-                notification->setStatus("FAILED");
+                nextDeadline = std::min(nextDeadline, deadline);
             }
+        }
+        
+        if (finishing && taken == 0) {
             break;
-        case NotificationType::IN_APP:
-            notification->setStatus("SENT");
-            break;
+        }
+        if (taken == 0) {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            collectorIdle = true;
+            collectorWake.wait_until(lock, nextDeadline);
+            collectorIdle = false;
+        }
+    }
+    
+    std::lock_guard<std::mutex> lock(batchMutex);
+    collectorFinished = true;
+    batchReady.notify_all();
+}
+
+void NotificationService::dispatchLoop() {
+    while (true) {
+        Batch batch;
+        {
+            std::unique_lock<std::mutex> lock(batchMutex);
+            batchReady.wait(lock, [this] { return !readyBatches.empty() || collectorFinished; });
+            if (readyBatches.empty()) {
+                return;
+            }
+            std::pop_heap(readyBatches.begin(), readyBatches.end());
+            batch = std::move(readyBatches.back());
+            readyBatches.pop_back();
+        }
+        batchTaken.notify_one();
+        deliverBatch(batch.channel, batch.items);
+    }
+}
+
+NotificationStats NotificationService::getStats() const {
+    NotificationStats stats;
+    stats.accepted = accepted.load();
+    stats.rejected = rejected.load();
+    stats.sent = sent.load();
+    stats.failed = failed.load();
+    stats.batches = batchCount.load();
+    
+    std::vector<double> samples;
+    {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+        samples.assign(recentLatencyMs.begin(),
+                       recentLatencyMs.begin() + std::min(nextLatencySlot, recentLatencyMs.size()));
+    }
+    if (!samples.empty()) {
+        std::sort(samples.begin(), samples.end());
+        stats.p50LatencyMs = samples[samples.size() / 2];
+        stats.p99LatencyMs = samples[std::min(samples.size() - 1, samples.size() * 99 / 100)];
+        stats.maxLatencyMs = samples.back();
     }
+    return stats;
 }
 
 void NotificationService::sendSMS(const std::string& phoneNumber, const std::string& message) {
@@ -249,12 +493,30 @@ void NotificationService::setEmailProvider(const std::string& provider) {
     emailProvider = provider;
 }
 
+void NotificationService::setTransport(std::shared_ptr<NotificationTransport> transport) {
+    std::atomic_store(&this->transport, transport);
+}
+
+std::shared_ptr<NotificationTransport> NotificationService::getTransport() const {
+    return std::atomic_load(&transport);
+}
+
 std::vector<std::shared_ptr<Notification>> NotificationService::getNotificationQueue() const {
-    return notificationQueue;
+    std::lock_guard<std::mutex> lock(historyMutex);
+    return std::vector<std::shared_ptr<Notification>>(history.begin(), history.end());
 }
 
 void NotificationService::clearQueue() {
-    notificationQueue.clear();
+    std::lock_guard<std::mutex> lock(historyMutex);
+    history.clear();
+}
+
+void NotificationService::setHistoryLimit(size_t limit) {
+    std::lock_guard<std::mutex> lock(historyMutex);
+    historyLimit = limit;
+    while (history.size() > historyLimit) {
+        history.pop_front();
+    }
 }
 
 bool NotificationService::isSMSEnabled() const {
@@ -0,0 +1,52 @@
+#include "../include/NotificationTransport.hpp"
+#include <iostream>
+#include <thread>
+
+bool ConsoleTransport::deliver(NotificationType channel, const std::vector<std::shared_ptr<Notification>>& batch) {
+    for (const auto& notification : batch) {
+        switch (channel) {
+            case NotificationType::SMS:
+                std::cout << "SMS sent to " << notification->getRecipientId() << ": " << notification->getMessage()
+                          << std::endl;
+                break;
+            case NotificationType::EMAIL:
+                std::cout << "Email sent to " << notification->getRecipientId() << " - Subject: "
+                          << notification->getTitle() << std::endl;
+                std::cout << "Body: " << notification->getMessage() << std::endl;
+                break;
+            case NotificationType::PUSH:
+                std::cout << "Push notification sent to user " << notification->getRecipientId() << " - Title: "
+                          << notification->getTitle() << std::endl;
+                std::cout << "Message: " << notification->getMessage() << std::endl;
+                break;
+            case NotificationType::IN_APP:
+                break;
+        }
+    }
+    return true;
+}
+
+LocalTransport::LocalTransport(std::chrono::microseconds perBatchLatency, std::chrono::microseconds perMessageLatency)
+    : perBatchLatency(perBatchLatency), perMessageLatency(perMessageLatency), calls(0) {
+    for (auto& count : delivered) {
+        count.store(0, std::memory_order_relaxed);
+    }
+}
+
+bool LocalTransport::deliver(NotificationType channel, const std::vector<std::shared_ptr<Notification>>& batch) {
+    auto cost = perBatchLatency + perMessageLatency * static_cast<long>(batch.size());
+    if (cost.count() > 0) {
+        std::this_thread::sleep_for(cost);
+    }
+    delivered[static_cast<size_t>(channel) % 4].fetch_add(batch.size(), std::memory_order_relaxed);
+    calls.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+std::uint64_t LocalTransport::getDeliveredCount(NotificationType channel) const {
+    return delivered[static_cast<size_t>(channel) % 4].load(std::memory_order_relaxed);
+}
+
+std::uint64_t LocalTransport::getCallCount() const {
+    return calls.load(std::memory_order_relaxed);
+}
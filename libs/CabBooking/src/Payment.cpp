@@ -8,8 +8,8 @@ Payment::Payment(const std::string& id, const std::string& tripId, const std::st
       amount(amount), method(method), status(PaymentStatus::PENDING),
       timestamp(std::chrono::system_clock::now()), platformFee(0.0), driverAmount(0.0), currency("USD") {
     
-    calculatePlatformFee();
-    calculateDriverAmount();
+    platformFee = calculatePlatformFee();
+    driverAmount = calculateDriverAmount();
 }
 
 std::string Payment::getPaymentId() const {
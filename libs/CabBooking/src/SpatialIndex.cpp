@@ -0,0 +1,253 @@
+#include "../include/SpatialIndex.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+    const double KM_PER_DEGREE = 6371.0 * M_PI / 180.0;
+
+    // Per-thread buffer for a cell's batch distances
+    thread_local std::vector<double> distanceScratch;
+
+    bool closer(const SpatialMatch& a, const SpatialMatch& b) {
+        return a.distanceKm < b.distanceKm;
+    }
+
+    // Keep only the k closest candidates
+    void trimToNearest(std::vector<SpatialMatch>& candidates, size_t k) {
+        if (candidates.size() > k) {
+            std::nth_element(candidates.begin(), candidates.begin() + (k - 1), candidates.end(), closer);
+            candidates.resize(k);
+        }
+    }
+}
+
+SpatialIndex::SpatialIndex(double cellDegrees)
+    : cellDegrees(cellDegrees > 0 ? cellDegrees : 0.01) {
+    lonCells = static_cast<int>(std::ceil(360.0 / this->cellDegrees));
+}
+
+int SpatialIndex::latCellOf(double lat) const {
+    lat = std::max(-90.0, std::min(90.0, lat));
+    return static_cast<int>(std::floor((lat + 90.0) / cellDegrees));
+}
+
+int SpatialIndex::lonCellOf(double lon) const {
+    int cell = static_cast<int>(std::floor((lon + 180.0) / cellDegrees)) % lonCells;
+    return cell < 0 ? cell + lonCells : cell;
+}
+
+std::int64_t SpatialIndex::cellKey(int latCell, int lonCell) const {
+    lonCell %= lonCells;
+    if (lonCell < 0) {
+        lonCell += lonCells;
+    }
+    return (static_cast<std::int64_t>(latCell) << 32) | static_cast<std::uint32_t>(lonCell);
+}
+
+double SpatialIndex::ringLowerBoundKm(double lat, int ring) const {
+    // Anything outside rings 0..ring differs by at least ring cells in latitude or
+    // longitude; longitude cells shrink towards the poles, so use the poleward edge
+    double poleward = std::min(89.9, std::abs(lat) + (ring + 1) * cellDegrees);
+    return ring * cellDegrees * KM_PER_DEGREE * std::cos(poleward * M_PI / 180.0) * 0.999;
+}
+
+void SpatialIndex::upsert(const std::string& id, double lat, double lon, VehicleType type) {
+    std::int64_t key = cellKey(latCellOf(lat), lonCellOf(lon));
+
+    auto slotIt = slots.find(id);
+    if (slotIt != slots.end()) {
+        if (slotIt->second.cellKey == key) {
+            // Same cell: update in place
+            Cell& cell = cells[key];
+            SpatialEntry& entry = cell.entries[slotIt->second.position];
+            entry.latitude = lat;
+            entry.longitude = lon;
+            entry.type = type;
+            cell.points.set(slotIt->second.position, lat, lon);
+            return;
+        }
+        removeFromCell(slotIt->second);
+    }
+
+    Cell& cell = cells[key];
+    cell.entries.push_back({id, lat, lon, type});
+    cell.points.push_back(lat, lon);
+    slots[id] = {key, cell.entries.size() - 1};
+}
+
+void SpatialIndex::removeFromCell(const Slot& slot) {
+    auto cellIt = cells.find(slot.cellKey);
+    if (cellIt == cells.end()) {
+        return;
+    }
+
+    auto& entries = cellIt->second.entries;
+    if (slot.position != entries.size() - 1) {
+        entries[slot.position] = std::move(entries.back());
+        slots[entries[slot.position].id].position = slot.position;
+    }
+    entries.pop_back();
+    cellIt->second.points.swapRemove(slot.position);
+
+    if (entries.empty()) {
+        cells.erase(cellIt);
+    }
+}
+
+bool SpatialIndex::remove(const std::string& id) {
+    auto slotIt = slots.find(id);
+    if (slotIt == slots.end()) {
+        return false;
+    }
+
+    Slot slot = slotIt->second;
+    slots.erase(slotIt);
+    removeFromCell(slot);
+    return true;
+}
+
+bool SpatialIndex::contains(const std::string& id) const {
+    return slots.find(id) != slots.end();
+}
+
+size_t SpatialIndex::size() const {
+    return slots.size();
+}
+
+void SpatialIndex::clear() {
+    cells.clear();
+    slots.clear();
+}
+
+void SpatialIndex::scanCell(std::int64_t key, double lat, double lon, VehicleType type, bool anyType,
+                            const Filter& filter, double radiusKm, std::vector<SpatialMatch>& out) const {
+    auto cellIt = cells.find(key);
+    if (cellIt == cells.end()) {
+        return;
+    }
+
+    const Cell& cell = cellIt->second;
+    std::vector<double>& distances = distanceScratch;
+    distances.resize(cell.points.size());
+    GeoDistance::distancesKm(lat, lon, cell.points, distances.data());
+
+    for (size_t i = 0; i < cell.entries.size(); ++i) {
+        const SpatialEntry& entry = cell.entries[i];
+        if (distances[i] > radiusKm || (!anyType && entry.type != type)) {
+            continue;
+        }
+        if (filter && !filter(entry)) {
+            continue;
+        }
+        out.push_back({entry.id, distances[i]});
+    }
+}
+
+std::vector<SpatialMatch> SpatialIndex::nearest(double lat, double lon, size_t k, VehicleType type, bool anyType,
+                                                const Filter& filter) const {
+    std::vector<SpatialMatch> candidates;
+    if (k == 0 || cells.empty()) {
+        return candidates;
+    }
+
+    const double unlimited = std::numeric_limits<double>::max();
+    int latCell = latCellOf(lat);
+    int lonCell = lonCellOf(lon);
+    int latCellCount = latCellOf(90.0) + 1;
+
+    for (int ring = 0; ; ++ring) {
+        size_t window = static_cast<size_t>(2 * ring + 1) * (2 * ring + 1);
+        if (window > cells.size() || 2 * ring + 1 >= lonCells) {
+            // Sparse data: a ring now costs more lookups than there are occupied cells
+            candidates.clear();
+            for (const auto& cell : cells) {
+                scanCell(cell.first, lat, lon, type, anyType, filter, unlimited, candidates);
+                trimToNearest(candidates, k);
+            }
+            break;
+        }
+
+        for (int dLat = -ring; dLat <= ring; ++dLat) {
+            int row = latCell + dLat;
+            if (row < 0 || row >= latCellCount) {
+                continue;
+            }
+            // Interior rows only contribute the two edge columns of the ring
+            int step = (dLat == -ring || dLat == ring) ? 1 : std::max(1, 2 * ring);
+            for (int dLon = -ring; dLon <= ring; dLon += step) {
+                // Once k candidates exist, nothing farther than the current k-th can qualify
+                double bound = unlimited;
+                if (candidates.size() >= k) {
+                    trimToNearest(candidates, k);
+                    bound = std::max_element(candidates.begin(), candidates.end(), closer)->distanceKm;
+                }
+                scanCell(cellKey(row, lonCell + dLon), lat, lon, type, anyType, filter, bound, candidates);
+            }
+        }
+        trimToNearest(candidates, k);
+
+        if (candidates.size() == k) {
+            double farthest = std::max_element(candidates.begin(), candidates.end(), closer)->distanceKm;
+            if (farthest <= ringLowerBoundKm(lat, ring)) {
+                break;
+            }
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(), closer);
+    return candidates;
+}
+
+std::vector<SpatialMatch> SpatialIndex::withinRadius(double lat, double lon, double radiusKm, VehicleType type,
+                                                     bool anyType, const Filter& filter) const {
+    std::vector<SpatialMatch> matches;
+    if (radiusKm < 0 || cells.empty()) {
+        return matches;
+    }
+
+    double latSpan = radiusKm / KM_PER_DEGREE;
+    double poleward = std::min(89.9, std::abs(lat) + latSpan);
+    double lonSpan = std::min(180.0, latSpan / std::cos(poleward * M_PI / 180.0));
+
+    int minRow = latCellOf(lat - latSpan);
+    int maxRow = latCellOf(lat + latSpan);
+    int minCol = static_cast<int>(std::floor((lon - lonSpan + 180.0) / cellDegrees));
+    int maxCol = static_cast<int>(std::floor((lon + lonSpan + 180.0) / cellDegrees));
+    maxCol = std::min(maxCol, minCol + lonCells - 1);
+
+    size_t window = static_cast<size_t>(maxRow - minRow + 1) * (maxCol - minCol + 1);
+    if (window > cells.size()) {
+        for (const auto& cell : cells) {
+            scanCell(cell.first, lat, lon, type, anyType, filter, radiusKm, matches);
+        }
+    } else {
+        for (int row = minRow; row <= maxRow; ++row) {
+            for (int col = minCol; col <= maxCol; ++col) {
+                scanCell(cellKey(row, col), lat, lon, type, anyType, filter, radiusKm, matches);
+            }
+        }
+    }
+
+    std::sort(matches.begin(), matches.end(), closer);
+    return matches;
+}
+
+std::vector<SpatialMatch> SpatialIndex::findNearest(double lat, double lon, size_t k, const Filter& filter) const {
+    return nearest(lat, lon, k, VehicleType::SEDAN, true, filter);
+}
+
+std::vector<SpatialMatch> SpatialIndex::findNearest(double lat, double lon, size_t k, VehicleType type,
+                                                    const Filter& filter) const {
+    return nearest(lat, lon, k, type, false, filter);
+}
+
+std::vector<SpatialMatch> SpatialIndex::findWithinRadius(double lat, double lon, double radiusKm,
+                                                         const Filter& filter) const {
+    return withinRadius(lat, lon, radiusKm, VehicleType::SEDAN, true, filter);
+}
+
+std::vector<SpatialMatch> SpatialIndex::findWithinRadius(double lat, double lon, double radiusKm, VehicleType type,
+                                                         const Filter& filter) const {
+    return withinRadius(lat, lon, radiusKm, type, false, filter);
+}
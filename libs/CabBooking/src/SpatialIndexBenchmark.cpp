@@ -0,0 +1,148 @@
+#include "../include/SpatialIndexBenchmark.hpp"
+#include "../include/Location.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <random>
+
+const double SpatialIndexBenchmark::DISTANCE_TOLERANCE_KM = 1e-6;
+
+namespace {
+    const double KM_PER_DEGREE = GeoDistance::EARTH_RADIUS_KM * M_PI / 180.0;
+    const VehicleType VEHICLE_TYPES[] = {VehicleType::SEDAN, VehicleType::SUV, VehicleType::HATCHBACK,
+                                         VehicleType::BIKE, VehicleType::AUTO, VehicleType::PREMIUM};
+
+    double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    struct Point {
+        double latitude;
+        double longitude;
+    };
+
+    // Uniform point in a disc around the centre
+    Point cityPoint(const SpatialIndexBenchmarkConfig& config, std::mt19937& rng) {
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        double distance = config.cityRadiusKm * std::sqrt(unit(rng)) / KM_PER_DEGREE;
+        double bearing = 2.0 * M_PI * unit(rng);
+        double lonScale = 1.0 / std::cos(config.centerLatitude * M_PI / 180.0);
+        return {config.centerLatitude + distance * std::cos(bearing),
+                config.centerLongitude + distance * std::sin(bearing) * lonScale};
+    }
+
+    // Haversine to every driver
+    void scanDistances(const std::vector<SpatialEntry>& drivers, const Point& query, std::vector<double>& distances) {
+        for (size_t i = 0; i < drivers.size(); ++i) {
+            distances[i] = Location::haversineDistance(query.latitude, query.longitude,
+                                                       drivers[i].latitude, drivers[i].longitude);
+        }
+    }
+
+    std::vector<double> nearestOf(std::vector<double> distances, size_t k) {
+        k = std::min(k, distances.size());
+        std::partial_sort(distances.begin(), distances.begin() + k, distances.end());
+        distances.resize(k);
+        return distances;
+    }
+}
+
+SpatialIndexBenchmark::SpatialIndexBenchmark(const SpatialIndexBenchmarkConfig& config) : config(config) {
+    this->config.driverCount = std::max<size_t>(1, config.driverCount);
+    this->config.queries = std::max<size_t>(1, config.queries);
+    this->config.scanQueries = std::max<size_t>(1, std::min(config.scanQueries, this->config.queries));
+    this->config.nearestCount = std::max<size_t>(1, config.nearestCount);
+}
+
+SpatialIndexBenchmarkReport SpatialIndexBenchmark::run() {
+    auto wallStart = std::chrono::steady_clock::now();
+    SpatialIndexBenchmarkReport report;
+    report.driverCount = config.driverCount;
+    std::mt19937 rng(config.seed);
+
+    SpatialIndex index;
+    std::vector<SpatialEntry> drivers;
+    drivers.reserve(config.driverCount);
+    for (size_t i = 0; i < config.driverCount; ++i) {
+        Point point = cityPoint(config, rng);
+        drivers.push_back({"DRIVER_" + std::to_string(i + 1), point.latitude, point.longitude, VEHICLE_TYPES[i % 6]});
+        index.upsert(drivers.back().id, point.latitude, point.longitude, drivers.back().type);
+    }
+
+    std::vector<Point> queries;
+    for (size_t i = 0; i < config.queries; ++i) {
+        queries.push_back(cityPoint(config, rng));
+    }
+
+    std::vector<std::vector<SpatialMatch>> nearest(config.queries), within(config.queries);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < config.queries; ++i) {
+        nearest[i] = index.findNearest(queries[i].latitude, queries[i].longitude, config.nearestCount);
+    }
+    report.nearestMicros = elapsedSeconds(start) * 1e6 / config.queries;
+
+    start = std::chrono::steady_clock::now();
+    size_t radiusMatches = 0;
+    for (size_t i = 0; i < config.queries; ++i) {
+        within[i] = index.findWithinRadius(queries[i].latitude, queries[i].longitude, config.radiusKm);
+        radiusMatches += within[i].size();
+    }
+    report.radiusMicros = elapsedSeconds(start) * 1e6 / config.queries;
+    report.averageRadiusMatches = static_cast<double>(radiusMatches) / config.queries;
+
+    std::vector<std::vector<double>> scanned(config.scanQueries);
+    std::vector<double> distances(drivers.size());
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < config.scanQueries; ++i) {
+        scanDistances(drivers, queries[i], distances);
+        scanned[i] = nearestOf(distances, config.nearestCount);
+    }
+    report.scanMicros = elapsedSeconds(start) * 1e6 / config.scanQueries;
+
+    // Same distances for the k nearest, and the same radius count up to ties at the boundary
+    for (size_t i = 0; i < config.scanQueries; ++i) {
+        bool same = nearest[i].size() == scanned[i].size();
+        for (size_t j = 0; same && j < scanned[i].size(); ++j) {
+            same = std::abs(nearest[i][j].distanceKm - scanned[i][j]) <= DISTANCE_TOLERANCE_KM;
+        }
+        if (!same) report.mismatches++;
+
+        scanDistances(drivers, queries[i], distances);
+        size_t surelyInside = 0, maybeInside = 0;
+        for (double distance : distances) {
+            if (distance <= config.radiusKm - DISTANCE_TOLERANCE_KM) surelyInside++;
+            if (distance <= config.radiusKm + DISTANCE_TOLERANCE_KM) maybeInside++;
+        }
+        if (within[i].size() < surelyInside || within[i].size() > maybeInside) report.mismatches++;
+    }
+
+    std::normal_distribution<double> step(0.0, config.moveKm / KM_PER_DEGREE);
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < config.moves; ++i) {
+        SpatialEntry& driver = drivers[i % drivers.size()];
+        driver.latitude += step(rng);
+        driver.longitude += step(rng);
+        index.upsert(driver.id, driver.latitude, driver.longitude, driver.type);
+    }
+    report.upsertNs = config.moves ? elapsedSeconds(start) * 1e9 / config.moves : 0.0;
+
+    report.consistent = report.mismatches == 0 && index.size() == drivers.size();
+    report.wallSeconds = elapsedSeconds(wallStart);
+    return report;
+}
+
+void SpatialIndexBenchmark::printReport(const std::string& label, const SpatialIndexBenchmarkReport& report) {
+    std::cout << "=== " << label << " ===" << std::endl;
+    std::cout << "Drivers: " << report.driverCount << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "findNearest: " << report.nearestMicros << " us/query" << std::endl;
+    std::cout << "findWithinRadius: " << report.radiusMicros << " us/query, "
+              << report.averageRadiusMatches << " matches on average" << std::endl;
+    std::cout << "Full scan: " << report.scanMicros << " us/query" << std::endl;
+    std::cout << "upsert (moving driver): " << report.upsertNs << " ns" << std::endl;
+    std::cout << "Mismatches: " << report.mismatches << ", consistent: " << (report.consistent ? "yes" : "NO")
+              << std::endl;
+    std::cout << "Wall time: " << report.wallSeconds << " s" << std::endl;
+}
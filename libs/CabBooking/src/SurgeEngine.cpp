@@ -0,0 +1,121 @@
+#include "../include/SurgeEngine.hpp"
+#include <algorithm>
+#include <cmath>
+
+double SurgeSnapshot::getMultiplier(std::int64_t zone) const {
+    auto it = zoneMultipliers.find(zone);
+    return it != zoneMultipliers.end() ? it->second : 1.0;
+}
+
+SurgeEngine::SurgeEngine(double zoneDegrees, double maxMultiplier, double sensitivity, double demandHalfLifeSeconds)
+    : zoneDegrees(zoneDegrees > 0 ? zoneDegrees : 0.02), maxMultiplier(std::max(1.0, maxMultiplier)),
+      sensitivity(sensitivity), demandHalfLifeSeconds(demandHalfLifeSeconds > 0 ? demandHalfLifeSeconds : 300.0),
+      lastDecay(std::chrono::steady_clock::now()), nextVersion(1), running(false) {
+    snapshot = std::make_shared<const SurgeSnapshot>();
+}
+
+SurgeEngine::~SurgeEngine() {
+    stop();
+}
+
+std::int64_t SurgeEngine::zoneOf(double lat, double lon) const {
+    auto row = static_cast<std::int64_t>(std::floor((lat + 90.0) / zoneDegrees));
+    auto col = static_cast<std::int64_t>(std::floor((lon + 180.0) / zoneDegrees));
+    return (row << 32) | static_cast<std::uint32_t>(col);
+}
+
+void SurgeEngine::recordDemand(double lat, double lon, double weight) {
+    std::int64_t zone = zoneOf(lat, lon);
+    std::lock_guard<std::mutex> lock(inputMutex);
+    demand[zone] += weight;
+}
+
+void SurgeEngine::setSupply(const std::vector<std::pair<double, double>>& availableDriverPositions) {
+    // Count outside the lock, then swap in
+    std::unordered_map<std::int64_t, int> counts;
+    for (const auto& position : availableDriverPositions) {
+        counts[zoneOf(position.first, position.second)]++;
+    }
+
+    std::lock_guard<std::mutex> lock(inputMutex);
+    supply.swap(counts);
+}
+
+void SurgeEngine::recompute() {
+    auto next = std::make_shared<SurgeSnapshot>();
+    {
+        std::lock_guard<std::mutex> lock(inputMutex);
+
+        auto now = std::chrono::steady_clock::now();
+        double elapsed = std::chrono::duration<double>(now - lastDecay).count();
+        double decay = std::pow(0.5, elapsed / demandHalfLifeSeconds);
+        lastDecay = now;
+
+        for (auto it = demand.begin(); it != demand.end(); ) {
+            it->second *= decay;
+            if (it->second < 0.01) {
+                it = demand.erase(it);
+                continue;
+            }
+
+            auto supplyIt = supply.find(it->first);
+            double drivers = supplyIt != supply.end() ? supplyIt->second : 0.0;
+            double ratio = it->second / std::max(1.0, drivers);
+            if (ratio > 1.0) {
+                // Round to 0.1 steps so quotes do not jitter between ticks
+                double multiplier = std::min(maxMultiplier, 1.0 + sensitivity * (ratio - 1.0));
+                multiplier = std::round(multiplier * 10.0) / 10.0;
+                if (multiplier > 1.0) {
+                    next->zoneMultipliers[it->first] = multiplier;
+                }
+            }
+            ++it;
+        }
+
+        // Versioned and published under the lock, so concurrent recomputes publish in order
+        next->version = nextVersion++;
+        next->computedAt = std::chrono::system_clock::now();
+        std::atomic_store(&snapshot, std::shared_ptr<const SurgeSnapshot>(std::move(next)));
+    }
+}
+
+std::shared_ptr<const SurgeSnapshot> SurgeEngine::getSnapshot() const {
+    return std::atomic_load(&snapshot);
+}
+
+double SurgeEngine::getMultiplier(double lat, double lon) const {
+    return getSnapshot()->getMultiplier(zoneOf(lat, lon));
+}
+
+void SurgeEngine::start(std::chrono::milliseconds interval) {
+    std::lock_guard<std::mutex> lock(tickerMutex);
+    if (running) {
+        return;
+    }
+    running = true;
+    ticker = std::thread(&SurgeEngine::tickLoop, this, interval);
+}
+
+void SurgeEngine::stop() {
+    {
+        std::lock_guard<std::mutex> lock(tickerMutex);
+        if (!running) {
+            return;
+        }
+        running = false;
+    }
+    tickerWake.notify_all();
+    ticker.join();
+}
+
+void SurgeEngine::tickLoop(std::chrono::milliseconds interval) {
+    std::unique_lock<std::mutex> lock(tickerMutex);
+    while (running) {
+        if (tickerWake.wait_for(lock, interval, [this] { return !running; })) {
+            break;
+        }
+        lock.unlock();
+        recompute();
+        lock.lock();
+    }
+}
@@ -85,6 +85,10 @@ std::string Trip::getDriverFeedback() const {
     return driverFeedback;
 }
 
+const TripTrace& Trip::getTrace() const {
+    return trace;
+}
+
 void Trip::setDriverId(const std::string& driverId) {
     this->driverId = driverId;
 }
@@ -167,11 +171,17 @@ bool Trip::isActive() const {
 }
 
 void Trip::calculateDistance() {
-    if (pickupLocation && dropLocation) {
+    if (trace.size() >= 2) {
+        distance = trace.getDistanceKm();
+    } else if (pickupLocation && dropLocation) {
         distance = pickupLocation->calculateDistance(*dropLocation);
     }
 }
 
+bool Trip::recordLocation(double latitude, double longitude, std::int64_t timestampMs) {
+    return trace.append(latitude, longitude, timestampMs);
+}
+
 void Trip::startTrip() {
     status = TripStatus::STARTED;
     startTime = std::chrono::system_clock::now();
@@ -0,0 +1,200 @@
+#include "../include/TripTrace.hpp"
+#include "../include/Location.hpp"
+#include <algorithm>
+#include <cmath>
+
+const double TripTrace::COORDINATE_SCALE = 1e6;
+
+namespace {
+    const double METERS_PER_DEGREE = 6371000.0 * M_PI / 180.0;
+
+    std::uint64_t zigzag(std::int64_t value) {
+        return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+    }
+
+    std::int64_t unzigzag(std::uint64_t value) {
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    void writeVarint(std::vector<std::uint8_t>& out, std::uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    bool readVarint(const std::vector<std::uint8_t>& in, size_t& offset, std::uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64 && offset < in.size(); shift += 7) {
+            std::uint8_t byte = in[offset++];
+            value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Reads one point's deltas and applies them to the running fixed-point state
+    bool readPoint(const std::vector<std::uint8_t>& in, size_t& offset, std::int64_t& lat, std::int64_t& lon,
+                   std::int64_t& timestampMs) {
+        std::uint64_t dLat, dLon, dTime;
+        if (!readVarint(in, offset, dLat) || !readVarint(in, offset, dLon) || !readVarint(in, offset, dTime)) {
+            return false;
+        }
+        lat += unzigzag(dLat);
+        lon += unzigzag(dLon);
+        timestampMs += unzigzag(dTime);
+        return true;
+    }
+
+    TracePoint toPoint(std::int64_t lat, std::int64_t lon, std::int64_t timestampMs) {
+        return {lat / TripTrace::COORDINATE_SCALE, lon / TripTrace::COORDINATE_SCALE, timestampMs};
+    }
+
+    // Distance in metres from p to segment a-b on a local flat projection
+    double segmentDistanceMeters(const TracePoint& p, const TracePoint& a, const TracePoint& b, double lonScale) {
+        double ax = a.longitude * lonScale, ay = a.latitude * METERS_PER_DEGREE;
+        double bx = b.longitude * lonScale, by = b.latitude * METERS_PER_DEGREE;
+        double px = p.longitude * lonScale, py = p.latitude * METERS_PER_DEGREE;
+        double dx = bx - ax, dy = by - ay;
+        double lengthSquared = dx * dx + dy * dy;
+        double t = lengthSquared > 0 ? std::max(0.0, std::min(1.0, ((px - ax) * dx + (py - ay) * dy) / lengthSquared))
+                                     : 0.0;
+        double ex = ax + t * dx - px, ey = ay + t * dy - py;
+        return std::sqrt(ex * ex + ey * ey);
+    }
+}
+
+TripTrace::TripTrace()
+    : pointCount(0), lastLatitude(0), lastLongitude(0), lastTimestampMs(0), distanceKm(0.0) {
+}
+
+void TripTrace::appendFixed(std::int64_t lat, std::int64_t lon, std::int64_t timestampMs) {
+    if (pointCount % KEYFRAME_INTERVAL == 0) {
+        checkpoints.push_back({bytes.size(), lastLatitude, lastLongitude, lastTimestampMs});
+    }
+
+    writeVarint(bytes, zigzag(lat - lastLatitude));
+    writeVarint(bytes, zigzag(lon - lastLongitude));
+    writeVarint(bytes, zigzag(timestampMs - lastTimestampMs));
+
+    if (pointCount > 0) {
+        distanceKm += Location::haversineDistance(lastLatitude / COORDINATE_SCALE, lastLongitude / COORDINATE_SCALE,
+                                                  lat / COORDINATE_SCALE, lon / COORDINATE_SCALE);
+    }
+
+    lastLatitude = lat;
+    lastLongitude = lon;
+    lastTimestampMs = timestampMs;
+    pointCount++;
+}
+
+bool TripTrace::append(double latitude, double longitude, std::int64_t timestampMs) {
+    if (pointCount > 0 && timestampMs < lastTimestampMs) {
+        return false;
+    }
+    appendFixed(std::llround(latitude * COORDINATE_SCALE), std::llround(longitude * COORDINATE_SCALE), timestampMs);
+    return true;
+}
+
+TripTrace TripTrace::fromEncoded(const std::vector<std::uint8_t>& encoded) {
+    TripTrace trace;
+    size_t offset = 0;
+    std::int64_t lat = 0, lon = 0, timestampMs = 0;
+    while (offset < encoded.size()) {
+        if (!readPoint(encoded, offset, lat, lon, timestampMs) ||
+            (trace.pointCount > 0 && timestampMs < trace.lastTimestampMs)) {
+            return TripTrace();
+        }
+        trace.appendFixed(lat, lon, timestampMs);
+    }
+    return trace;
+}
+
+TracePoint TripTrace::at(size_t index) const {
+    if (index >= pointCount) {
+        return {0.0, 0.0, 0};
+    }
+
+    const Checkpoint& checkpoint = checkpoints[index / KEYFRAME_INTERVAL];
+    size_t offset = checkpoint.byteOffset;
+    std::int64_t lat = checkpoint.latitude, lon = checkpoint.longitude, timestampMs = checkpoint.timestampMs;
+    for (size_t i = 0; i <= index % KEYFRAME_INTERVAL; ++i) {
+        readPoint(bytes, offset, lat, lon, timestampMs);
+    }
+    return toPoint(lat, lon, timestampMs);
+}
+
+std::vector<TracePoint> TripTrace::decode(size_t first, size_t count) const {
+    std::vector<TracePoint> points;
+    if (first >= pointCount) {
+        return points;
+    }
+    size_t last = first + std::min(count, pointCount - first);
+    points.reserve(last - first);
+
+    const Checkpoint& checkpoint = checkpoints[first / KEYFRAME_INTERVAL];
+    size_t offset = checkpoint.byteOffset;
+    std::int64_t lat = checkpoint.latitude, lon = checkpoint.longitude, timestampMs = checkpoint.timestampMs;
+    for (size_t i = first - first % KEYFRAME_INTERVAL; i < last; ++i) {
+        readPoint(bytes, offset, lat, lon, timestampMs);
+        if (i >= first) {
+            points.push_back(toPoint(lat, lon, timestampMs));
+        }
+    }
+    return points;
+}
+
+double TripTrace::recomputeDistanceKm() const {
+    std::vector<TracePoint> points = decode();
+    double total = 0.0;
+    for (size_t i = 1; i < points.size(); ++i) {
+        total += Location::haversineDistance(points[i - 1].latitude, points[i - 1].longitude,
+                                             points[i].latitude, points[i].longitude);
+    }
+    return total;
+}
+
+TripTrace TripTrace::simplified(double toleranceMeters) const {
+    std::vector<TracePoint> points = decode();
+    if (points.size() <= 2 || toleranceMeters <= 0) {
+        return *this;
+    }
+
+    double lonScale = METERS_PER_DEGREE * std::cos(points.front().latitude * M_PI / 180.0);
+    std::vector<char> keep(points.size(), 0);
+    keep.front() = keep.back() = 1;
+
+    // Iterative Douglas-Peucker over index ranges
+    std::vector<std::pair<size_t, size_t>> ranges = {{0, points.size() - 1}};
+    while (!ranges.empty()) {
+        auto range = ranges.back();
+        ranges.pop_back();
+
+        double farthest = 0.0;
+        size_t farthestIndex = range.first;
+        for (size_t i = range.first + 1; i < range.second; ++i) {
+            double distance = segmentDistanceMeters(points[i], points[range.first], points[range.second], lonScale);
+            if (distance > farthest) {
+                farthest = distance;
+                farthestIndex = i;
+            }
+        }
+
+        if (farthest > toleranceMeters) {
+            keep[farthestIndex] = 1;
+            ranges.push_back({range.first, farthestIndex});
+            ranges.push_back({farthestIndex, range.second});
+        }
+    }
+
+    TripTrace result;
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (keep[i]) {
+            result.append(points[i].latitude, points[i].longitude, points[i].timestampMs);
+        }
+    }
+    return result;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <deque>
 #include <memory>
 #include <unordered_map>
 #include <string>
@@ -8,6 +9,7 @@
 #include "Elevator.hpp"
 #include "Request.hpp"
 #include "Scheduler.hpp"
+#include "Statistics.hpp"
 
 class Building {
 private:
@@ -18,7 +20,9 @@ private:
     std::vector<std::shared_ptr<Floor>> floors;
     std::vector<std::shared_ptr<Elevator>> elevators;
     std::shared_ptr<Scheduler> scheduler;
-    std::vector<std::shared_ptr<Request>> allRequests;
+    std::deque<std::shared_ptr<Request>> allRequests; // Bounded history, newest at the back
+    size_t requestHistoryLimit;
+    std::shared_ptr<RequestStatistics> statistics;
     std::chrono::system_clock::time_point simulationStartTime;
     bool isSimulationRunning;
 
@@ -57,10 +61,13 @@ public:
     std::shared_ptr<Request> createExternalRequest(int sourceFloor, Direction direction);
     std::shared_ptr<Request> createInternalRequest(int sourceFloor, int destinationFloor);
     void submitRequest(const std::shared_ptr<Request>& request);
-    std::vector<std::shared_ptr<Request>> getAllRequests() const { return allRequests; }
-    std::vector<std::shared_ptr<Request>> getPendingRequests() const;
-    std::vector<std::shared_ptr<Request>> getCompletedRequests() const;
+    void recordRequest(const std::shared_ptr<Request>& request); // Track without queueing on the scheduler
+    std::vector<std::shared_ptr<Request>> getAllRequests() const;
+    std::vector<std::shared_ptr<Request>> getPendingRequests() const;   // Within the request history
+    std::vector<std::shared_ptr<Request>> getCompletedRequests() const; // Within the request history
     void clearAllRequests() { allRequests.clear(); }
+    void setRequestHistoryLimit(size_t limit);
+    size_t getRequestHistoryLimit() const { return requestHistoryLimit; }
 
     // Simulation and operation
     void startSimulation();
@@ -73,8 +80,10 @@ public:
     // Statistics and reporting
     double getAverageWaitTime() const;
     double getAverageTravelTime() const;
-    int getTotalRequests() const { return allRequests.size(); }
+    int getTotalRequests() const { return static_cast<int>(statistics->getTotalRequests()); }
     int getCompletedRequestsCount() const;
+    double getWaitTimePercentile(double percentile) const { return statistics->getWaitTimePercentile(percentile); }
+    const RequestStatistics& getStatistics() const { return *statistics; }
     double getSystemUtilization() const;
     std::vector<std::shared_ptr<Elevator>> getMostUtilizedElevators(int count = 3) const;
     std::vector<int> getMostRequestedFloors(int count = 5) const;
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <ostream>
+#include "Scheduler.hpp"
+
+struct DispatchBenchmarkConfig {
+    int floors = 60;
+    int elevatorCount = 24;
+    std::vector<size_t> callCounts = {100, 250, 500, 1000}; // Concurrent hall calls per dispatch
+    size_t iterations = 50;
+    SchedulingAlgorithm algorithm = SchedulingAlgorithm::LOOK;
+    unsigned seed = 3;
+};
+
+struct DispatchBenchmarkRow {
+    size_t calls = 0;
+    double batchMicros = 0.0;      // Scheduler::batchAssign over every call
+    double sequentialMicros = 0.0; // assignRequest then addRequest, one call at a time
+    long long batchCost = 0;       // calculateCost units, queue growth included
+    long long sequentialCost = 0;
+    int batchMaxQueue = 0;
+    int sequentialMaxQueue = 0;
+    size_t unassigned = 0;         // Calls batchAssign left without a car
+};
+
+struct DispatchBenchmarkReport {
+    DispatchBenchmarkConfig config;
+    std::vector<DispatchBenchmarkRow> rows;
+    double wallSeconds = 0.0;
+};
+
+// Times batch dispatch of many simultaneous hall calls against assigning them
+// one at a time, on cars parked at random floors. Both sides are scored with the
+// same objective: calculateCost for each call, with every call already queued on
+// a car adding the queue term for the ones after it.
+class DispatchBenchmark {
+private:
+    DispatchBenchmarkConfig config;
+
+    std::vector<std::shared_ptr<Elevator>> makeElevators(unsigned seed) const;
+    std::vector<std::shared_ptr<Request>> makeCalls(size_t count, unsigned seed) const;
+    static long long totalCost(const std::vector<std::shared_ptr<Elevator>>& elevators,
+                               const std::vector<std::shared_ptr<Request>>& calls,
+                               const std::vector<int>& assignment, int& maxQueue);
+
+public:
+    explicit DispatchBenchmark(const DispatchBenchmarkConfig& config);
+
+    DispatchBenchmarkReport run() const;
+
+    static void printReport(const DispatchBenchmarkReport& report, std::ostream& out);
+};
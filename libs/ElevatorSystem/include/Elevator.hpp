@@ -1,11 +1,14 @@
 #pragma once
 
 #include <vector>
-#include <queue>
+#include <deque>
 #include <memory>
 #include <string>
+#include <chrono>
+#include <functional>
 #include "Floor.hpp"
 #include "Request.hpp"
+#include "StopSet.hpp"
 
 enum class ElevatorState {
     IDLE,
@@ -25,6 +28,11 @@ enum class DoorState {
     CLOSING
 };
 
+struct StopResult {
+    std::vector<std::shared_ptr<Request>> boarded;
+    std::vector<std::shared_ptr<Request>> alighted;
+};
+
 class Elevator {
 private:
     std::string elevatorId;
@@ -39,9 +47,19 @@ private:
     double doorCloseTime; // seconds
     int capacity; // maximum number of passengers
     int currentLoad; // current number of passengers
-    std::vector<bool> floorButtons; // Internal floor buttons
-    std::queue<std::shared_ptr<Request>> requestQueue;
-    std::vector<std::shared_ptr<Request>> completedRequests;
+    std::vector<bool> floorButtons; // Internal floor buttons, indexed by floor - minFloor
+    StopSet upPickups;   // Floors with passengers waiting to go up
+    StopSet downPickups; // Floors with passengers waiting to go down
+    StopSet dropoffs;    // Destination floors of passengers on board
+    std::vector<std::vector<std::shared_ptr<Request>>> upWaiting;   // Indexed by floor - minFloor
+    std::vector<std::vector<std::shared_ptr<Request>>> downWaiting;
+    std::vector<std::vector<std::shared_ptr<Request>>> riding;
+    int waitingCount;
+    int ridingCount;
+    std::deque<std::shared_ptr<Request>> completedRequests; // Most recent completions only
+    size_t completedHistoryLimit;
+    int totalTrips;
+    std::function<void(const std::shared_ptr<Request>&)> completionListener;
     std::chrono::system_clock::time_point lastStateChange;
     bool isOperational;
 
@@ -64,8 +82,8 @@ public:
     int getCapacity() const { return capacity; }
     int getCurrentLoad() const { return currentLoad; }
     bool getIsOperational() const { return isOperational; }
-    std::queue<std::shared_ptr<Request>> getRequestQueue() const { return requestQueue; }
-    std::vector<std::shared_ptr<Request>> getCompletedRequests() const { return completedRequests; }
+    std::vector<std::shared_ptr<Request>> getQueuedRequests() const; // Waiting pickups, in floor order
+    std::vector<std::shared_ptr<Request>> getCompletedRequests() const;
 
     // Setters
     void setCurrentFloor(int floor) { currentFloor = floor; }
@@ -74,14 +92,21 @@ public:
     void setDoorState(DoorState newState) { doorState = newState; }
     void setCurrentLoad(int load) { currentLoad = load; }
     void setIsOperational(bool operational) { isOperational = operational; }
+    void setCompletedHistoryLimit(size_t limit);
+    void setCompletionListener(std::function<void(const std::shared_ptr<Request>&)> listener) { completionListener = std::move(listener); }
 
     // Request management
     bool addRequest(const std::shared_ptr<Request>& request);
-    std::shared_ptr<Request> getNextRequest();
-    void completeRequest(const std::shared_ptr<Request>& request);
+    void completeRequest(const std::shared_ptr<Request>& request,
+                         std::chrono::system_clock::time_point completedAt = std::chrono::system_clock::now());
     void removeRequest(const std::shared_ptr<Request>& request);
-    bool hasRequests() const { return !requestQueue.empty(); }
-    int getRequestCount() const { return requestQueue.size(); }
+    bool hasRequests() const { return waitingCount + ridingCount > 0; }
+    int getRequestCount() const { return waitingCount + ridingCount; }
+
+    // Stop management (LOOK order over the per-direction stop sets)
+    int getNextStop() const; // StopSet::NO_STOP when there is nothing to do
+    StopResult arriveAt(int floor, std::chrono::system_clock::time_point now = std::chrono::system_clock::now());
+    bool hasStopAt(int floor) const;
 
     // Floor button management
     void pressFloorButton(int floor);
@@ -107,5 +132,5 @@ public:
     std::string getDirectionString() const;
     std::string getDoorStateString() const;
     double getUtilizationRate() const; // Returns utilization percentage
-    int getTotalTrips() const { return completedRequests.size(); }
+    int getTotalTrips() const { return totalTrips; }
 }; 
\ No newline at end of file
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <queue>
+#include <unordered_map>
+#include <memory>
+#include <random>
+#include <cstdint>
+#include "Building.hpp"
+
+enum class TrafficPattern {
+    UP_PEAK,     // Lobby to upper floors (morning)
+    DOWN_PEAK,   // Upper floors to lobby (evening)
+    INTERFLOOR,  // Uniform floor to floor
+    FULL_DAY     // Hourly mix of the above
+};
+
+enum class SimEventType {
+    PASSENGER_ARRIVAL,
+    CAR_ARRIVAL,
+    DOOR_OPENED,
+    DOOR_CLOSED,
+    DISPATCH_TICK
+};
+
+struct SimEvent {
+    double time;
+    std::uint64_t sequence; // Tie-breaker so equal-time events pop in schedule order
+    SimEventType type;
+    int carIndex;
+    std::uint64_t token;    // CAR_ARRIVAL events are dropped if the car was retargeted since
+
+    bool operator>(const SimEvent& other) const {
+        return time != other.time ? time > other.time : sequence > other.sequence;
+    }
+};
+
+struct SimulationConfig {
+    double durationSeconds = 24 * 3600.0;
+    double passengersPerHour = 2000.0; // Peak arrival rate
+    TrafficPattern pattern = TrafficPattern::FULL_DAY;
+    double doorDwellTime = 2.0;        // Seconds doors stay open for boarding
+    double dispatchInterval = 0.0;     // > 0 batches hall calls through Scheduler::scheduleRequests
+    unsigned seed = 1;
+};
+
+struct SimulationReport {
+    std::uint64_t passengersGenerated = 0;
+    std::uint64_t passengersDelivered = 0;
+    std::uint64_t passengersUnserved = 0; // Calls still waiting when no car could ever take them
+    std::uint64_t eventsProcessed = 0;
+    double simulatedSeconds = 0.0;
+    double averageWaitTime = 0.0;
+    double averageRideTime = 0.0;
+    double maxWaitTime = 0.0;
+    double wallSeconds = 0.0;
+};
+
+// Event-driven simulation of a Building on a virtual clock. Elevator movement and
+// door cycles are scheduled as discrete events, so a simulated day costs time
+// proportional to the number of events rather than to wall-clock duration.
+// Results are fully determined by the building setup and the config seed.
+class EventSimulator {
+private:
+    struct CarContext {
+        std::shared_ptr<Elevator> elevator;
+        bool busy = false;
+        bool moving = false;
+        int targetFloor = 0;
+        double departPosition = 0.0; // Fractional floor where the current move started
+        double departTime = 0.0;
+        std::uint64_t moveToken = 0;
+    };
+
+    Building& building;
+    SimulationConfig config;
+    double now;
+    std::uint64_t nextSequence;
+    std::priority_queue<SimEvent, std::vector<SimEvent>, std::greater<SimEvent>> events;
+    std::vector<CarContext> cars;
+    std::unordered_map<std::string, int> carIndexById;
+    std::deque<std::shared_ptr<Request>> unassigned;
+    std::unordered_map<const Request*, double> boardedAt;
+    std::vector<int> servedFloors;
+    std::mt19937 rng;
+    SimulationReport report;
+    double totalWait;
+    double totalRide;
+
+public:
+    EventSimulator(Building& building, const SimulationConfig& config);
+
+    SimulationReport run();
+    double getCurrentTime() const { return now; }
+
+    // Virtual clock helpers
+    static std::chrono::system_clock::time_point toTimePoint(double seconds);
+    static double toSeconds(const std::chrono::system_clock::time_point& time);
+
+private:
+    void schedule(double time, SimEventType type, int carIndex = -1, std::uint64_t token = 0);
+    void scheduleNextArrival();
+    double arrivalRateAt(double time) const;
+
+    void handlePassengerArrival();
+    void handleCarArrival(int carIndex, std::uint64_t token);
+    void handleDoorOpened(int carIndex);
+    void handleDoorClosed(int carIndex);
+    void handleDispatchTick();
+
+    void dispatch(const std::shared_ptr<Request>& request);
+    bool retryUnassigned();
+    void startNextLeg(int carIndex);
+    void moveTo(int carIndex, int floor);
+    void retarget(int carIndex);
+};
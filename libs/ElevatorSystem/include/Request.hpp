@@ -25,7 +25,9 @@ private:
     RequestType type;
     RequestStatus status;
     std::chrono::system_clock::time_point requestTime;
+    std::chrono::system_clock::time_point pickupTime;
     std::chrono::system_clock::time_point completionTime;
+    bool pickedUp;
     std::string assignedElevatorId;
     int priority; // Higher number = higher priority
 
@@ -40,12 +42,16 @@ public:
     RequestType getType() const { return type; }
     RequestStatus getStatus() const { return status; }
     std::chrono::system_clock::time_point getRequestTime() const { return requestTime; }
+    std::chrono::system_clock::time_point getPickupTime() const { return pickupTime; }
     std::chrono::system_clock::time_point getCompletionTime() const { return completionTime; }
+    bool hasPickupTime() const { return pickedUp; }
     std::string getAssignedElevatorId() const { return assignedElevatorId; }
     int getPriority() const { return priority; }
 
     // Setters
     void setStatus(RequestStatus newStatus) { status = newStatus; }
+    void setRequestTime(const std::chrono::system_clock::time_point& time) { requestTime = time; }
+    void setPickupTime(const std::chrono::system_clock::time_point& time) { pickupTime = time; pickedUp = true; }
     void setCompletionTime(const std::chrono::system_clock::time_point& time) { completionTime = time; }
     void setAssignedElevatorId(const std::string& elevatorId) { assignedElevatorId = elevatorId; }
     void setPriority(int newPriority) { priority = newPriority; }
@@ -56,7 +62,7 @@ public:
     bool isPending() const { return status == RequestStatus::PENDING; }
     bool isAssigned() const { return status == RequestStatus::ASSIGNED; }
     bool isCompleted() const { return status == RequestStatus::COMPLETED; }
-    int getWaitTime() const; // Returns wait time in seconds
+    int getWaitTime() const; // Returns wait time until pickup in seconds
     int getTotalTime() const; // Returns total processing time in seconds
     std::string getTypeString() const;
     std::string getStatusString() const;
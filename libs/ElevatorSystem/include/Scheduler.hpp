@@ -43,6 +43,9 @@ public:
     void scheduleRequests();
     void optimizeSchedules();
 
+    // Batch dispatch: solves all requests against all elevators in one pass
+    std::vector<std::shared_ptr<Elevator>> batchAssign(const std::vector<std::shared_ptr<Request>>& requests) const;
+
     // Algorithm implementations
     std::shared_ptr<Elevator> fcfsAssign(const std::shared_ptr<Request>& request);
     std::shared_ptr<Elevator> scanAssign(const std::shared_ptr<Request>& request);
@@ -63,4 +66,12 @@ private:
     std::vector<std::shared_ptr<Elevator>> getOperationalElevators() const;
     int getTotalDistance(const std::shared_ptr<Elevator>& elevator, const std::shared_ptr<Request>& request) const;
     bool isDirectionCompatible(const std::shared_ptr<Elevator>& elevator, const std::shared_ptr<Request>& request) const;
+
+    // Helper methods for batch dispatch
+    int dispatchCost(const std::shared_ptr<Elevator>& elevator, const std::shared_ptr<Request>& request) const;
+    int queuePenalty() const;
+    std::vector<int> buildCostMatrix(const std::vector<std::shared_ptr<Request>>& requests,
+                                     const std::vector<std::shared_ptr<Elevator>>& candidates) const;
+    static void solveAssignment(const std::vector<int>& costs, int rows, int cols, int penalty,
+                                std::vector<int>& load, std::vector<int>& assignment);
 }; 
\ No newline at end of file
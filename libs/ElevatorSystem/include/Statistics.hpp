@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include "Request.hpp"
+
+// Log-linear (HDR-style) histogram of durations at millisecond resolution.
+// 16 sub-buckets per power of two keep percentile error within ~3%.
+class LatencyHistogram {
+private:
+    std::vector<std::uint64_t> counts;
+    std::uint64_t total;
+    std::uint64_t maxMillis;
+
+    static size_t bucketIndex(std::uint64_t millis);
+    static std::uint64_t bucketMidpoint(size_t index);
+
+public:
+    LatencyHistogram();
+
+    void record(double seconds);
+    void reset();
+    std::uint64_t getCount() const { return total; }
+    double getMax() const { return maxMillis / 1000.0; }
+    double getPercentile(double percentile) const; // Seconds; percentile in [0, 100]
+};
+
+// Streaming aggregates over request lifecycles, updated as requests are
+// submitted and completed so reporting never rescans request history.
+class RequestStatistics {
+private:
+    int minFloor;
+    std::vector<std::uint64_t> floorRequestCounts; // Indexed by floor - minFloor
+    std::uint64_t totalRequests;
+    std::uint64_t completedRequests;
+    double totalWaitTime;
+    double totalTravelTime;
+    LatencyHistogram waitTimes;
+    LatencyHistogram travelTimes;
+
+    void countFloor(int floor);
+
+public:
+    RequestStatistics(int minFloor, int maxFloor);
+
+    void resizeFloors(int minFloor, int maxFloor);
+    void recordRequest(const Request& request);
+    void recordCompletion(const Request& request);
+    void reset();
+
+    std::uint64_t getTotalRequests() const { return totalRequests; }
+    std::uint64_t getCompletedRequests() const { return completedRequests; }
+    double getAverageWaitTime() const;
+    double getAverageTravelTime() const;
+    double getWaitTimePercentile(double percentile) const { return waitTimes.getPercentile(percentile); }
+    double getTravelTimePercentile(double percentile) const { return travelTimes.getPercentile(percentile); }
+    double getMaxWaitTime() const { return waitTimes.getMax(); }
+    std::uint64_t getFloorRequestCount(int floor) const;
+    std::vector<int> getMostRequestedFloors(int count) const;
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+// Bitset of floors an elevator has to stop at. Insert, remove and membership are
+// O(1); next-stop queries scan 64 floors per word using find-first-set.
+class StopSet {
+private:
+    int minFloor;
+    int maxFloor;
+    std::vector<std::uint64_t> words;
+    int count;
+
+    int toIndex(int floor) const { return floor - minFloor; }
+
+public:
+    static constexpr int NO_STOP = std::numeric_limits<int>::min();
+
+    StopSet(int minFloor, int maxFloor);
+
+    void insert(int floor);
+    void remove(int floor);
+    bool contains(int floor) const;
+    void clear();
+    bool empty() const { return count == 0; }
+    int size() const { return count; }
+
+    // Nearest stop in the given direction, or NO_STOP
+    int nextAtOrAbove(int floor) const;
+    int nextAtOrBelow(int floor) const;
+    int lowest() const { return nextAtOrAbove(minFloor); }
+    int highest() const { return nextAtOrBelow(maxFloor); }
+
+    // Floors in ascending order
+    std::vector<int> toVector() const;
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <ostream>
+#include "EventSimulator.hpp"
+
+// One building configuration in a capacity-planning sweep
+struct SweepConfig {
+    std::string label;
+    int floors = 20;
+    int basementFloors = 0;
+    int elevatorCount = 4;
+    int elevatorCapacity = 8;
+    double elevatorSpeed = 1.0;       // Floors per second
+    SchedulingAlgorithm algorithm = SchedulingAlgorithm::LOOK;
+    SimulationConfig simulation;
+};
+
+struct SweepResult {
+    SweepConfig config;
+    SimulationReport report;
+    double p50WaitTime = 0.0;
+    double p95WaitTime = 0.0;
+    double p99WaitTime = 0.0;
+};
+
+struct ScalingSample {
+    size_t threads = 0;
+    double wallSeconds = 0.0;
+    double speedup = 0.0;    // Relative to the first sample
+    double efficiency = 0.0; // Speedup per thread
+};
+
+// Runs independent Building simulations in parallel on a WorkStealingPool.
+// Every configuration builds its own Building, Scheduler and elevators, so runs
+// share no state and results are identical for any thread count.
+class SweepRunner {
+private:
+    std::vector<SweepConfig> configs;
+
+public:
+    void addConfiguration(const SweepConfig& config);
+    // Cartesian product of car counts, algorithms and traffic patterns over a base config
+    void addGrid(const SweepConfig& base, const std::vector<int>& elevatorCounts,
+                 const std::vector<SchedulingAlgorithm>& algorithms,
+                 const std::vector<TrafficPattern>& patterns);
+    void clearConfigurations() { configs.clear(); }
+    const std::vector<SweepConfig>& getConfigurations() const { return configs; }
+
+    // Results come back in configuration order
+    std::vector<SweepResult> run(size_t threadCount) const;
+    static SweepResult runSingle(const SweepConfig& config);
+
+    // Times the whole sweep at each thread count
+    std::vector<ScalingSample> measureScaling(const std::vector<size_t>& threadCounts) const;
+
+    static void printResults(const std::vector<SweepResult>& results, std::ostream& out);
+    static void writeCsv(const std::vector<SweepResult>& results, std::ostream& out);
+    static void printScaling(const std::vector<ScalingSample>& samples, std::ostream& out);
+
+    static std::string algorithmName(SchedulingAlgorithm algorithm);
+    static std::string patternName(TrafficPattern pattern);
+};
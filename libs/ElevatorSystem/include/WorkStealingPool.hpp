@@ -0,0 +1,50 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+// Fixed-size thread pool with one task deque per worker. A worker pops its own
+// newest task first and, when empty, steals the oldest task from another worker,
+// so uneven task costs still keep every core busy.
+class WorkStealingPool {
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> nextQueue;
+    size_t queuedTasks;                  // Guarded by stateMutex
+    std::atomic<size_t> unfinishedTasks;
+    std::atomic<std::uint64_t> stolenTasks;
+    std::mutex stateMutex;
+    std::condition_variable workAvailable;
+    std::condition_variable allDone;
+    bool shuttingDown;
+
+    void workerLoop(size_t index);
+    bool popLocal(size_t index, std::function<void()>& task);
+    bool steal(size_t thief, std::function<void()>& task);
+
+public:
+    explicit WorkStealingPool(size_t threadCount = std::thread::hardware_concurrency());
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    void submit(std::function<void()> task);
+    void waitIdle(); // Blocks until every submitted task has finished
+
+    size_t getThreadCount() const { return workers.size(); }
+    std::uint64_t getStolenTaskCount() const { return stolenTasks.load(); }
+};
@@ -6,7 +6,9 @@
 Building::Building(const std::string& buildingId, const std::string& buildingName, 
                    int totalFloors, int basementFloors)
     : buildingId(buildingId), buildingName(buildingName), totalFloors(totalFloors),
-      basementFloors(basementFloors), isSimulationRunning(false) {
+      basementFloors(basementFloors), requestHistoryLimit(10000),
+      statistics(std::make_shared<RequestStatistics>(-basementFloors, totalFloors)),
+      isSimulationRunning(false) {
     
     initializeFloors();
     scheduler = std::make_shared<Scheduler>();
@@ -23,6 +25,7 @@ void Building::setBasementFloors(int basements) {
 }
 
 void Building::initializeFloors() {
+    statistics->resizeFloors(-basementFloors, totalFloors);
     floors.clear();
     for (int i = -basementFloors; i <= totalFloors; ++i) {
         if (i != 0) { // Skip floor 0
@@ -51,6 +54,11 @@ std::vector<std::shared_ptr<Floor>> Building::getFloorsWithRequests() const {
 }
 
 void Building::addElevator(const std::shared_ptr<Elevator>& elevator) {
+    // Completions feed the running statistics as they happen
+    auto stats = statistics;
+    elevator->setCompletionListener([stats](const std::shared_ptr<Request>& request) {
+        stats->recordCompletion(*request);
+    });
     elevators.push_back(elevator);
     if (scheduler) {
         scheduler->addElevator(elevator);
@@ -140,13 +148,34 @@ std::shared_ptr<Request> Building::createInternalRequest(int sourceFloor, int de
 void Building::submitRequest(const std::shared_ptr<Request>& request) {
     if (!request) return;
     
-    allRequests.push_back(request);
+    recordRequest(request);
     
     if (scheduler) {
         scheduler->addRequest(request);
     }
 }
 
+void Building::recordRequest(const std::shared_ptr<Request>& request) {
+    if (!request) return;
+
+    statistics->recordRequest(*request);
+    allRequests.push_back(request);
+    if (allRequests.size() > requestHistoryLimit) {
+        allRequests.pop_front();
+    }
+}
+
+void Building::setRequestHistoryLimit(size_t limit) {
+    requestHistoryLimit = limit;
+    while (allRequests.size() > requestHistoryLimit) {
+        allRequests.pop_front();
+    }
+}
+
+std::vector<std::shared_ptr<Request>> Building::getAllRequests() const {
+    return std::vector<std::shared_ptr<Request>>(allRequests.begin(), allRequests.end());
+}
+
 std::vector<std::shared_ptr<Request>> Building::getPendingRequests() const {
     std::vector<std::shared_ptr<Request>> pending;
     for (const auto& request : allRequests) {
@@ -179,39 +208,41 @@ void Building::stopSimulation() {
 void Building::stepSimulation() {
     if (!isSimulationRunning) return;
     
-    // Process all elevators
+    // Process all elevators: one floor of travel or one stop per step
     for (auto& elevator : elevators) {
         if (!elevator->getIsOperational()) continue;
         
-        // Get next request for this elevator
-        auto request = elevator->getNextRequest();
-        if (request) {
-            // Process the request
-            if (elevator->getCurrentFloor() == request->getSourceFloor()) {
-                // Elevator has reached the source floor
-                elevator->openDoor();
-                
-                // Simulate passenger boarding
-                if (elevator->getDoorState() == DoorState::OPEN) {
-                    elevator->closeDoor();
-                    request->setStatus(RequestStatus::ASSIGNED);
-                }
-            } else {
-                // Move elevator towards the request
-                if (elevator->getCurrentFloor() < request->getSourceFloor()) {
-                    elevator->setDirection(Direction::UP);
-                    elevator->setState(ElevatorState::MOVING_UP);
-                } else {
-                    elevator->setDirection(Direction::DOWN);
-                    elevator->setState(ElevatorState::MOVING_DOWN);
-                }
-                elevator->move();
-            }
-        } else {
+        int nextStop = elevator->getNextStop();
+        if (nextStop == StopSet::NO_STOP) {
             // No requests, return to idle
             if (elevator->isMoving()) {
                 elevator->stop();
             }
+            continue;
+        }
+
+        if (elevator->getCurrentFloor() != nextStop) {
+            // Move elevator towards the next stop
+            if (elevator->getCurrentFloor() < nextStop) {
+                elevator->setDirection(Direction::UP);
+                elevator->setState(ElevatorState::MOVING_UP);
+            } else {
+                elevator->setDirection(Direction::DOWN);
+                elevator->setState(ElevatorState::MOVING_DOWN);
+            }
+            elevator->move();
+        }
+
+        if (elevator->getCurrentFloor() == nextStop) {
+            // Doors open and close within the step
+            elevator->setState(ElevatorState::IDLE);
+            elevator->arriveAt(nextStop);
+
+            auto floor = getFloor(nextStop);
+            if (floor) {
+                if (elevator->getDirection() != Direction::DOWN) floor->clearUpRequest();
+                if (elevator->getDirection() != Direction::UP) floor->clearDownRequest();
+            }
         }
     }
     
@@ -230,31 +261,15 @@ void Building::runSimulation(int steps) {
 }
 
 double Building::getAverageWaitTime() const {
-    auto completed = getCompletedRequests();
-    if (completed.empty()) return 0.0;
-    
-    double totalWaitTime = 0.0;
-    for (const auto& request : completed) {
-        totalWaitTime += request->getWaitTime();
-    }
-    
-    return totalWaitTime / completed.size();
+    return statistics->getAverageWaitTime();
 }
 
 double Building::getAverageTravelTime() const {
-    auto completed = getCompletedRequests();
-    if (completed.empty()) return 0.0;
-    
-    double totalTravelTime = 0.0;
-    for (const auto& request : completed) {
-        totalTravelTime += request->getTotalTime();
-    }
-    
-    return totalTravelTime / completed.size();
+    return statistics->getAverageTravelTime();
 }
 
 int Building::getCompletedRequestsCount() const {
-    return getCompletedRequests().size();
+    return static_cast<int>(statistics->getCompletedRequests());
 }
 
 double Building::getSystemUtilization() const {
@@ -285,31 +300,7 @@ std::vector<std::shared_ptr<Elevator>> Building::getMostUtilizedElevators(int co
 }
 
 std::vector<int> Building::getMostRequestedFloors(int count) const {
-    std::unordered_map<int, int> floorRequestCounts;
-    
-    for (const auto& request : allRequests) {
-        floorRequestCounts[request->getSourceFloor()]++;
-        if (request->getType() == RequestType::INTERNAL) {
-            floorRequestCounts[request->getDestinationFloor()]++;
-        }
-    }
-    
-    std::vector<std::pair<int, int>> sortedFloors;
-    for (const auto& pair : floorRequestCounts) {
-        sortedFloors.push_back(pair);
-    }
-    
-    std::sort(sortedFloors.begin(), sortedFloors.end(),
-        [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
-            return a.second > b.second;
-        });
-    
-    std::vector<int> result;
-    for (int i = 0; i < count && i < sortedFloors.size(); ++i) {
-        result.push_back(sortedFloors[i].first);
-    }
-    
-    return result;
+    return statistics->getMostRequestedFloors(count);
 }
 
 std::unordered_map<std::string, int> Building::getElevatorTripCounts() const {
@@ -364,6 +355,7 @@ void Building::resetSystem() {
     
     // Clear all requests
     allRequests.clear();
+    statistics->reset();
     if (scheduler) {
         scheduler->clearPendingRequests();
     }
@@ -427,6 +419,10 @@ void Building::printStatistics() const {
               << getAverageWaitTime() << " seconds" << std::endl;
     std::cout << "Average Travel Time: " << std::fixed << std::setprecision(2) 
               << getAverageTravelTime() << " seconds" << std::endl;
+    std::cout << "Wait Time p50/p95/p99: " << std::fixed << std::setprecision(2)
+              << statistics->getWaitTimePercentile(50) << " / "
+              << statistics->getWaitTimePercentile(95) << " / "
+              << statistics->getWaitTimePercentile(99) << " seconds" << std::endl;
     std::cout << "System Utilization: " << std::fixed << std::setprecision(2) 
               << getSystemUtilization() << "%" << std::endl;
     
@@ -0,0 +1,151 @@
+#include "../include/DispatchBenchmark.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <random>
+
+namespace {
+    double elapsedMicros(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+DispatchBenchmark::DispatchBenchmark(const DispatchBenchmarkConfig& config) : config(config) {
+    this->config.floors = std::max(2, config.floors);
+    this->config.elevatorCount = std::max(1, config.elevatorCount);
+    this->config.iterations = std::max<size_t>(1, config.iterations);
+}
+
+std::vector<std::shared_ptr<Elevator>> DispatchBenchmark::makeElevators(unsigned seed) const {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> floor(1, config.floors);
+    std::vector<std::shared_ptr<Elevator>> elevators;
+    for (int i = 0; i < config.elevatorCount; ++i) {
+        auto elevator = std::make_shared<Elevator>("E" + std::to_string(i + 1), config.floors);
+        elevator->setCurrentFloor(floor(rng));
+        elevators.push_back(elevator);
+    }
+    return elevators;
+}
+
+std::vector<std::shared_ptr<Request>> DispatchBenchmark::makeCalls(size_t count, unsigned seed) const {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> floor(1, config.floors);
+    std::vector<std::shared_ptr<Request>> calls;
+    calls.reserve(count);
+    while (calls.size() < count) {
+        int source = floor(rng), destination = floor(rng);
+        if (source == destination) continue;
+        Direction direction = destination > source ? Direction::UP : Direction::DOWN;
+        calls.push_back(std::make_shared<Request>(source, destination, direction, RequestType::EXTERNAL));
+    }
+    return calls;
+}
+
+long long DispatchBenchmark::totalCost(const std::vector<std::shared_ptr<Elevator>>& elevators,
+                                       const std::vector<std::shared_ptr<Request>>& calls,
+                                       const std::vector<int>& assignment, int& maxQueue) {
+    std::vector<int> queued(elevators.size(), 0);
+    long long total = 0;
+    for (size_t i = 0; i < calls.size(); ++i) {
+        if (assignment[i] < 0) continue;
+        const auto& elevator = elevators[assignment[i]];
+        int& queue = queued[assignment[i]];
+        total += elevator->getDistanceToFloor(calls[i]->getSourceFloor()) * 2 + queue * 5 +
+                 elevator->getCurrentLoad() * 3;
+        queue++;
+    }
+    maxQueue = queued.empty() ? 0 : *std::max_element(queued.begin(), queued.end());
+    return total;
+}
+
+DispatchBenchmarkReport DispatchBenchmark::run() const {
+    auto wallStart = std::chrono::steady_clock::now();
+    DispatchBenchmarkReport report;
+    report.config = config;
+
+    for (size_t calls : config.callCounts) {
+        DispatchBenchmarkRow row;
+        row.calls = calls;
+
+        for (size_t k = 0; k < config.iterations; ++k) {
+            unsigned seed = config.seed + static_cast<unsigned>(k);
+            auto requests = makeCalls(calls, seed);
+
+            // Batch: one solve over the whole request x car matrix
+            auto elevators = makeElevators(seed);
+            Scheduler batch(config.algorithm);
+            for (const auto& elevator : elevators) {
+                batch.addElevator(elevator);
+            }
+            auto start = std::chrono::steady_clock::now();
+            auto chosen = batch.batchAssign(requests);
+            row.batchMicros += elapsedMicros(start);
+
+            std::vector<int> batchAssignment(calls, -1);
+            for (size_t i = 0; i < calls; ++i) {
+                for (size_t col = 0; chosen[i] && col < elevators.size(); ++col) {
+                    if (elevators[col] == chosen[i]) batchAssignment[i] = static_cast<int>(col);
+                }
+                if (batchAssignment[i] < 0) row.unassigned++;
+            }
+
+            // Sequential: each call sees the queues left by the ones before it
+            auto sequentialElevators = makeElevators(seed);
+            Scheduler sequential(config.algorithm);
+            for (const auto& elevator : sequentialElevators) {
+                sequential.addElevator(elevator);
+            }
+            std::vector<std::shared_ptr<Elevator>> picked(calls);
+            start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < calls; ++i) {
+                picked[i] = sequential.assignRequest(requests[i]);
+                if (picked[i]) picked[i]->addRequest(requests[i]);
+            }
+            row.sequentialMicros += elapsedMicros(start);
+
+            std::vector<int> sequentialAssignment(calls, -1);
+            for (size_t i = 0; i < calls; ++i) {
+                for (size_t col = 0; picked[i] && col < sequentialElevators.size(); ++col) {
+                    if (sequentialElevators[col] == picked[i]) sequentialAssignment[i] = static_cast<int>(col);
+                }
+            }
+
+            int maxQueue = 0;
+            row.batchCost += totalCost(elevators, requests, batchAssignment, maxQueue);
+            row.batchMaxQueue = std::max(row.batchMaxQueue, maxQueue);
+            row.sequentialCost += totalCost(elevators, requests, sequentialAssignment, maxQueue);
+            row.sequentialMaxQueue = std::max(row.sequentialMaxQueue, maxQueue);
+        }
+
+        double iterations = static_cast<double>(config.iterations);
+        row.batchMicros /= iterations;
+        row.sequentialMicros /= iterations;
+        row.batchCost = static_cast<long long>(row.batchCost / iterations);
+        row.sequentialCost = static_cast<long long>(row.sequentialCost / iterations);
+        report.rows.push_back(row);
+    }
+
+    report.wallSeconds = elapsedMicros(wallStart) / 1e6;
+    return report;
+}
+
+void DispatchBenchmark::printReport(const DispatchBenchmarkReport& report, std::ostream& out) {
+    out << "Dispatch: " << report.config.elevatorCount << " cars, " << report.config.floors << " floors, "
+        << report.config.iterations << " runs per row\n";
+    out << std::right << std::setw(8) << "Calls"
+        << std::setw(12) << "Batch(us)" << std::setw(12) << "Seq(us)"
+        << std::setw(12) << "BatchCost" << std::setw(12) << "SeqCost"
+        << std::setw(10) << "BatchMaxQ" << std::setw(10) << "SeqMaxQ"
+        << std::setw(12) << "Unassigned" << "\n";
+
+    out << std::fixed << std::setprecision(1);
+    for (const auto& row : report.rows) {
+        out << std::setw(8) << row.calls
+            << std::setw(12) << row.batchMicros << std::setw(12) << row.sequentialMicros
+            << std::setw(12) << row.batchCost << std::setw(12) << row.sequentialCost
+            << std::setw(10) << row.batchMaxQueue << std::setw(10) << row.sequentialMaxQueue
+            << std::setw(12) << row.unassigned << "\n";
+    }
+    out << "Wall time: " << std::setprecision(2) << report.wallSeconds << " s\n";
+}
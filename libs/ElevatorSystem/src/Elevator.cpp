@@ -1,5 +1,23 @@
 #include "../include/Elevator.hpp"
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
+
+namespace {
+
+Direction travelDirection(const Request& request) {
+    if (request.getDestinationFloor() > request.getSourceFloor()) return Direction::UP;
+    if (request.getDestinationFloor() < request.getSourceFloor()) return Direction::DOWN;
+    return request.getDirection() == Direction::DOWN ? Direction::DOWN : Direction::UP;
+}
+
+int closerStop(int a, int b, int from) {
+    if (a == StopSet::NO_STOP) return b;
+    if (b == StopSet::NO_STOP) return a;
+    return std::abs(a - from) <= std::abs(b - from) ? a : b;
+}
+
+}
 
 Elevator::Elevator(const std::string& elevatorId, int maxFloor, int minFloor, 
                    double speed, double doorOpenTime, double doorCloseTime, int capacity)
@@ -7,10 +25,17 @@ Elevator::Elevator(const std::string& elevatorId, int maxFloor, int minFloor,
       state(ElevatorState::IDLE), doorState(DoorState::CLOSED), maxFloor(maxFloor),
       minFloor(minFloor), speed(speed), doorOpenTime(doorOpenTime), 
       doorCloseTime(doorCloseTime), capacity(capacity), currentLoad(0),
+      upPickups(minFloor, maxFloor), downPickups(minFloor, maxFloor), dropoffs(minFloor, maxFloor),
+      waitingCount(0), ridingCount(0), completedHistoryLimit(1000), totalTrips(0),
       lastStateChange(std::chrono::system_clock::now()), isOperational(true) {
     
+    size_t floors = maxFloor >= minFloor ? maxFloor - minFloor + 1 : 0;
+
     // Initialize floor buttons
-    floorButtons.resize(maxFloor + 1, false);
+    floorButtons.resize(floors, false);
+    upWaiting.resize(floors);
+    downWaiting.resize(floors);
+    riding.resize(floors);
 }
 
 void Elevator::setState(ElevatorState newState) {
@@ -23,57 +48,232 @@ bool Elevator::addRequest(const std::shared_ptr<Request>& request) {
         return false;
     }
     
-    requestQueue.push(request);
-    return true;
-}
+    int source = request->getSourceFloor();
+    if (source < minFloor || source > maxFloor) {
+        return false;
+    }
 
-std::shared_ptr<Request> Elevator::getNextRequest() {
-    if (requestQueue.empty()) {
-        return nullptr;
+    if (travelDirection(*request) == Direction::UP) {
+        upWaiting[source - minFloor].push_back(request);
+        upPickups.insert(source);
+    } else {
+        downWaiting[source - minFloor].push_back(request);
+        downPickups.insert(source);
     }
-    
-    auto request = requestQueue.front();
-    requestQueue.pop();
-    return request;
+    waitingCount++;
+    return true;
 }
 
-void Elevator::completeRequest(const std::shared_ptr<Request>& request) {
+void Elevator::completeRequest(const std::shared_ptr<Request>& request,
+                               std::chrono::system_clock::time_point completedAt) {
     request->setStatus(RequestStatus::COMPLETED);
-    request->setCompletionTime(std::chrono::system_clock::now());
+    request->setCompletionTime(completedAt);
+    totalTrips++;
+
     completedRequests.push_back(request);
+    if (completedRequests.size() > completedHistoryLimit) {
+        completedRequests.pop_front();
+    }
+
+    if (completionListener) {
+        completionListener(request);
+    }
+}
+
+std::vector<std::shared_ptr<Request>> Elevator::getCompletedRequests() const {
+    return std::vector<std::shared_ptr<Request>>(completedRequests.begin(), completedRequests.end());
+}
+
+void Elevator::setCompletedHistoryLimit(size_t limit) {
+    completedHistoryLimit = limit;
+    while (completedRequests.size() > completedHistoryLimit) {
+        completedRequests.pop_front();
+    }
 }
 
 void Elevator::removeRequest(const std::shared_ptr<Request>& request) {
-    // This is a simplified implementation
-    // In a real system, you'd need to search and remove from the queue
-    std::queue<std::shared_ptr<Request>> tempQueue;
-    
-    while (!requestQueue.empty()) {
-        auto req = requestQueue.front();
-        requestQueue.pop();
-        if (req->getRequestId() != request->getRequestId()) {
-            tempQueue.push(req);
+    auto sameRequest = [&request](const std::shared_ptr<Request>& req) {
+        return req->getRequestId() == request->getRequestId();
+    };
+
+    // Only the floor bucket the request was filed under is searched
+    int source = request->getSourceFloor();
+    if (source >= minFloor && source <= maxFloor) {
+        bool up = travelDirection(*request) == Direction::UP;
+        auto& waiting = up ? upWaiting[source - minFloor] : downWaiting[source - minFloor];
+        auto it = std::find_if(waiting.begin(), waiting.end(), sameRequest);
+        if (it != waiting.end()) {
+            waiting.erase(it);
+            waitingCount--;
+            if (waiting.empty()) {
+                (up ? upPickups : downPickups).remove(source);
+            }
+            return;
         }
     }
-    
-    requestQueue = tempQueue;
+
+    int destination = request->getDestinationFloor();
+    if (destination >= minFloor && destination <= maxFloor) {
+        auto& onBoard = riding[destination - minFloor];
+        auto it = std::find_if(onBoard.begin(), onBoard.end(), sameRequest);
+        if (it != onBoard.end()) {
+            onBoard.erase(it);
+            ridingCount--;
+            if (onBoard.empty()) {
+                dropoffs.remove(destination);
+            }
+        }
+    }
+}
+
+std::vector<std::shared_ptr<Request>> Elevator::getQueuedRequests() const {
+    std::vector<std::shared_ptr<Request>> queued;
+    queued.reserve(waitingCount);
+    for (int floor : upPickups.toVector()) {
+        const auto& waiting = upWaiting[floor - minFloor];
+        queued.insert(queued.end(), waiting.begin(), waiting.end());
+    }
+    for (int floor : downPickups.toVector()) {
+        const auto& waiting = downWaiting[floor - minFloor];
+        queued.insert(queued.end(), waiting.begin(), waiting.end());
+    }
+    return queued;
+}
+
+bool Elevator::hasStopAt(int floor) const {
+    return upPickups.contains(floor) || downPickups.contains(floor) || dropoffs.contains(floor);
+}
+
+int Elevator::getNextStop() const {
+    const int none = StopSet::NO_STOP;
+    // A full car only stops to let passengers off
+    bool full = currentLoad >= capacity && !dropoffs.empty();
+    int from = currentFloor;
+
+    // Nearest stop ahead that is served while travelling this way
+    auto ahead = [&](bool up) {
+        int stop = up ? dropoffs.nextAtOrAbove(from) : dropoffs.nextAtOrBelow(from);
+        if (!full) {
+            int pickup = up ? upPickups.nextAtOrAbove(from) : downPickups.nextAtOrBelow(from);
+            stop = closerStop(stop, pickup, from);
+        }
+        return stop;
+    };
+
+    // Farthest opposite-direction caller on this side, where the car turns around
+    auto turnaround = [&](bool up) {
+        if (full) return none;
+        int stop = up ? downPickups.highest() : upPickups.lowest();
+        if (stop == none || (up ? stop < from : stop > from)) return none;
+        return stop;
+    };
+
+    auto nextStop = [&](bool up) {
+        int stop = ahead(up);
+        return stop != none ? stop : turnaround(up);
+    };
+
+    if (direction == Direction::NONE) {
+        return closerStop(nextStop(true), nextStop(false), from);
+    }
+
+    bool up = direction == Direction::UP;
+    int stop = nextStop(up);
+    return stop != none ? stop : nextStop(!up);
+}
+
+StopResult Elevator::arriveAt(int floor, std::chrono::system_clock::time_point now) {
+    StopResult result;
+    currentFloor = floor;
+    if (floor < minFloor || floor > maxFloor) {
+        return result;
+    }
+    int index = floor - minFloor;
+
+    // Unload
+    auto& leaving = riding[index];
+    for (const auto& request : leaving) {
+        completeRequest(request, now);
+        result.alighted.push_back(request);
+    }
+    ridingCount -= static_cast<int>(leaving.size());
+    currentLoad = std::max(0, currentLoad - static_cast<int>(leaving.size()));
+    leaving.clear();
+    dropoffs.remove(floor);
+    clearFloorButton(floor);
+
+    // Keep the current direction while there is work ahead, otherwise turn around here
+    auto workAbove = [&]() {
+        return floor < maxFloor && (dropoffs.nextAtOrAbove(floor + 1) != StopSet::NO_STOP ||
+                                    upPickups.nextAtOrAbove(floor + 1) != StopSet::NO_STOP ||
+                                    downPickups.nextAtOrAbove(floor + 1) != StopSet::NO_STOP);
+    };
+    auto workBelow = [&]() {
+        return floor > minFloor && (dropoffs.nextAtOrBelow(floor - 1) != StopSet::NO_STOP ||
+                                    upPickups.nextAtOrBelow(floor - 1) != StopSet::NO_STOP ||
+                                    downPickups.nextAtOrBelow(floor - 1) != StopSet::NO_STOP);
+    };
+
+    bool upHere = !upWaiting[index].empty();
+    bool downHere = !downWaiting[index].empty();
+    Direction serve = direction;
+    if (serve == Direction::UP && !upHere && !workAbove()) {
+        serve = downHere ? Direction::DOWN : Direction::NONE;
+    } else if (serve == Direction::DOWN && !downHere && !workBelow()) {
+        serve = upHere ? Direction::UP : Direction::NONE;
+    }
+    if (serve == Direction::NONE) {
+        serve = upHere ? Direction::UP : (downHere ? Direction::DOWN : Direction::NONE);
+    }
+
+    // Board waiting passengers headed the served way, up to capacity
+    if (serve != Direction::NONE) {
+        auto& waiting = serve == Direction::UP ? upWaiting[index] : downWaiting[index];
+        size_t boarded = 0;
+        while (boarded < waiting.size() && currentLoad < capacity) {
+            const auto& request = waiting[boarded++];
+            request->setPickupTime(now);
+            result.boarded.push_back(request);
+
+            int destination = request->getDestinationFloor();
+            if (destination == floor || destination < minFloor || destination > maxFloor) {
+                completeRequest(request, now); // Hall call without a known destination
+                result.alighted.push_back(request);
+                continue;
+            }
+
+            riding[destination - minFloor].push_back(request);
+            dropoffs.insert(destination);
+            pressFloorButton(destination);
+            currentLoad++;
+            ridingCount++;
+        }
+        waiting.erase(waiting.begin(), waiting.begin() + boarded);
+        waitingCount -= static_cast<int>(boarded);
+        if (waiting.empty()) {
+            (serve == Direction::UP ? upPickups : downPickups).remove(floor);
+        }
+    }
+
+    direction = hasRequests() ? serve : Direction::NONE;
+    return result;
 }
 
 void Elevator::pressFloorButton(int floor) {
     if (floor >= minFloor && floor <= maxFloor) {
-        floorButtons[floor] = true;
+        floorButtons[floor - minFloor] = true;
     }
 }
 
 void Elevator::clearFloorButton(int floor) {
     if (floor >= minFloor && floor <= maxFloor) {
-        floorButtons[floor] = false;
+        floorButtons[floor - minFloor] = false;
     }
 }
 
 bool Elevator::isFloorButtonPressed(int floor) const {
     if (floor >= minFloor && floor <= maxFloor) {
-        return floorButtons[floor];
+        return floorButtons[floor - minFloor];
     }
     return false;
 }
@@ -81,7 +281,7 @@ bool Elevator::isFloorButtonPressed(int floor) const {
 std::vector<int> Elevator::getPressedFloorButtons() const {
     std::vector<int> pressedFloors;
     for (int i = minFloor; i <= maxFloor; ++i) {
-        if (floorButtons[i]) {
+        if (floorButtons[i - minFloor]) {
             pressedFloors.push_back(i);
         }
     }
@@ -195,7 +395,7 @@ std::string Elevator::getDoorStateString() const {
 }
 
 double Elevator::getUtilizationRate() const {
-    if (completedRequests.empty()) return 0.0;
+    if (totalTrips == 0) return 0.0;
     
     auto now = std::chrono::system_clock::now();
     auto totalTime = std::chrono::duration_cast<std::chrono::seconds>(now - lastStateChange).count();
@@ -203,5 +403,5 @@ double Elevator::getUtilizationRate() const {
     if (totalTime == 0) return 0.0;
     
     // Calculate utilization based on completed requests and time
-    return (completedRequests.size() * 100.0) / totalTime;
+    return (totalTrips * 100.0) / totalTime;
 } 
\ No newline at end of file
@@ -0,0 +1,323 @@
+#include "../include/EventSimulator.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace {
+
+// Relative arrival rate per hour of day for FULL_DAY traffic
+const double HOURLY_PROFILE[24] = {
+    0.02, 0.01, 0.01, 0.01, 0.02, 0.05, 0.15, 0.60,
+    1.00, 0.60, 0.35, 0.40, 0.70, 0.60, 0.35, 0.35,
+    0.45, 0.90, 0.60, 0.30, 0.15, 0.10, 0.05, 0.03
+};
+
+int hourOfDay(double seconds) {
+    return static_cast<int>(std::fmod(seconds / 3600.0, 24.0));
+}
+
+}
+
+EventSimulator::EventSimulator(Building& building, const SimulationConfig& config)
+    : building(building), config(config), now(0.0), nextSequence(0),
+      rng(config.seed), totalWait(0.0), totalRide(0.0) {
+
+    auto elevators = building.getAllElevators();
+    for (size_t i = 0; i < elevators.size(); ++i) {
+        CarContext car;
+        car.elevator = elevators[i];
+        car.targetFloor = elevators[i]->getCurrentFloor();
+        cars.push_back(car);
+        carIndexById[elevators[i]->getElevatorId()] = static_cast<int>(i);
+    }
+
+    for (const auto& floor : building.getAllFloors()) {
+        servedFloors.push_back(floor->getFloorNumber());
+    }
+}
+
+std::chrono::system_clock::time_point EventSimulator::toTimePoint(double seconds) {
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::duration<double>(seconds)));
+}
+
+double EventSimulator::toSeconds(const std::chrono::system_clock::time_point& time) {
+    return std::chrono::duration<double>(time.time_since_epoch()).count();
+}
+
+SimulationReport EventSimulator::run() {
+    auto wallStart = std::chrono::steady_clock::now();
+
+    if (servedFloors.size() >= 2 && config.passengersPerHour > 0) {
+        scheduleNextArrival();
+        if (config.dispatchInterval > 0) {
+            schedule(config.dispatchInterval, SimEventType::DISPATCH_TICK);
+        }
+    }
+
+    while (!events.empty()) {
+        SimEvent event = events.top();
+        events.pop();
+        now = event.time;
+        report.eventsProcessed++;
+
+        switch (event.type) {
+            case SimEventType::PASSENGER_ARRIVAL: handlePassengerArrival(); break;
+            case SimEventType::CAR_ARRIVAL: handleCarArrival(event.carIndex, event.token); break;
+            case SimEventType::DOOR_OPENED: handleDoorOpened(event.carIndex); break;
+            case SimEventType::DOOR_CLOSED: handleDoorClosed(event.carIndex); break;
+            case SimEventType::DISPATCH_TICK: handleDispatchTick(); break;
+        }
+    }
+
+    auto scheduler = building.getScheduler();
+    report.passengersUnserved = unassigned.size() + (scheduler ? scheduler->getPendingRequests().size() : 0);
+    report.simulatedSeconds = now;
+    if (report.passengersDelivered > 0) {
+        report.averageWaitTime = totalWait / report.passengersDelivered;
+        report.averageRideTime = totalRide / report.passengersDelivered;
+    }
+    report.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    return report;
+}
+
+void EventSimulator::schedule(double time, SimEventType type, int carIndex, std::uint64_t token) {
+    events.push({time, nextSequence++, type, carIndex, token});
+}
+
+double EventSimulator::arrivalRateAt(double time) const {
+    double perHour = config.passengersPerHour;
+    if (config.pattern == TrafficPattern::FULL_DAY) {
+        perHour *= HOURLY_PROFILE[hourOfDay(time)];
+    }
+    return perHour / 3600.0;
+}
+
+void EventSimulator::scheduleNextArrival() {
+    // Thinning: draw at the peak rate and accept in proportion to the current rate
+    double peakRate = config.passengersPerHour / 3600.0;
+    std::exponential_distribution<double> gap(peakRate);
+    std::uniform_real_distribution<double> accept(0.0, 1.0);
+
+    double time = now;
+    do {
+        time += gap(rng);
+        if (time >= config.durationSeconds) {
+            return;
+        }
+    } while (accept(rng) * peakRate > arrivalRateAt(time));
+
+    schedule(time, SimEventType::PASSENGER_ARRIVAL);
+}
+
+void EventSimulator::handlePassengerArrival() {
+    scheduleNextArrival();
+
+    int lobby = building.isValidFloor(1) ? 1 : servedFloors.front();
+    std::uniform_int_distribution<size_t> pickFloor(0, servedFloors.size() - 1);
+    std::uniform_real_distribution<double> mix(0.0, 1.0);
+
+    // Share of incoming (from lobby) and outgoing (to lobby) trips
+    double incoming = 0.2, outgoing = 0.2;
+    switch (config.pattern) {
+        case TrafficPattern::UP_PEAK: incoming = 0.9; outgoing = 0.05; break;
+        case TrafficPattern::DOWN_PEAK: incoming = 0.05; outgoing = 0.9; break;
+        case TrafficPattern::INTERFLOOR: incoming = 0.0; outgoing = 0.0; break;
+        case TrafficPattern::FULL_DAY: {
+            int hour = hourOfDay(now);
+            if (hour >= 7 && hour <= 9) { incoming = 0.8; outgoing = 0.05; }
+            else if (hour >= 16 && hour <= 18) { incoming = 0.05; outgoing = 0.8; }
+            else if (hour >= 12 && hour <= 13) { incoming = 0.4; outgoing = 0.4; }
+            break;
+        }
+    }
+
+    int source, destination;
+    double roll = mix(rng);
+    do {
+        source = servedFloors[pickFloor(rng)];
+        destination = servedFloors[pickFloor(rng)];
+        if (roll < incoming) source = lobby;
+        else if (roll < incoming + outgoing) destination = lobby;
+    } while (source == destination);
+
+    Direction direction = destination > source ? Direction::UP : Direction::DOWN;
+    auto request = std::make_shared<Request>(source, destination, direction, RequestType::EXTERNAL);
+    request->setRequestTime(toTimePoint(now));
+    building.recordRequest(request);
+    report.passengersGenerated++;
+
+    auto scheduler = building.getScheduler();
+    if (config.dispatchInterval > 0 && scheduler) {
+        scheduler->addRequest(request);
+    } else {
+        dispatch(request);
+    }
+}
+
+void EventSimulator::handleDispatchTick() {
+    auto scheduler = building.getScheduler();
+    if (!scheduler) return;
+
+    size_t waitingBefore = scheduler->getPendingRequests().size() + unassigned.size();
+    scheduler->scheduleRequests();
+    bool progress = retryUnassigned();
+
+    bool anyBusy = false;
+    for (size_t i = 0; i < cars.size(); ++i) {
+        if (!cars[i].busy && cars[i].elevator->hasRequests()) {
+            startNextLeg(static_cast<int>(i));
+        }
+        anyBusy = anyBusy || cars[i].busy;
+    }
+
+    // Keep ticking past the last arrival until every call has a car. Calls that wait
+    // through a tick with every car idle can never be taken; they end the run as unserved.
+    size_t waiting = scheduler->getPendingRequests().size() + unassigned.size();
+    progress = progress || waiting < waitingBefore;
+    if (now < config.durationSeconds || (waiting > 0 && (anyBusy || progress))) {
+        schedule(now + config.dispatchInterval, SimEventType::DISPATCH_TICK);
+    }
+}
+
+void EventSimulator::dispatch(const std::shared_ptr<Request>& request) {
+    auto scheduler = building.getScheduler();
+    auto elevator = scheduler ? scheduler->assignRequest(request) : nullptr;
+    if (!elevator || !elevator->addRequest(request)) {
+        unassigned.push_back(request);
+        return;
+    }
+
+    request->setStatus(RequestStatus::ASSIGNED);
+    request->setAssignedElevatorId(elevator->getElevatorId());
+
+    auto it = carIndexById.find(elevator->getElevatorId());
+    if (it == carIndexById.end()) return;
+
+    if (!cars[it->second].busy) {
+        startNextLeg(it->second);
+    } else if (cars[it->second].moving) {
+        retarget(it->second);
+    }
+}
+
+// Dispatches each parked call once; returns true if any of them found a car
+bool EventSimulator::retryUnassigned() {
+    bool assigned = false;
+    // Calls that fail again go to the back, so stop after one pass
+    for (size_t pass = unassigned.size(); pass > 0 && !unassigned.empty(); --pass) {
+        auto request = unassigned.front();
+        unassigned.pop_front();
+        dispatch(request);
+        assigned = assigned || !request->isPending();
+    }
+    return assigned;
+}
+
+void EventSimulator::startNextLeg(int carIndex) {
+    CarContext& car = cars[carIndex];
+    int nextStop = car.elevator->getNextStop();
+
+    if (nextStop == StopSet::NO_STOP) {
+        car.busy = false;
+        car.elevator->setDirection(Direction::NONE);
+        car.elevator->setState(ElevatorState::IDLE);
+
+        // A free car retries every call no elevator could take earlier
+        retryUnassigned();
+        return;
+    }
+
+    car.busy = true;
+    moveTo(carIndex, nextStop);
+}
+
+void EventSimulator::moveTo(int carIndex, int floor) {
+    CarContext& car = cars[carIndex];
+    auto& elevator = car.elevator;
+    car.targetFloor = floor;
+
+    int distance = elevator->getDistanceToFloor(floor);
+    if (distance == 0) {
+        handleCarArrival(carIndex, car.moveToken);
+        return;
+    }
+
+    bool up = floor > elevator->getCurrentFloor();
+    elevator->setDirection(up ? Direction::UP : Direction::DOWN);
+    elevator->setState(up ? ElevatorState::MOVING_UP : ElevatorState::MOVING_DOWN);
+
+    car.moving = true;
+    car.departPosition = elevator->getCurrentFloor();
+    car.departTime = now;
+    schedule(now + distance / elevator->getSpeed(), SimEventType::CAR_ARRIVAL, carIndex, ++car.moveToken);
+}
+
+void EventSimulator::retarget(int carIndex) {
+    // A stop added ahead of a moving car is picked up on the way instead of after the current target
+    CarContext& car = cars[carIndex];
+    auto& elevator = car.elevator;
+    bool up = elevator->getDirection() == Direction::UP;
+
+    double travelled = (now - car.departTime) * elevator->getSpeed();
+    double position = car.departPosition + (up ? travelled : -travelled);
+    int reachable = static_cast<int>(up ? std::ceil(position) : std::floor(position));
+
+    int original = elevator->getCurrentFloor();
+    elevator->setCurrentFloor(reachable);
+    int nextStop = elevator->getNextStop();
+    if (nextStop == StopSet::NO_STOP || nextStop == car.targetFloor ||
+        (up ? nextStop > car.targetFloor : nextStop < car.targetFloor)) {
+        elevator->setCurrentFloor(original);
+        return;
+    }
+
+    car.targetFloor = nextStop;
+    car.departPosition = position;
+    car.departTime = now;
+    schedule(now + std::abs(nextStop - position) / elevator->getSpeed(), SimEventType::CAR_ARRIVAL, carIndex, ++car.moveToken);
+}
+
+void EventSimulator::handleCarArrival(int carIndex, std::uint64_t token) {
+    CarContext& car = cars[carIndex];
+    if (token != car.moveToken) return; // Superseded by retarget
+
+    car.moving = false;
+    car.elevator->setCurrentFloor(car.targetFloor);
+    car.elevator->setState(ElevatorState::DOOR_OPENING);
+    car.elevator->setDoorState(DoorState::OPENING);
+    schedule(now + car.elevator->getDoorOpenTime(), SimEventType::DOOR_OPENED, carIndex);
+}
+
+void EventSimulator::handleDoorOpened(int carIndex) {
+    CarContext& car = cars[carIndex];
+    auto& elevator = car.elevator;
+    elevator->setState(ElevatorState::DOOR_OPEN);
+    elevator->setDoorState(DoorState::OPEN);
+
+    StopResult stop = elevator->arriveAt(car.targetFloor, toTimePoint(now));
+    for (const auto& request : stop.boarded) {
+        double wait = now - toSeconds(request->getRequestTime());
+        totalWait += wait;
+        report.maxWaitTime = std::max(report.maxWaitTime, wait);
+        boardedAt[request.get()] = now;
+    }
+    for (const auto& request : stop.alighted) {
+        auto it = boardedAt.find(request.get());
+        if (it != boardedAt.end()) {
+            totalRide += now - it->second;
+            boardedAt.erase(it);
+        }
+        report.passengersDelivered++;
+    }
+
+    elevator->setState(ElevatorState::DOOR_CLOSING);
+    elevator->setDoorState(DoorState::CLOSING);
+    schedule(now + config.doorDwellTime + elevator->getDoorCloseTime(), SimEventType::DOOR_CLOSED, carIndex);
+}
+
+void EventSimulator::handleDoorClosed(int carIndex) {
+    CarContext& car = cars[carIndex];
+    car.elevator->setDoorState(DoorState::CLOSED);
+    startNextLeg(carIndex);
+}
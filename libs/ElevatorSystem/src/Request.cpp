@@ -2,14 +2,15 @@
 #include <sstream>
 #include <iomanip>
 #include <chrono>
+#include <atomic>
 
 Request::Request(int sourceFloor, int destinationFloor, Direction direction, RequestType type)
     : sourceFloor(sourceFloor), destinationFloor(destinationFloor), direction(direction),
       type(type), status(RequestStatus::PENDING), requestTime(std::chrono::system_clock::now()),
-      priority(1) {
+      pickedUp(false), priority(1) {
     
-    // Generate unique request ID
-    static int counter = 0;
+    // Generate unique request ID (atomic so buildings can be simulated on parallel threads)
+    static std::atomic<int> counter(0);
     std::ostringstream oss;
     oss << "REQ" << std::setfill('0') << std::setw(6) << ++counter;
     requestId = oss.str();
@@ -21,6 +22,9 @@ Request::Request(int sourceFloor, int destinationFloor, Direction direction, Req
 }
 
 int Request::getWaitTime() const {
+    if (pickedUp) {
+        return std::chrono::duration_cast<std::chrono::seconds>(pickupTime - requestTime).count();
+    }
     if (status == RequestStatus::PENDING) {
         auto now = std::chrono::system_clock::now();
         auto duration = now - requestTime;
@@ -59,27 +59,104 @@ std::shared_ptr<Elevator> Scheduler::assignRequest(const std::shared_ptr<Request
 }
 
 void Scheduler::scheduleRequests() {
-    for (auto& request : pendingRequests) {
-        if (request->isPending()) {
-            auto elevator = assignRequest(request);
-            if (elevator) {
-                request->setStatus(RequestStatus::ASSIGNED);
-                request->setAssignedElevatorId(elevator->getElevatorId());
-                elevator->addRequest(request);
+    if (algorithm == SchedulingAlgorithm::FCFS) {
+        // FCFS keeps strict arrival order, one request at a time
+        for (auto& request : pendingRequests) {
+            if (request->isPending()) {
+                auto elevator = assignRequest(request);
+                if (elevator && elevator->addRequest(request)) {
+                    request->setStatus(RequestStatus::ASSIGNED);
+                    request->setAssignedElevatorId(elevator->getElevatorId());
+                }
+            }
+        }
+    } else {
+        std::vector<std::shared_ptr<Request>> batch;
+        for (const auto& request : pendingRequests) {
+            if (request->isPending()) {
+                batch.push_back(request);
+            }
+        }
+
+        auto chosen = batchAssign(batch);
+        for (size_t i = 0; i < batch.size(); ++i) {
+            if (chosen[i] && chosen[i]->addRequest(batch[i])) {
+                batch[i]->setStatus(RequestStatus::ASSIGNED);
+                batch[i]->setAssignedElevatorId(chosen[i]->getElevatorId());
             }
         }
     }
+
+    // Keep only requests that still need an elevator
+    pendingRequests.erase(
+        std::remove_if(pendingRequests.begin(), pendingRequests.end(),
+            [](const std::shared_ptr<Request>& req) { return !req->isPending(); }),
+        pendingRequests.end()
+    );
 }
 
 void Scheduler::optimizeSchedules() {
-    // This is a simplified optimization
-    // In a real system, you'd implement more sophisticated optimization algorithms
-    for (auto& elevator : elevators) {
-        // Sort requests in the elevator's queue based on the current algorithm
-        // This is a placeholder for actual optimization logic
+    if (algorithm == SchedulingAlgorithm::FCFS) return;
+
+    std::vector<std::shared_ptr<Elevator>> candidates = getOperationalElevators();
+    if (candidates.size() < 2) return;
+
+    // Requests still waiting in an elevator queue can move without disturbing a trip in progress
+    std::vector<std::shared_ptr<Request>> queued;
+    std::vector<int> assignment;
+    for (size_t col = 0; col < candidates.size(); ++col) {
+        for (const auto& request : candidates[col]->getQueuedRequests()) {
+            queued.push_back(request);
+            assignment.push_back(static_cast<int>(col));
+        }
+    }
+    if (queued.empty()) return;
+
+    std::vector<int> original = assignment;
+    std::vector<int> costs = buildCostMatrix(queued, candidates);
+    std::vector<int> load(candidates.size(), 0);
+    solveAssignment(costs, static_cast<int>(queued.size()), static_cast<int>(candidates.size()),
+                    queuePenalty(), load, assignment);
+
+    for (size_t row = 0; row < queued.size(); ++row) {
+        if (assignment[row] == original[row]) continue;
+
+        auto& from = candidates[original[row]];
+        auto& to = candidates[assignment[row]];
+        from->removeRequest(queued[row]);
+        if (to->addRequest(queued[row])) {
+            queued[row]->setAssignedElevatorId(to->getElevatorId());
+        } else {
+            from->addRequest(queued[row]);
+        }
     }
 }
 
+std::vector<std::shared_ptr<Elevator>> Scheduler::batchAssign(const std::vector<std::shared_ptr<Request>>& requests) const {
+    std::vector<std::shared_ptr<Elevator>> result(requests.size());
+    std::vector<std::shared_ptr<Elevator>> candidates = getOperationalElevators();
+    if (requests.empty() || candidates.empty()) return result;
+
+    // Queue contents count through the solver's load penalty, not through the base cost
+    std::vector<int> load;
+    load.reserve(candidates.size());
+    for (const auto& elevator : candidates) {
+        load.push_back(elevator->getRequestCount());
+    }
+
+    std::vector<int> costs = buildCostMatrix(requests, candidates);
+    std::vector<int> assignment(requests.size(), -1);
+    solveAssignment(costs, static_cast<int>(requests.size()), static_cast<int>(candidates.size()),
+                    queuePenalty(), load, assignment);
+
+    for (size_t row = 0; row < requests.size(); ++row) {
+        if (assignment[row] >= 0) {
+            result[row] = candidates[assignment[row]];
+        }
+    }
+    return result;
+}
+
 std::shared_ptr<Elevator> Scheduler::fcfsAssign(const std::shared_ptr<Request>& request) {
     // First Come First Serve - assign to the first available elevator
     for (const auto& elevator : getAvailableElevators()) {
@@ -95,7 +172,7 @@ std::shared_ptr<Elevator> Scheduler::scanAssign(const std::shared_ptr<Request>&
     std::shared_ptr<Elevator> bestElevator = nullptr;
     int minCost = std::numeric_limits<int>::max();
     
-    for (const auto& elevator : getOperationalElevators()) {
+    for (const auto& elevator : elevators) {
         if (!canServeRequest(elevator, request)) continue;
         
         int cost = calculateCost(elevator, request);
@@ -113,7 +190,7 @@ std::shared_ptr<Elevator> Scheduler::lookAssign(const std::shared_ptr<Request>&
     std::shared_ptr<Elevator> bestElevator = nullptr;
     int minCost = std::numeric_limits<int>::max();
     
-    for (const auto& elevator : getOperationalElevators()) {
+    for (const auto& elevator : elevators) {
         if (!canServeRequest(elevator, request)) continue;
         
         int cost = calculateCost(elevator, request);
@@ -131,7 +208,7 @@ std::shared_ptr<Elevator> Scheduler::sstfAssign(const std::shared_ptr<Request>&
     std::shared_ptr<Elevator> nearestElevator = nullptr;
     int minDistance = std::numeric_limits<int>::max();
     
-    for (const auto& elevator : getOperationalElevators()) {
+    for (const auto& elevator : elevators) {
         if (!canServeRequest(elevator, request)) continue;
         
         int distance = elevator->getDistanceToFloor(request->getSourceFloor());
@@ -149,7 +226,7 @@ std::shared_ptr<Elevator> Scheduler::priorityAssign(const std::shared_ptr<Reques
     std::shared_ptr<Elevator> bestElevator = nullptr;
     double bestScore = std::numeric_limits<double>::lowest();
     
-    for (const auto& elevator : getOperationalElevators()) {
+    for (const auto& elevator : elevators) {
         if (!canServeRequest(elevator, request)) continue;
         
         // Calculate priority score based on multiple factors
@@ -199,7 +276,7 @@ std::shared_ptr<Elevator> Scheduler::findBestElevator(const std::shared_ptr<Requ
             std::shared_ptr<Elevator> nearestElevator = nullptr;
             int minDistance = std::numeric_limits<int>::max();
             
-            for (const auto& elevator : getOperationalElevators()) {
+            for (const auto& elevator : elevators) {
                 if (!canServeRequest(elevator, request)) continue;
                 
                 int distance = elevator->getDistanceToFloor(request->getSourceFloor());
@@ -215,7 +292,7 @@ std::shared_ptr<Elevator> Scheduler::findBestElevator(const std::shared_ptr<Requ
             std::shared_ptr<Elevator> bestElevator = nullptr;
             int minCost = std::numeric_limits<int>::max();
             
-            for (const auto& elevator : getOperationalElevators()) {
+            for (const auto& elevator : elevators) {
                 if (!canServeRequest(elevator, request)) continue;
                 
                 int cost = calculateCost(elevator, request);
@@ -238,6 +315,110 @@ int Scheduler::calculateCost(const std::shared_ptr<Elevator>& elevator, const st
     return distance * 2 + queueSize * 5 + load * 3;
 }
 
+int Scheduler::dispatchCost(const std::shared_ptr<Elevator>& elevator, const std::shared_ptr<Request>& request) const {
+    int distance = elevator->getDistanceToFloor(request->getSourceFloor());
+
+    switch (algorithm) {
+        case SchedulingAlgorithm::SSTF:
+            return distance;
+        case SchedulingAlgorithm::PRIORITY: {
+            // Same weighting as priorityAssign, scaled to an integer cost
+            double distanceScore = 1.0 / (1.0 + distance);
+            double loadScore = 1.0 - (elevator->getCurrentLoad() / (double)elevator->getCapacity());
+            double priorityScore = request->getPriority() / 10.0;
+            double totalScore = distanceScore * 0.4 + loadScore * 0.3 + priorityScore * 0.3;
+            return static_cast<int>((1.0 - totalScore) * 1000);
+        }
+        default:
+            // calculateCost without the queue term, which the solver applies per assignment
+            return distance * 2 + elevator->getCurrentLoad() * 3;
+    }
+}
+
+int Scheduler::queuePenalty() const {
+    return (algorithm == SchedulingAlgorithm::SCAN || algorithm == SchedulingAlgorithm::LOOK) ? 5 : 0;
+}
+
+std::vector<int> Scheduler::buildCostMatrix(const std::vector<std::shared_ptr<Request>>& requests,
+                                            const std::vector<std::shared_ptr<Elevator>>& candidates) const {
+    // Row-major requests x elevators; INT_MAX marks elevators that cannot serve the request
+    std::vector<int> costs(requests.size() * candidates.size(), std::numeric_limits<int>::max());
+    for (size_t row = 0; row < requests.size(); ++row) {
+        int* rowCosts = costs.data() + row * candidates.size();
+        for (size_t col = 0; col < candidates.size(); ++col) {
+            if (canServeRequest(candidates[col], requests[row])) {
+                rowCosts[col] = dispatchCost(candidates[col], requests[row]);
+            }
+        }
+    }
+    return costs;
+}
+
+void Scheduler::solveAssignment(const std::vector<int>& costs, int rows, int cols, int penalty,
+                                std::vector<int>& load, std::vector<int>& assignment) {
+    const int infinity = std::numeric_limits<int>::max();
+
+    for (int row = 0; row < rows; ++row) {
+        if (assignment[row] >= 0) load[assignment[row]]++;
+    }
+
+    // Greedy pass: rows with the largest gap between best and second-best elevator choose first
+    std::vector<std::pair<int, int>> order; // (-regret, row)
+    for (int row = 0; row < rows; ++row) {
+        if (assignment[row] >= 0) continue;
+        const int* rowCosts = costs.data() + static_cast<size_t>(row) * cols;
+        int best = infinity, second = infinity;
+        for (int col = 0; col < cols; ++col) {
+            if (rowCosts[col] < best) { second = best; best = rowCosts[col]; }
+            else if (rowCosts[col] < second) { second = rowCosts[col]; }
+        }
+        if (best == infinity) continue;
+        int regret = second == infinity ? infinity : second - best;
+        order.emplace_back(-regret, row);
+    }
+    std::sort(order.begin(), order.end());
+
+    for (const auto& entry : order) {
+        int row = entry.second;
+        const int* rowCosts = costs.data() + static_cast<size_t>(row) * cols;
+        long long bestCost = std::numeric_limits<long long>::max();
+        int bestCol = -1;
+        for (int col = 0; col < cols; ++col) {
+            if (rowCosts[col] == infinity) continue;
+            long long cost = rowCosts[col] + static_cast<long long>(penalty) * load[col];
+            if (cost < bestCost) { bestCost = cost; bestCol = col; }
+        }
+        assignment[row] = bestCol;
+        load[bestCol]++;
+    }
+
+    // Reassignment pass: move single requests while that strictly lowers total cost
+    if (cols < 2) return;
+    const int maxPasses = 8;
+    for (int pass = 0; pass < maxPasses; ++pass) {
+        bool improved = false;
+        for (int row = 0; row < rows; ++row) {
+            int from = assignment[row];
+            if (from < 0) continue;
+            const int* rowCosts = costs.data() + static_cast<size_t>(row) * cols;
+            long long current = rowCosts[from] + static_cast<long long>(penalty) * (load[from] - 1);
+            int bestCol = from;
+            for (int col = 0; col < cols; ++col) {
+                if (col == from || rowCosts[col] == infinity) continue;
+                long long cost = rowCosts[col] + static_cast<long long>(penalty) * load[col];
+                if (cost < current) { current = cost; bestCol = col; }
+            }
+            if (bestCol != from) {
+                load[from]--;
+                load[bestCol]++;
+                assignment[row] = bestCol;
+                improved = true;
+            }
+        }
+        if (!improved) break;
+    }
+}
+
 bool Scheduler::canServeRequest(const std::shared_ptr<Elevator>& elevator, const std::shared_ptr<Request>& request) const {
     if (!elevator->getIsOperational()) return false;
     if (!elevator->canServeFloor(request->getSourceFloor())) return false;
@@ -0,0 +1,172 @@
+#include "../include/Statistics.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace {
+
+const int SUB_BUCKET_BITS = 5;                        // 32 exact buckets below 32ms
+const int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+const int SUB_BUCKET_HALF = SUB_BUCKET_COUNT / 2;    // 16 buckets per octave above that
+const size_t BUCKET_COUNT = SUB_BUCKET_COUNT + (64 - SUB_BUCKET_BITS) * SUB_BUCKET_HALF;
+
+int highestBit(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#else
+    int bit = 63;
+    while (!(value >> bit)) --bit;
+    return bit;
+#endif
+}
+
+double secondsBetween(const std::chrono::system_clock::time_point& from,
+                      const std::chrono::system_clock::time_point& to) {
+    return std::max(0.0, std::chrono::duration<double>(to - from).count());
+}
+
+}
+
+LatencyHistogram::LatencyHistogram() : counts(BUCKET_COUNT, 0), total(0), maxMillis(0) {}
+
+size_t LatencyHistogram::bucketIndex(std::uint64_t millis) {
+    if (millis < static_cast<std::uint64_t>(SUB_BUCKET_COUNT)) {
+        return static_cast<size_t>(millis);
+    }
+    int shift = highestBit(millis) - (SUB_BUCKET_BITS - 1);
+    std::uint64_t subBucket = millis >> shift; // In [16, 32)
+    return SUB_BUCKET_COUNT + (shift - 1) * SUB_BUCKET_HALF + static_cast<size_t>(subBucket - SUB_BUCKET_HALF);
+}
+
+std::uint64_t LatencyHistogram::bucketMidpoint(size_t index) {
+    if (index < static_cast<size_t>(SUB_BUCKET_COUNT)) {
+        return index;
+    }
+    size_t offset = index - SUB_BUCKET_COUNT;
+    int shift = static_cast<int>(offset / SUB_BUCKET_HALF) + 1;
+    std::uint64_t subBucket = offset % SUB_BUCKET_HALF + SUB_BUCKET_HALF;
+    std::uint64_t lower = subBucket << shift;
+    return lower + ((std::uint64_t(1) << shift) >> 1);
+}
+
+void LatencyHistogram::record(double seconds) {
+    std::uint64_t millis = seconds > 0 ? static_cast<std::uint64_t>(std::llround(seconds * 1000.0)) : 0;
+    counts[bucketIndex(millis)]++;
+    total++;
+    maxMillis = std::max(maxMillis, millis);
+}
+
+void LatencyHistogram::reset() {
+    std::fill(counts.begin(), counts.end(), 0);
+    total = 0;
+    maxMillis = 0;
+}
+
+double LatencyHistogram::getPercentile(double percentile) const {
+    if (total == 0) return 0.0;
+
+    percentile = std::min(100.0, std::max(0.0, percentile));
+    std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(percentile / 100.0 * total));
+    rank = std::max<std::uint64_t>(rank, 1);
+
+    std::uint64_t seen = 0;
+    for (size_t i = 0; i < counts.size(); ++i) {
+        seen += counts[i];
+        if (seen >= rank) {
+            return std::min(bucketMidpoint(i), maxMillis) / 1000.0;
+        }
+    }
+    return maxMillis / 1000.0;
+}
+
+RequestStatistics::RequestStatistics(int minFloor, int maxFloor)
+    : minFloor(minFloor), totalRequests(0), completedRequests(0),
+      totalWaitTime(0.0), totalTravelTime(0.0) {
+    floorRequestCounts.resize(maxFloor >= minFloor ? maxFloor - minFloor + 1 : 0, 0);
+}
+
+void RequestStatistics::resizeFloors(int newMinFloor, int newMaxFloor) {
+    std::vector<std::uint64_t> counts(newMaxFloor >= newMinFloor ? newMaxFloor - newMinFloor + 1 : 0, 0);
+    for (size_t i = 0; i < floorRequestCounts.size(); ++i) {
+        int floor = minFloor + static_cast<int>(i);
+        if (floor >= newMinFloor && floor <= newMaxFloor) {
+            counts[floor - newMinFloor] = floorRequestCounts[i];
+        }
+    }
+    floorRequestCounts.swap(counts);
+    minFloor = newMinFloor;
+}
+
+void RequestStatistics::countFloor(int floor) {
+    int index = floor - minFloor;
+    if (index >= 0 && index < static_cast<int>(floorRequestCounts.size())) {
+        floorRequestCounts[index]++;
+    }
+}
+
+void RequestStatistics::recordRequest(const Request& request) {
+    totalRequests++;
+    countFloor(request.getSourceFloor());
+    if (request.getType() == RequestType::INTERNAL) {
+        countFloor(request.getDestinationFloor());
+    }
+}
+
+void RequestStatistics::recordCompletion(const Request& request) {
+    auto requested = request.getRequestTime();
+    auto completed = request.getCompletionTime();
+    // Hall calls without a pickup are served the moment the car arrives
+    auto pickedUp = request.hasPickupTime() ? request.getPickupTime() : completed;
+
+    double wait = secondsBetween(requested, pickedUp);
+    double travel = secondsBetween(requested, completed);
+
+    completedRequests++;
+    totalWaitTime += wait;
+    totalTravelTime += travel;
+    waitTimes.record(wait);
+    travelTimes.record(travel);
+}
+
+void RequestStatistics::reset() {
+    std::fill(floorRequestCounts.begin(), floorRequestCounts.end(), 0);
+    totalRequests = 0;
+    completedRequests = 0;
+    totalWaitTime = 0.0;
+    totalTravelTime = 0.0;
+    waitTimes.reset();
+    travelTimes.reset();
+}
+
+double RequestStatistics::getAverageWaitTime() const {
+    return completedRequests ? totalWaitTime / completedRequests : 0.0;
+}
+
+double RequestStatistics::getAverageTravelTime() const {
+    return completedRequests ? totalTravelTime / completedRequests : 0.0;
+}
+
+std::uint64_t RequestStatistics::getFloorRequestCount(int floor) const {
+    int index = floor - minFloor;
+    if (index < 0 || index >= static_cast<int>(floorRequestCounts.size())) return 0;
+    return floorRequestCounts[index];
+}
+
+std::vector<int> RequestStatistics::getMostRequestedFloors(int count) const {
+    std::vector<int> floors;
+    for (size_t i = 0; i < floorRequestCounts.size(); ++i) {
+        if (floorRequestCounts[i] > 0) {
+            floors.push_back(minFloor + static_cast<int>(i));
+        }
+    }
+
+    size_t top = std::min(floors.size(), static_cast<size_t>(std::max(count, 0)));
+    std::partial_sort(floors.begin(), floors.begin() + top, floors.end(),
+        [this](int a, int b) {
+            auto countA = floorRequestCounts[a - minFloor];
+            auto countB = floorRequestCounts[b - minFloor];
+            return countA != countB ? countA > countB : a < b;
+        });
+    floors.resize(top);
+    return floors;
+}
@@ -0,0 +1,102 @@
+#include "../include/StopSet.hpp"
+#include <algorithm>
+
+namespace {
+
+int lowestBit(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int bit = 0;
+    while (!(word & 1)) { word >>= 1; ++bit; }
+    return bit;
+#endif
+}
+
+int highestBit(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(word);
+#else
+    int bit = 63;
+    while (!(word >> bit)) --bit;
+    return bit;
+#endif
+}
+
+}
+
+StopSet::StopSet(int minFloor, int maxFloor)
+    : minFloor(minFloor), maxFloor(maxFloor), count(0) {
+    int floors = maxFloor >= minFloor ? maxFloor - minFloor + 1 : 0;
+    words.resize((floors + 63) / 64, 0);
+}
+
+void StopSet::insert(int floor) {
+    if (floor < minFloor || floor > maxFloor) return;
+    int index = toIndex(floor);
+    std::uint64_t mask = std::uint64_t(1) << (index & 63);
+    if (!(words[index >> 6] & mask)) {
+        words[index >> 6] |= mask;
+        ++count;
+    }
+}
+
+void StopSet::remove(int floor) {
+    if (floor < minFloor || floor > maxFloor) return;
+    int index = toIndex(floor);
+    std::uint64_t mask = std::uint64_t(1) << (index & 63);
+    if (words[index >> 6] & mask) {
+        words[index >> 6] &= ~mask;
+        --count;
+    }
+}
+
+bool StopSet::contains(int floor) const {
+    if (floor < minFloor || floor > maxFloor) return false;
+    int index = toIndex(floor);
+    return (words[index >> 6] >> (index & 63)) & 1;
+}
+
+void StopSet::clear() {
+    std::fill(words.begin(), words.end(), 0);
+    count = 0;
+}
+
+int StopSet::nextAtOrAbove(int floor) const {
+    if (count == 0 || floor > maxFloor) return NO_STOP;
+    int index = floor < minFloor ? 0 : toIndex(floor);
+
+    size_t word = index >> 6;
+    std::uint64_t bits = words[word] & (~std::uint64_t(0) << (index & 63));
+    while (true) {
+        if (bits) return minFloor + static_cast<int>(word * 64) + lowestBit(bits);
+        if (++word >= words.size()) return NO_STOP;
+        bits = words[word];
+    }
+}
+
+int StopSet::nextAtOrBelow(int floor) const {
+    if (count == 0 || floor < minFloor) return NO_STOP;
+    int index = floor > maxFloor ? toIndex(maxFloor) : toIndex(floor);
+
+    size_t word = index >> 6;
+    std::uint64_t bits = words[word] & (~std::uint64_t(0) >> (63 - (index & 63)));
+    while (true) {
+        if (bits) return minFloor + static_cast<int>(word * 64) + highestBit(bits);
+        if (word-- == 0) return NO_STOP;
+        bits = words[word];
+    }
+}
+
+std::vector<int> StopSet::toVector() const {
+    std::vector<int> floors;
+    floors.reserve(count);
+    for (size_t word = 0; word < words.size(); ++word) {
+        std::uint64_t bits = words[word];
+        while (bits) {
+            floors.push_back(minFloor + static_cast<int>(word * 64) + lowestBit(bits));
+            bits &= bits - 1;
+        }
+    }
+    return floors;
+}
@@ -0,0 +1,153 @@
+#include "../include/SweepRunner.hpp"
+#include "../include/WorkStealingPool.hpp"
+#include <chrono>
+#include <iomanip>
+
+void SweepRunner::addConfiguration(const SweepConfig& config) {
+    configs.push_back(config);
+}
+
+void SweepRunner::addGrid(const SweepConfig& base, const std::vector<int>& elevatorCounts,
+                          const std::vector<SchedulingAlgorithm>& algorithms,
+                          const std::vector<TrafficPattern>& patterns) {
+    for (int count : elevatorCounts) {
+        for (auto algorithm : algorithms) {
+            for (auto pattern : patterns) {
+                SweepConfig config = base;
+                config.elevatorCount = count;
+                config.algorithm = algorithm;
+                config.simulation.pattern = pattern;
+                config.label = std::to_string(count) + "x" + algorithmName(algorithm) + "/" + patternName(pattern);
+                configs.push_back(config);
+            }
+        }
+    }
+}
+
+SweepResult SweepRunner::runSingle(const SweepConfig& config) {
+    Building building(config.label, config.label, config.floors, config.basementFloors);
+    building.setSchedulingAlgorithm(config.algorithm);
+
+    int minFloor = config.basementFloors > 0 ? -config.basementFloors : 1;
+    for (int i = 0; i < config.elevatorCount; ++i) {
+        building.addElevator(std::make_shared<Elevator>(
+            "E" + std::to_string(i + 1), config.floors, minFloor, config.elevatorSpeed,
+            2.0, 2.0, config.elevatorCapacity));
+    }
+
+    EventSimulator simulator(building, config.simulation);
+
+    SweepResult result;
+    result.config = config;
+    result.report = simulator.run();
+    result.p50WaitTime = building.getWaitTimePercentile(50);
+    result.p95WaitTime = building.getWaitTimePercentile(95);
+    result.p99WaitTime = building.getWaitTimePercentile(99);
+    return result;
+}
+
+std::vector<SweepResult> SweepRunner::run(size_t threadCount) const {
+    std::vector<SweepResult> results(configs.size());
+    if (configs.empty()) return results;
+
+    // Each task writes only its own slot, so the results vector needs no locking
+    WorkStealingPool pool(threadCount);
+    for (size_t i = 0; i < configs.size(); ++i) {
+        pool.submit([this, &results, i] {
+            results[i] = runSingle(configs[i]);
+        });
+    }
+    pool.waitIdle();
+    return results;
+}
+
+std::vector<ScalingSample> SweepRunner::measureScaling(const std::vector<size_t>& threadCounts) const {
+    std::vector<ScalingSample> samples;
+    for (size_t threads : threadCounts) {
+        auto start = std::chrono::steady_clock::now();
+        run(threads);
+
+        ScalingSample sample;
+        sample.threads = threads;
+        sample.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        samples.push_back(sample);
+    }
+
+    if (!samples.empty()) {
+        double baseline = samples.front().wallSeconds * samples.front().threads;
+        for (auto& sample : samples) {
+            sample.speedup = sample.wallSeconds > 0 ? samples.front().wallSeconds / sample.wallSeconds : 0.0;
+            sample.efficiency = sample.wallSeconds > 0 && sample.threads > 0
+                ? baseline / (sample.wallSeconds * sample.threads) : 0.0;
+        }
+    }
+    return samples;
+}
+
+void SweepRunner::printResults(const std::vector<SweepResult>& results, std::ostream& out) {
+    out << std::left << std::setw(28) << "Configuration"
+        << std::right << std::setw(10) << "Delivered"
+        << std::setw(10) << "AvgWait" << std::setw(10) << "p50"
+        << std::setw(10) << "p95" << std::setw(10) << "p99"
+        << std::setw(10) << "AvgRide" << std::setw(10) << "Wall(s)" << "\n";
+
+    out << std::fixed << std::setprecision(2);
+    for (const auto& result : results) {
+        out << std::left << std::setw(28) << result.config.label
+            << std::right << std::setw(10) << result.report.passengersDelivered
+            << std::setw(10) << result.report.averageWaitTime
+            << std::setw(10) << result.p50WaitTime
+            << std::setw(10) << result.p95WaitTime
+            << std::setw(10) << result.p99WaitTime
+            << std::setw(10) << result.report.averageRideTime
+            << std::setw(10) << result.report.wallSeconds << "\n";
+    }
+}
+
+void SweepRunner::writeCsv(const std::vector<SweepResult>& results, std::ostream& out) {
+    out << "label,floors,elevators,algorithm,pattern,passengers_per_hour,seed,"
+           "generated,delivered,unserved,avg_wait,p50_wait,p95_wait,p99_wait,max_wait,avg_ride,wall_seconds\n";
+    for (const auto& result : results) {
+        const auto& config = result.config;
+        const auto& report = result.report;
+        out << config.label << ',' << config.floors << ',' << config.elevatorCount << ','
+            << algorithmName(config.algorithm) << ',' << patternName(config.simulation.pattern) << ','
+            << config.simulation.passengersPerHour << ',' << config.simulation.seed << ','
+            << report.passengersGenerated << ',' << report.passengersDelivered << ','
+            << report.passengersUnserved << ','
+            << report.averageWaitTime << ',' << result.p50WaitTime << ',' << result.p95WaitTime << ','
+            << result.p99WaitTime << ',' << report.maxWaitTime << ',' << report.averageRideTime << ','
+            << report.wallSeconds << "\n";
+    }
+}
+
+void SweepRunner::printScaling(const std::vector<ScalingSample>& samples, std::ostream& out) {
+    out << std::right << std::setw(8) << "Threads" << std::setw(12) << "Wall(s)"
+        << std::setw(10) << "Speedup" << std::setw(12) << "Efficiency" << "\n";
+    out << std::fixed << std::setprecision(2);
+    for (const auto& sample : samples) {
+        out << std::setw(8) << sample.threads << std::setw(12) << sample.wallSeconds
+            << std::setw(10) << sample.speedup << std::setw(11) << sample.efficiency * 100 << "%\n";
+    }
+}
+
+std::string SweepRunner::algorithmName(SchedulingAlgorithm algorithm) {
+    switch (algorithm) {
+        case SchedulingAlgorithm::FCFS: return "FCFS";
+        case SchedulingAlgorithm::SCAN: return "SCAN";
+        case SchedulingAlgorithm::LOOK: return "LOOK";
+        case SchedulingAlgorithm::SSTF: return "SSTF";
+        case SchedulingAlgorithm::PRIORITY: return "PRIORITY";
+    }
+    return "UNKNOWN";
+}
+
+std::string SweepRunner::patternName(TrafficPattern pattern) {
+    switch (pattern) {
+        case TrafficPattern::UP_PEAK: return "UP_PEAK";
+        case TrafficPattern::DOWN_PEAK: return "DOWN_PEAK";
+        case TrafficPattern::INTERFLOOR: return "INTERFLOOR";
+        case TrafficPattern::FULL_DAY: return "FULL_DAY";
+    }
+    return "UNKNOWN";
+}
@@ -0,0 +1,105 @@
+#include "../include/WorkStealingPool.hpp"
+
+namespace {
+
+// Index of the pool worker running on this thread, or npos for outside threads
+thread_local const WorkStealingPool* currentPool = nullptr;
+thread_local size_t currentWorker = static_cast<size_t>(-1);
+
+}
+
+WorkStealingPool::WorkStealingPool(size_t threadCount)
+    : nextQueue(0), queuedTasks(0), unfinishedTasks(0), stolenTasks(0), shuttingDown(false) {
+    if (threadCount == 0) threadCount = 1;
+
+    for (size_t i = 0; i < threadCount; ++i) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (size_t i = 0; i < threadCount; ++i) {
+        workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        shuttingDown = true;
+    }
+    workAvailable.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::submit(std::function<void()> task) {
+    // Tasks spawned by a worker stay local; outside submissions are spread round-robin
+    size_t index = currentPool == this ? currentWorker : nextQueue++ % queues.size();
+
+    unfinishedTasks++;
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        queuedTasks++;
+    }
+    workAvailable.notify_one();
+}
+
+void WorkStealingPool::waitIdle() {
+    std::unique_lock<std::mutex> lock(stateMutex);
+    allDone.wait(lock, [this] { return unfinishedTasks.load() == 0; });
+}
+
+bool WorkStealingPool::popLocal(size_t index, std::function<void()>& task) {
+    std::lock_guard<std::mutex> lock(queues[index]->mutex);
+    auto& tasks = queues[index]->tasks;
+    if (tasks.empty()) return false;
+
+    task = std::move(tasks.back());
+    tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::steal(size_t thief, std::function<void()>& task) {
+    for (size_t offset = 1; offset < queues.size(); ++offset) {
+        size_t victim = (thief + offset) % queues.size();
+        std::lock_guard<std::mutex> lock(queues[victim]->mutex);
+        auto& tasks = queues[victim]->tasks;
+        if (tasks.empty()) continue;
+
+        task = std::move(tasks.front());
+        tasks.pop_front();
+        stolenTasks++;
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingPool::workerLoop(size_t index) {
+    currentPool = this;
+    currentWorker = index;
+
+    while (true) {
+        {
+            // Claim one queued task; the claim guarantees a task is left for us somewhere
+            std::unique_lock<std::mutex> lock(stateMutex);
+            workAvailable.wait(lock, [this] { return shuttingDown || queuedTasks > 0; });
+            if (queuedTasks == 0) return; // Shutting down with nothing left
+            queuedTasks--;
+        }
+
+        std::function<void()> task;
+        while (!popLocal(index, task) && !steal(index, task)) {
+            std::this_thread::yield(); // Raced with another claimant's scan
+        }
+
+        task();
+
+        if (--unfinishedTasks == 0) {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            allDone.notify_all();
+        }
+    }
+}
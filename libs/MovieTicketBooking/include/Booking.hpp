@@ -50,6 +50,7 @@ public:
     void setTotalAmount(double amount);
     void setPayment(Payment* payment);
     void setExpiryTime(const std::chrono::system_clock::time_point& expiryTime);
+    void setShow(Show* show); // nullptr once the show is removed
     
     // Seat management
     void addSeat(const std::string& seatId);
@@ -0,0 +1,86 @@
+#ifndef CONCURRENT_REGISTRY_HPP
+#define CONCURRENT_REGISTRY_HPP
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// Fixed set of mutexes picked by address, so a lock can be taken per object
+// (show, user, payment) without storing a mutex in each one. Two objects may share
+// a stripe; that only serialises them, it never deadlocks as long as a thread
+// holds at most one stripe of each set.
+class LockStripes {
+public:
+    static const size_t STRIPE_COUNT = 64;
+
+private:
+    mutable std::mutex stripes[STRIPE_COUNT];
+
+public:
+    std::mutex& of(const void* object) const {
+        auto address = reinterpret_cast<std::uintptr_t>(object);
+        return stripes[(address >> 4 ^ address >> 12) % STRIPE_COUNT];
+    }
+};
+
+// ID -> object store split into independently locked shards, for entities that
+// many threads create and look up at once (bookings, payments). Objects are never
+// removed, so returned pointers stay valid for the registry's lifetime.
+template <typename T>
+class ConcurrentRegistry {
+public:
+    static const size_t SHARD_COUNT = 64;
+
+private:
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<std::string, std::unique_ptr<T>> items;
+    };
+
+    Shard shards[SHARD_COUNT];
+
+    Shard& shardOf(const std::string& id) { return shards[std::hash<std::string>{}(id) % SHARD_COUNT]; }
+    const Shard& shardOf(const std::string& id) const {
+        return shards[std::hash<std::string>{}(id) % SHARD_COUNT];
+    }
+
+public:
+    // Returns the stored object, or nullptr if the ID is already taken
+    T* insert(const std::string& id, std::unique_ptr<T> item) {
+        Shard& shard = shardOf(id);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto result = shard.items.emplace(id, std::move(item));
+        return result.second ? result.first->second.get() : nullptr;
+    }
+
+    T* find(const std::string& id) const {
+        const Shard& shard = shardOf(id);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.items.find(id);
+        return (it != shard.items.end()) ? it->second.get() : nullptr;
+    }
+
+    // Visits every object, one shard locked at a time; `visit` must not call back into the registry
+    void forEach(const std::function<void(T*)>& visit) const {
+        for (const Shard& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (const auto& item : shard.items) {
+                visit(item.second.get());
+            }
+        }
+    }
+
+    size_t size() const {
+        size_t total = 0;
+        for (const Shard& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            total += shard.items.size();
+        }
+        return total;
+    }
+};
+
+#endif // CONCURRENT_REGISTRY_HPP
@@ -7,27 +7,79 @@
 #include "User.hpp"
 #include "Booking.hpp"
 #include "Payment.hpp"
+#include "ConcurrentRegistry.hpp"
+#include "SeatFinder.hpp"
+#include "ShowIndex.hpp"
+#include "SlotMap.hpp"
+#include "TimingWheel.hpp"
+#include <atomic>
 #include <vector>
-#include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 
+// Thread-safe: every public method may be called from any thread.
+//
+// Locking, outermost first (a thread only ever takes locks further down the list):
+//   catalogMutex   - movies, theaters, screens, shows, users and the show index.
+//                    Adding or removing them is exclusive; everything else shares it.
+//   showLocks      - one stripe per show: booking state changes and the show's booking list
+//   userLocks      - the user's booking list
+//   paymentLocks   - payment state changes
+//   holdMutex      - the hold timer
+//   registry shards (bookings, payments)
+// Seat availability is read straight from the show's atomic seat bitmap, and seats
+// are reserved with compare-and-swap on it, so neither takes a booking lock.
+// Pointers returned for catalog entities stay valid until the entity is removed;
+// screens live until their screen or theater is removed, which also clears the
+// screen pointer of their shows. Booking and payment pointers stay valid for the
+// system's lifetime. Removing a show expires its pending bookings, and its
+// bookings' getShow() returns nullptr.
 class MovieTicketBookingSystem {
 private:
-    std::vector<std::unique_ptr<Movie>> movies;
-    std::vector<std::unique_ptr<Theater>> theaters;
-    std::vector<std::unique_ptr<Show>> shows;
-    std::vector<std::unique_ptr<User>> users;
-    std::vector<std::unique_ptr<Booking>> bookings;
-    std::vector<std::unique_ptr<Payment>> payments;
-    
-    // Maps for quick lookups
-    std::map<std::string, Movie*> movieMap;
-    std::map<std::string, Theater*> theaterMap;
-    std::map<std::string, Show*> showMap;
-    std::map<std::string, User*> userMap;
-    std::map<std::string, Booking*> bookingMap;
-    std::map<std::string, Payment*> paymentMap;
+    // Catalog entities live in slot maps; their IDs encode the slot handle
+    // (SlotHandle::toId), so lookup and removal are O(1) without a map
+    SlotMap<Movie> movies;
+    SlotMap<Theater> theaters;
+    SlotMap<Show> shows;
+    SlotMap<User> users;
+    mutable std::shared_mutex catalogMutex;
+    
+    ConcurrentRegistry<Booking> bookings;
+    ConcurrentRegistry<Payment> payments;
+    LockStripes showLocks;
+    LockStripes userLocks;
+    LockStripes paymentLocks;
+    
+    mutable std::atomic<std::uint64_t> nextId; // For screens, bookings and payments
+    
+    // Shows by movie, city and day; also maps screens to their theater
+    ShowIndex showIndex;
+    
+    // Seat holds of pending bookings, keyed by booking ID and due at the booking's expiry
+    TimingWheel holdTimer;
+    std::chrono::seconds holdDuration;
+    mutable std::mutex holdMutex; // Guards holdTimer and holdDuration
+    // Clock reading from which createBooking next sweeps the wheel; one sweep per tick
+    std::atomic<std::chrono::system_clock::rep> nextHoldSweep;
+    
+    // Lookups without locking; callers hold catalogMutex
+    Movie* findMovie(const std::string& movieId) const;
+    Theater* findTheater(const std::string& theaterId) const;
+    Show* findShow(const std::string& showId) const;
+    User* findUser(const std::string& userId) const;
+    std::vector<Movie*> collectActiveMovies() const;
+    std::vector<Show*> collectUpcomingShows() const;
+    
+    // Callers hold catalogMutex (shared) and the booking's show stripe
+    bool expireHold(Booking* booking);
+    // Callers hold no locks; releases lapsed holds at most once per wheel tick
+    void sweepDueHolds();
+    // Callers hold catalogMutex exclusively; run before the show is freed
+    void detachBookings(Show* show);
+    // Callers hold catalogMutex exclusively; run before the screens are freed
+    void detachScreens(const std::vector<std::string>& screenIds);
 
 public:
     MovieTicketBookingSystem();
@@ -87,6 +139,14 @@ public:
     std::vector<Booking*> getBookingsByShow(const std::string& showId) const;
     std::vector<Booking*> getAllBookings() const;
     
+    // Seat holds: createBooking holds the seats until confirmBooking or the lease runs out.
+    // createBooking also releases lapsed holds, once per timer tick (one second).
+    void setHoldDuration(std::chrono::seconds duration);
+    std::chrono::seconds getHoldDuration() const;
+    bool extendHold(const std::string& bookingId, std::chrono::seconds extra);
+    size_t releaseExpiredHolds(const std::chrono::system_clock::time_point& now = std::chrono::system_clock::now());
+    size_t getActiveHoldCount() const;
+    
     // Payment management
     Payment* createPayment(const std::string& bookingId, double amount, PaymentMethod method);
     bool processPayment(const std::string& paymentId);
@@ -94,12 +154,19 @@ public:
     Payment* getPayment(const std::string& paymentId);
     std::vector<Payment*> getPaymentsByBooking(const std::string& bookingId) const;
     
-    // Seat management
+    // Seat management (per show; reserve is all-or-nothing and safe to call from many threads)
     bool reserveSeats(const std::string& showId, const std::vector<std::string>& seatIds,
                      const std::string& bookingId);
     bool releaseSeats(const std::string& showId, const std::vector<std::string>& seatIds);
     std::vector<Seat*> getAvailableSeats(const std::string& showId) const;
     std::vector<Seat*> getReservedSeats(const std::string& showId) const;
+    std::vector<Seat*> getSeatsWithStatus(const std::string& showId, SeatStatus status) const;
+    
+    // Best available: the best-placed block of `count` adjacent free seats in one row
+    std::vector<std::string> findBestSeats(const std::string& showId, int count,
+                                           const SeatPreference& preference = SeatPreference()) const;
+    Booking* bookBestSeats(const std::string& userId, const std::string& showId, int count,
+                           const SeatPreference& preference = SeatPreference());
     bool isSeatAvailable(const std::string& showId, const std::string& seatId) const;
     
     // Search and query methods
@@ -2,10 +2,15 @@
 #define SCREEN_HPP
 
 #include "Seat.hpp"
+#include "SeatInventory.hpp"
 #include <vector>
 #include <map>
+#include <memory>
 #include <string>
 
+// Seating layout of a screen: seat types, surcharges and maintenance. Booking
+// state lives in each Show's SeatInventory, so the seats here only ever carry
+// AVAILABLE or MAINTENANCE.
 class Screen {
 private:
     std::string id;
@@ -13,8 +18,9 @@ private:
     int totalRows;
     int totalColumns;
     std::vector<std::vector<Seat>> seats;
-    std::map<std::string, Seat*> seatMap; // id -> seat pointer for quick lookup
+    std::map<std::string, std::pair<int, int>> seatMap; // id -> (row, column) for quick lookup
     bool isActive;
+    mutable std::shared_ptr<const SeatLayout> layout; // Built on demand, dropped on any layout change
 
 public:
     Screen(const std::string& id, const std::string& name, int totalRows, int totalColumns);
@@ -29,28 +35,21 @@ public:
     Seat* getSeat(const std::string& seatId);
     Seat* getSeat(int row, int column);
     std::vector<std::vector<Seat>> getAllSeats() const;
+    std::shared_ptr<const SeatLayout> getLayout() const;
     
     // Setters
     void setName(const std::string& name);
     void setIsActive(bool isActive);
     
     // Seat management
-    bool reserveSeat(const std::string& seatId, const std::string& bookingId);
-    bool reserveSeat(int row, int column, const std::string& bookingId);
-    bool occupySeat(const std::string& seatId);
-    bool occupySeat(int row, int column);
-    bool releaseSeat(const std::string& seatId);
-    bool releaseSeat(int row, int column);
     void setSeatMaintenance(const std::string& seatId);
     void setSeatMaintenance(int row, int column);
+    void clearSeatMaintenance(const std::string& seatId);
+    void clearSeatMaintenance(int row, int column);
     
-    // Utility methods
+    // Utility methods (seats not under maintenance)
     std::vector<Seat*> getAvailableSeats() const;
-    std::vector<Seat*> getReservedSeats() const;
-    std::vector<Seat*> getOccupiedSeats() const;
     int getAvailableSeatCount() const;
-    int getReservedSeatCount() const;
-    int getOccupiedSeatCount() const;
     bool isSeatAvailable(const std::string& seatId) const;
     bool isSeatAvailable(int row, int column) const;
     std::string getSeatLayoutString() const;
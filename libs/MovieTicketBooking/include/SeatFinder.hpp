@@ -0,0 +1,46 @@
+#ifndef SEAT_FINDER_HPP
+#define SEAT_FINDER_HPP
+
+#include "SeatInventory.hpp"
+#include <vector>
+
+struct SeatPreference {
+    bool anyType = true;            // Otherwise every seat of the block must be `type`
+    SeatType type = SeatType::REGULAR;
+    double idealRowFraction = 0.65; // 0 is the front row, 1 the back row
+    double rowWeight = 1.0;
+    double columnWeight = 1.0;
+};
+
+struct SeatBlock {
+    int row = -1;
+    int firstColumn = -1;
+    int count = 0;
+    double score = 0.0;             // Higher is better; 0 is a perfectly placed block
+
+    bool found() const { return row >= 0; }
+};
+
+// Best-available allocator: finds the best-scored block of N adjacent free seats
+// in one row of a show. A block's score is the negated, weighted sum of its row's
+// distance from the ideal row and its seats' average distance from the centre
+// line, both normalised to [0, 1].
+//
+// Each row is searched with its free bitmap: AND-ing the bitmap with shifted
+// copies of itself leaves bit c set only if seats c..c+N-1 are all free, in
+// O(log N) word operations. Since the centre penalty only grows away from the
+// centred start, only the nearest candidate on each side of it is scored. Rows
+// are visited outward from the ideal row and the search stops once the row
+// penalty alone cannot beat the best block found.
+class SeatFinder {
+public:
+    static SeatBlock findBestBlock(const SeatInventory& inventory, int count,
+                                   const SeatPreference& preference = SeatPreference());
+
+    static double scoreBlock(const SeatInventory& inventory, int row, int firstColumn, int count,
+                             const SeatPreference& preference = SeatPreference());
+
+    static std::vector<int> seatIndicesOf(const SeatInventory& inventory, const SeatBlock& block);
+};
+
+#endif // SEAT_FINDER_HPP
@@ -0,0 +1,60 @@
+#ifndef SEAT_FINDER_BENCHMARK_HPP
+#define SEAT_FINDER_BENCHMARK_HPP
+
+#include "SeatFinder.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct SeatFinderScenario {
+    int rows;
+    int columns;
+    double soldShare;                 // Seats taken at random before searching
+};
+
+struct SeatFinderBenchmarkConfig {
+    std::vector<SeatFinderScenario> scenarios = {{30, 40, 0.80}, {60, 100, 0.95}};
+    size_t inventories = 50;          // Randomly sold shows per scenario
+    size_t searchesPerInventory = 2000;
+    int minSeats = 1;
+    int maxSeats = 6;
+    bool randomPreferences = true;    // Random preferred rows, a quarter premium-only; else the default
+    size_t checkedSearches = 200;     // Per inventory, compared with scoring every block
+    unsigned seed = 11;
+};
+
+struct SeatFinderBenchmarkRow {
+    SeatFinderScenario scenario = {0, 0, 0.0};
+    double searchMicros = 0.0;        // findBestBlock, per search
+    double scanMicros = 0.0;          // scoreBlock on every free block, per search
+    double foundShare = 0.0;          // Searches that found a block
+    std::uint64_t mismatches = 0;     // Checked searches with a different best score
+};
+
+struct SeatFinderBenchmarkReport {
+    std::vector<SeatFinderBenchmarkRow> rows;
+    bool consistent = false;
+    double wallSeconds = 0.0;
+};
+
+// Reproduces the README's best-available figures. For each auditorium shape,
+// shows are sold at random to the given share and findBestBlock is timed for a
+// mix of party sizes and row preferences. A sample of the searches is checked
+// against scoring every block of free adjacent seats.
+class SeatFinderBenchmark {
+private:
+    SeatFinderBenchmarkConfig config;
+
+    static SeatBlock scanBestBlock(const SeatInventory& inventory, int count, const SeatPreference& preference);
+
+public:
+    static const double SCORE_TOLERANCE;
+
+    explicit SeatFinderBenchmark(const SeatFinderBenchmarkConfig& config);
+
+    SeatFinderBenchmarkReport run() const;
+
+    static void printReport(const std::string& label, const SeatFinderBenchmarkReport& report);
+};
+
+#endif // SEAT_FINDER_BENCHMARK_HPP
@@ -0,0 +1,87 @@
+#ifndef SEAT_INVENTORY_HPP
+#define SEAT_INVENTORY_HPP
+
+#include "Seat.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Immutable snapshot of a screen's seating, indexed by row * columns + column.
+// Every show scheduled on the screen shares one snapshot until the screen's
+// layout changes.
+struct SeatLayout {
+    std::string screenId;
+    int rows;
+    int columns;
+    std::vector<SeatType> types;
+    std::vector<double> surcharges;   // Added to the show's base price
+    std::vector<std::uint8_t> blocked; // Seats under maintenance when the snapshot was taken
+};
+
+// Seat state of one show as bitmaps of 64-bit words. Each row starts on a word
+// boundary, so a row of up to 64 seats is a single word. A set bit in `taken`
+// means the seat cannot be reserved; `sold` marks the taken seats that have
+// been paid for and `blocked` the ones under maintenance.
+//
+// reserve() is all-or-nothing and lock-free: it claims the words holding the
+// requested seats with compare-and-swap in ascending order and rolls back the
+// words it already claimed if any seat is taken. Two requests for overlapping
+// seats can never both succeed, and requests for disjoint seats never wait on
+// each other. A rolled-back attempt can make a concurrent reader briefly see
+// seats as taken; it never makes a taken seat look free.
+class SeatInventory {
+private:
+    std::shared_ptr<const SeatLayout> layout;
+    int wordsPerRow;
+    std::vector<std::atomic<std::uint64_t>> taken;
+    std::vector<std::atomic<std::uint64_t>> sold;
+    std::vector<std::atomic<std::uint64_t>> blocked;
+
+    // Word and mask of each seat, grouped by word in ascending order; false on an invalid index
+    bool buildMasks(const std::vector<int>& seatIndices,
+                    std::vector<std::pair<size_t, std::uint64_t>>& masks) const;
+    size_t wordOf(int seatIndex) const;
+    std::uint64_t bitOf(int seatIndex) const;
+
+public:
+    explicit SeatInventory(std::shared_ptr<const SeatLayout> layout);
+
+    SeatInventory(const SeatInventory&) = delete;
+    SeatInventory& operator=(const SeatInventory&) = delete;
+
+    const SeatLayout& getLayout() const;
+    int getRows() const;
+    int getColumns() const;
+    int getTotalSeats() const;
+
+    // Seat index of a screen seat ID ("<screenId>_<row>_<column>", no leading zeros), or -1
+    int indexOf(const std::string& seatId) const;
+    int indexOf(int row, int column) const;
+    std::string seatIdOf(int seatIndex) const;
+
+    SeatType getType(int seatIndex) const;
+    double getSurcharge(int seatIndex) const;
+
+    // State transitions; each returns false and changes nothing if any seat is invalid
+    // or not in the expected state
+    bool reserve(const std::vector<int>& seatIndices);  // AVAILABLE -> RESERVED
+    bool occupy(const std::vector<int>& seatIndices);   // RESERVED -> OCCUPIED
+    bool release(const std::vector<int>& seatIndices);  // RESERVED/OCCUPIED -> AVAILABLE
+    bool setMaintenance(int seatIndex);                 // AVAILABLE -> MAINTENANCE
+    bool clearMaintenance(int seatIndex);               // MAINTENANCE -> AVAILABLE
+
+    // Lock-free reads
+    SeatStatus getStatus(int seatIndex) const;
+    bool isAvailable(int seatIndex) const;
+    int getAvailableCount() const;
+    std::vector<int> getSeatsWithStatus(SeatStatus status) const;
+
+    // Raw word of `taken` for a row: bit c is set if column c cannot be reserved.
+    // Bits past the last column are always set.
+    std::uint64_t getTakenWord(int row, int wordInRow = 0) const;
+    int getWordsPerRow() const;
+};
+
+#endif // SEAT_INVENTORY_HPP
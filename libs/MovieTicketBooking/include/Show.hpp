@@ -3,8 +3,10 @@
 
 #include "Movie.hpp"
 #include "Screen.hpp"
+#include "SeatInventory.hpp"
 #include <string>
 #include <chrono>
+#include <memory>
 #include <vector>
 
 enum class ShowStatus {
@@ -24,6 +26,7 @@ private:
     ShowStatus status;
     double basePrice;
     std::vector<std::string> bookingIds; // List of booking IDs for this show
+    std::unique_ptr<SeatInventory> seatInventory; // Seat state, over the screen's layout at scheduling time
 
 public:
     Show(const std::string& id, Movie* movie, Screen* screen, 
@@ -32,17 +35,20 @@ public:
     // Getters
     std::string getId() const;
     Movie* getMovie() const;
-    Screen* getScreen() const;
+    Screen* getScreen() const;       // nullptr once the screen is removed
+    std::string getScreenId() const; // From the show's own layout, so still known after that
     std::chrono::system_clock::time_point getShowTime() const;
     std::chrono::system_clock::time_point getEndTime() const;
     ShowStatus getStatus() const;
     double getBasePrice() const;
     std::vector<std::string> getBookingIds() const;
+    SeatInventory* getSeatInventory() const;
     
     // Setters
     void setShowTime(const std::chrono::system_clock::time_point& showTime);
     void setStatus(ShowStatus status);
     void setBasePrice(double basePrice);
+    void setScreen(Screen* screen);
     
     // Booking management
     void addBooking(const std::string& bookingId);
@@ -61,6 +67,9 @@ public:
     bool isCancelled() const;
     double getSeatPrice(const std::string& seatId) const;
     double getSeatPrice(int row, int column) const;
+    double getSeatPriceByIndex(int seatIndex) const;
+    int getAvailableSeatCount() const;
+    std::string getSeatLayoutString() const;
     void calculateEndTime();
     std::string getShowInfo() const;
 };
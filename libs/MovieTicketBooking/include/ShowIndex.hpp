@@ -0,0 +1,67 @@
+#ifndef SHOW_INDEX_HPP
+#define SHOW_INDEX_HPP
+
+#include "Show.hpp"
+#include "Theater.hpp"
+#include <chrono>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Maintained lookup for show searches: movie ID -> city -> local calendar day ->
+// shows sorted by start time, plus the theater owning each screen. "Shows of
+// movie X in city Y on day Z" is three hash/tree lookups instead of a scan of
+// every show and theater, and the day of a show is worked out once when it is
+// added rather than with localtime on every search.
+//
+// A show is filed under its theater's location and start time when it is added;
+// re-add it after changing either. Removing a screen or theater also drops the
+// shows filed under its screens, so searches never return them.
+class ShowIndex {
+public:
+    struct Entry {
+        std::chrono::system_clock::time_point startTime;
+        Show* show;
+    };
+
+private:
+    using DayBuckets = std::map<int, std::vector<Entry>>;               // dayKey -> entries by start time
+    using CityBuckets = std::unordered_map<std::string, DayBuckets>;
+
+    struct Position {
+        std::string movieId;
+        std::string city;
+        int dayKey;
+        std::string screenId;   // Kept here since the screen may be gone by the time it is removed
+    };
+
+    std::unordered_map<std::string, CityBuckets> byMovie;
+    std::unordered_map<const Show*, Position> positions;
+    std::unordered_map<std::string, Theater*> screenTheaters;
+
+    static void appendDays(const DayBuckets& days, int dayKey, std::vector<Show*>& result);
+    void removeShowsOn(const std::vector<std::string>& screenIds);
+
+public:
+    // Local calendar day as yyyymmdd
+    static int dayKeyOf(const std::chrono::system_clock::time_point& time);
+
+    // Screen -> theater. Removing a screen or theater unindexes its shows.
+    void addScreen(const std::string& screenId, Theater* theater);
+    void removeScreen(const std::string& screenId);
+    void removeTheater(const Theater* theater);
+    Theater* getTheater(const std::string& screenId) const;
+
+    // False if the show has no movie or its screen belongs to no known theater
+    bool add(Show* show);
+    bool remove(const Show* show);
+    bool contains(const Show* show) const;
+    size_t size() const;
+
+    // Shows sorted by start time. An empty city or a dayKey of 0 matches any.
+    std::vector<Show*> find(const std::string& movieId, const std::string& city, int dayKey) const;
+    const std::vector<Entry>* bucket(const std::string& movieId, const std::string& city, int dayKey) const;
+};
+
+#endif // SHOW_INDEX_HPP
@@ -0,0 +1,62 @@
+#ifndef SHOW_SEARCH_BENCHMARK_HPP
+#define SHOW_SEARCH_BENCHMARK_HPP
+
+#include "MovieTicketBookingSystem.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct ShowSearchConfig {
+    size_t showCount = 1000000;
+    size_t movieCount = 50;
+    size_t cityCount = 20;
+    size_t theatersPerCity = 5;
+    size_t screensPerTheater = 4;     // 400 screens with the defaults above
+    int days = 30;
+    int rows = 2;                     // Small screens; seat maps are not what is measured
+    int columns = 5;
+    size_t queries = 10000;
+    size_t scanQueries = 3;           // The full scan takes seconds; time fewer of them
+    unsigned seed = 5;
+};
+
+struct ShowSearchReport {
+    size_t shows = 0;
+    double setUpSeconds = 0.0;
+    double indexMicros = 0.0;          // searchShows(movie, city, date), per query
+    double scanMicros = 0.0;           // Scan of every show and theater, per query
+    double averageMatches = 0.0;       // Shows returned per indexed query
+    std::uint64_t mismatches = 0;      // Scanned queries whose results differ from the index
+    bool consistent = false;
+    double wallSeconds = 0.0;
+};
+
+// Reproduces the README's show search figures. Shows are spread over movies,
+// cities, screens and days; "movie in city on date" searches through the index
+// are timed against the scan searchShows used to do (every show, every theater
+// with hasScreen, two localtime calls per show), and the scanned queries are
+// checked to return the same shows.
+class ShowSearchBenchmark {
+private:
+    struct Query {
+        std::string title;
+        std::string city;
+        std::chrono::system_clock::time_point date;
+    };
+
+    ShowSearchConfig config;
+    MovieTicketBookingSystem system;
+    std::vector<Query> queries;
+
+    void setUp();
+    std::vector<Show*> scan(const Query& query) const;
+
+public:
+    explicit ShowSearchBenchmark(const ShowSearchConfig& config);
+
+    ShowSearchReport run();
+
+    static void printReport(const std::string& label, const ShowSearchReport& report);
+};
+
+#endif // SHOW_SEARCH_BENCHMARK_HPP
@@ -0,0 +1,152 @@
+#ifndef SLOT_MAP_HPP
+#define SLOT_MAP_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Generational handle: a slot index plus the generation the slot had when the
+// value was stored. Removing a value bumps the slot's generation, so stale
+// handles stop resolving instead of reaching whatever reuses the slot.
+struct SlotHandle {
+    std::uint32_t index = 0;
+    std::uint32_t generation = 0;
+
+    bool operator==(const SlotHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const SlotHandle& other) const { return !(*this == other); }
+
+    // Compact entity ID: prefix, slot index and generation, e.g. "M12.0".
+    // Unique for as long as the slot map lives.
+    std::string toId(char prefix) const {
+        return prefix + std::to_string(index) + "." + std::to_string(generation);
+    }
+
+    // False unless `id` is exactly what toId(prefix) produces for some handle
+    static bool fromId(const std::string& id, char prefix, SlotHandle& handle) {
+        if (id.size() < 4 || id[0] != prefix) return false;
+        std::uint64_t parts[2] = {0, 0};
+        size_t pos = 1;
+        for (int part = 0; part < 2; ++part) {
+            size_t start = pos;
+            while (pos < id.size() && id[pos] >= '0' && id[pos] <= '9') {
+                parts[part] = parts[part] * 10 + (id[pos] - '0');
+                if (parts[part] > UINT32_MAX) return false;
+                pos++;
+            }
+            // No empty numbers or leading zeros, so every handle has a single ID
+            if (pos == start || (id[start] == '0' && pos - start > 1)) return false;
+            if (part == 0 && (pos >= id.size() || id[pos++] != '.')) return false;
+        }
+        if (pos != id.size()) return false;
+        handle.index = static_cast<std::uint32_t>(parts[0]);
+        handle.generation = static_cast<std::uint32_t>(parts[1]);
+        return true;
+    }
+};
+
+// Slot map: O(1) insert, remove and lookup by handle, with values packed in a
+// dense array for iteration. Values are heap-allocated, so pointers to them stay
+// valid until they are removed; removal moves the last value's pointer into the
+// gap, which changes iteration order.
+//
+// Like the standard containers, a SlotMap is not synchronised.
+template <typename T>
+class SlotMap {
+private:
+    struct Slot {
+        std::uint32_t generation = 0;
+        std::uint32_t denseIndex = 0; // Position in `values` while occupied, next free slot otherwise
+        bool occupied = false;
+    };
+
+    static constexpr std::uint32_t NONE = UINT32_MAX;
+
+    std::vector<Slot> slots;
+    std::vector<std::unique_ptr<T>> values;
+    std::vector<std::uint32_t> valueSlots; // Slot of each dense value
+    std::uint32_t freeHead = NONE;
+
+public:
+    using iterator = typename std::vector<std::unique_ptr<T>>::iterator;
+    using const_iterator = typename std::vector<std::unique_ptr<T>>::const_iterator;
+
+    // Stores the value built by make(handle), so the value can embed its own handle
+    // (e.g. in its ID). `make` returns std::unique_ptr<T>.
+    template <typename Factory>
+    std::pair<SlotHandle, T*> emplace(Factory&& make) {
+        std::uint32_t index;
+        if (freeHead != NONE) {
+            index = freeHead;
+            freeHead = slots[index].denseIndex;
+        } else {
+            index = static_cast<std::uint32_t>(slots.size());
+            slots.emplace_back();
+        }
+
+        SlotHandle handle{index, slots[index].generation};
+        values.push_back(make(handle));
+        valueSlots.push_back(index);
+        slots[index].denseIndex = static_cast<std::uint32_t>(values.size() - 1);
+        slots[index].occupied = true;
+        return {handle, values.back().get()};
+    }
+
+    T* get(const SlotHandle& handle) const {
+        if (handle.index >= slots.size()) return nullptr;
+        const Slot& slot = slots[handle.index];
+        if (!slot.occupied || slot.generation != handle.generation) return nullptr;
+        return values[slot.denseIndex].get();
+    }
+
+    bool contains(const SlotHandle& handle) const { return get(handle) != nullptr; }
+
+    // Destroys the value; its handle and any copies stop resolving
+    bool remove(const SlotHandle& handle) {
+        if (!get(handle)) return false;
+        Slot& slot = slots[handle.index];
+
+        // Fill the gap with the last value
+        std::uint32_t gap = slot.denseIndex;
+        std::uint32_t last = static_cast<std::uint32_t>(values.size() - 1);
+        if (gap != last) {
+            values[gap] = std::move(values[last]);
+            valueSlots[gap] = valueSlots[last];
+            slots[valueSlots[gap]].denseIndex = gap;
+        }
+        values.pop_back();
+        valueSlots.pop_back();
+
+        slot.occupied = false;
+        slot.generation++;
+        slot.denseIndex = freeHead;
+        freeHead = handle.index;
+        return true;
+    }
+
+    void clear() {
+        for (std::uint32_t i = 0; i < slots.size(); ++i) {
+            if (slots[i].occupied) {
+                remove({i, slots[i].generation});
+            }
+        }
+    }
+
+    size_t size() const { return values.size(); }
+    bool empty() const { return values.empty(); }
+    void reserve(size_t count) {
+        slots.reserve(count);
+        values.reserve(count);
+        valueSlots.reserve(count);
+    }
+
+    iterator begin() { return values.begin(); }
+    iterator end() { return values.end(); }
+    const_iterator begin() const { return values.begin(); }
+    const_iterator end() const { return values.end(); }
+};
+
+#endif // SLOT_MAP_HPP
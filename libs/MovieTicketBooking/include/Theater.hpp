@@ -2,6 +2,7 @@
 #define THEATER_HPP
 
 #include "Screen.hpp"
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -12,7 +13,7 @@ private:
     std::string location;
     std::string address;
     std::string phone;
-    std::vector<Screen> screens;
+    std::vector<std::unique_ptr<Screen>> screens; // Heap-allocated so Screen* survives adding screens
     bool isActive;
 
 public:
@@ -28,6 +29,7 @@ public:
     bool getIsActive() const;
     std::vector<Screen> getScreens() const;
     Screen* getScreen(const std::string& screenId);
+    std::vector<std::string> getScreenIds() const;
     int getTotalScreens() const;
     
     // Setters
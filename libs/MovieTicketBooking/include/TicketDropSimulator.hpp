@@ -0,0 +1,74 @@
+#ifndef TICKET_DROP_SIMULATOR_HPP
+#define TICKET_DROP_SIMULATOR_HPP
+
+#include "MovieTicketBookingSystem.hpp"
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+struct TicketDropConfig {
+    size_t showCount = 8;
+    int rows = 20;
+    int columns = 30;
+    size_t userCount = 10000;
+    size_t threads = 8;
+    size_t requestsPerThread = 5000;
+    double hotShowShare = 0.7;        // Requests aimed at the first show, the headline release
+    int minSeats = 1;
+    int maxSeats = 4;
+    double bestAvailableShare = 0.5;  // Best-available requests; the rest ask for seats picked at random
+    double confirmShare = 0.8;        // Holds that are confirmed; the rest are cancelled and their seats resold
+    size_t readerThreads = 2;         // Poll seat availability for as long as the rush runs
+    unsigned seed = 1;
+};
+
+struct TicketDropReport {
+    std::uint64_t requests = 0;
+    std::uint64_t holds = 0;           // Requests that got their seats
+    std::uint64_t rejected = 0;        // Enough seats were free, but not the ones asked for
+    std::uint64_t soldOut = 0;         // Too few seats left in the show
+    std::uint64_t confirmed = 0;
+    std::uint64_t cancelled = 0;
+    std::uint64_t availabilityReads = 0;
+    std::uint64_t seatsSold = 0;
+    double successRate = 0.0;          // holds / requests
+    double requestsPerSecond = 0.0;
+    double p50LatencyMicros = 0.0;     // Seat request to hold or refusal
+    double p99LatencyMicros = 0.0;
+    double maxLatencyMicros = 0.0;
+    bool consistent = false;           // No seat sold twice and the seat bitmaps agree with the bookings
+    double wallSeconds = 0.0;
+};
+
+// Load generator for a ticket drop: every worker thread is released at the same
+// instant and fires seat requests at a handful of shows, most of them at one hot
+// show, while reader threads poll availability. Each successful hold is then
+// confirmed or cancelled, so cancelled seats go back into the rush. Afterwards the
+// confirmed bookings are checked against the shows' seat bitmaps.
+class TicketDropSimulator {
+private:
+    struct WorkerResult {
+        TicketDropReport counts;
+        std::vector<double> latencies;
+    };
+
+    TicketDropConfig config;
+    MovieTicketBookingSystem system;
+    std::vector<std::string> userIds;
+    std::vector<Show*> shows;
+
+    void setUp();
+    void runWorker(size_t worker, WorkerResult& result);
+    std::vector<std::string> randomSeats(const SeatInventory& inventory, int count, std::mt19937& rng) const;
+    bool checkConsistency(std::uint64_t& seatsSold);
+
+public:
+    explicit TicketDropSimulator(const TicketDropConfig& config);
+
+    TicketDropReport run();
+
+    static void printReport(const std::string& label, const TicketDropReport& report);
+};
+
+#endif // TICKET_DROP_SIMULATOR_HPP
@@ -0,0 +1,55 @@
+#ifndef TIMING_WHEEL_HPP
+#define TIMING_WHEEL_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Hashed timing wheel of string keys. Time is cut into ticks and a key lives in
+// the slot of its deadline tick, so advancing the clock only visits the slots it
+// passes and the keys in them: releasing expired keys costs O(expired) rather
+// than a scan of everything scheduled. Deadlines further out than one revolution
+// stay in their slot until the wheel comes round to the right tick.
+//
+// Cancelling or rescheduling is O(1): the key's entry in `deadlines` is changed
+// and the old slot entry is dropped when its slot is next visited.
+class TimingWheel {
+public:
+    using Clock = std::chrono::system_clock;
+
+private:
+    struct Entry {
+        std::string key;
+        std::int64_t deadlineTick;
+    };
+
+    Clock::time_point origin;
+    Clock::duration tick;
+    std::vector<std::vector<Entry>> slots;
+    std::unordered_map<std::string, std::int64_t> deadlines; // Live keys -> deadline tick
+    std::int64_t currentTick;
+
+    std::int64_t tickOf(const Clock::time_point& time, bool roundUp) const;
+
+public:
+    explicit TimingWheel(Clock::duration tick = std::chrono::seconds(1), size_t slotCount = 1024,
+                         Clock::time_point origin = Clock::now());
+
+    // Schedules or reschedules a key. A key never fires before its deadline and
+    // fires at most one tick after it; a deadline already past fires on the next tick.
+    void schedule(const std::string& key, const Clock::time_point& deadline);
+    bool cancel(const std::string& key);
+    bool contains(const std::string& key) const;
+    size_t size() const;
+
+    // Moves the wheel to `now` and returns the keys whose deadline has passed,
+    // removing them from the wheel
+    std::vector<std::string> advance(const Clock::time_point& now);
+
+    Clock::duration getTick() const;
+    size_t getSlotCount() const;
+};
+
+#endif // TIMING_WHEEL_HPP
@@ -27,6 +27,7 @@ void Booking::setStatus(BookingStatus status) { this->status = status; }
 void Booking::setTotalAmount(double amount) { this->totalAmount = amount; }
 void Booking::setPayment(Payment* payment) { this->payment = payment; }
 void Booking::setExpiryTime(const std::chrono::system_clock::time_point& expiryTime) { this->expiryTime = expiryTime; }
+void Booking::setShow(Show* show) { this->show = show; }
 
 void Booking::addSeat(const std::string& seatId) {
     if (std::find(seatIds.begin(), seatIds.end(), seatId) == seatIds.end()) {
@@ -145,8 +146,8 @@ std::string Booking::getBookingInfo() const {
 }
 
 std::string Booking::generateBookingCode() const {
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    // Seeding a generator per code costs more than making the booking; each thread keeps one
+    thread_local std::mt19937 gen(std::random_device{}());
     std::uniform_int_distribution<> dis(100000, 999999);
     
     std::ostringstream oss;
@@ -2,8 +2,53 @@
 #include <algorithm>
 #include <sstream>
 #include <chrono>
+#include <mutex>
+#include <shared_mutex>
+
+namespace {
+    const char MOVIE_PREFIX = 'M';
+    const char THEATER_PREFIX = 'T';
+    const char SHOW_PREFIX = 'S';
+    const char USER_PREFIX = 'U';
+
+    template <typename T>
+    T* lookup(const SlotMap<T>& entities, char prefix, const std::string& id) {
+        SlotHandle handle;
+        return SlotHandle::fromId(id, prefix, handle) ? entities.get(handle) : nullptr;
+    }
+
+    template <typename T>
+    bool removeEntity(SlotMap<T>& entities, char prefix, const std::string& id) {
+        SlotHandle handle;
+        return SlotHandle::fromId(id, prefix, handle) && entities.remove(handle);
+    }
 
-MovieTicketBookingSystem::MovieTicketBookingSystem() {}
+    // Maps seat IDs to the show's seat indices; false if any ID is not a seat of the show
+    bool toSeatIndices(const SeatInventory& inventory, const std::vector<std::string>& seatIds,
+                       std::vector<int>& seatIndices) {
+        seatIndices.clear();
+        seatIndices.reserve(seatIds.size());
+        for (const auto& seatId : seatIds) {
+            int index = inventory.indexOf(seatId);
+            if (index < 0) {
+                return false;
+            }
+            seatIndices.push_back(index);
+        }
+        return true;
+    }
+
+    bool releaseBookingSeats(Booking* booking) {
+        Show* show = booking->getShow();
+        if (!show || !show->getSeatInventory()) return false;
+        std::vector<int> seatIndices;
+        if (!toSeatIndices(*show->getSeatInventory(), booking->getSeatIds(), seatIndices)) return false;
+        return show->getSeatInventory()->release(seatIndices);
+    }
+}
+
+MovieTicketBookingSystem::MovieTicketBookingSystem()
+    : nextId(0), holdDuration(std::chrono::minutes(15)), nextHoldSweep(0) {}
 
 MovieTicketBookingSystem::~MovieTicketBookingSystem() {}
 
@@ -11,33 +56,29 @@ MovieTicketBookingSystem::~MovieTicketBookingSystem() {}
 Movie* MovieTicketBookingSystem::addMovie(const std::string& title, const std::string& description,
                                          Genre genre, int duration, Rating rating, const std::string& director,
                                          const std::vector<std::string>& cast, const std::string& language) {
-    std::string id = generateId();
-    auto movie = std::make_unique<Movie>(id, title, description, genre, duration, rating, director, cast, language);
-    Movie* moviePtr = movie.get();
-    movies.push_back(std::move(movie));
-    movieMap[id] = moviePtr;
-    return moviePtr;
+    std::lock_guard<std::shared_mutex> lock(catalogMutex);
+    return movies.emplace([&](const SlotHandle& handle) {
+        return std::make_unique<Movie>(handle.toId(MOVIE_PREFIX), title, description, genre, duration, rating,
+                                       director, cast, language);
+    }).second;
 }
 
 bool MovieTicketBookingSystem::removeMovie(const std::string& movieId) {
-    auto it = std::find_if(movies.begin(), movies.end(),
-                          [&movieId](const std::unique_ptr<Movie>& movie) {
-                              return movie->getId() == movieId;
-                          });
-    if (it != movies.end()) {
-        movieMap.erase(movieId);
-        movies.erase(it);
-        return true;
-    }
-    return false;
+    std::lock_guard<std::shared_mutex> lock(catalogMutex);
+    return removeEntity(movies, MOVIE_PREFIX, movieId);
 }
 
 Movie* MovieTicketBookingSystem::getMovie(const std::string& movieId) {
-    auto it = movieMap.find(movieId);
-    return (it != movieMap.end()) ? it->second : nullptr;
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
+    return findMovie(movieId);
+}
+
+Movie* MovieTicketBookingSystem::findMovie(const std::string& movieId) const {
+    return lookup(movies, MOVIE_PREFIX, movieId);
 }
 
 std::vector<Movie*> MovieTicketBookingSystem::getAllMovies() const {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
     std::vector<Movie*> result;
     for (const auto& movie : movies) {
         result.push_back(movie.get());
@@ -46,6 +87,7 @@ std::vector<Movie*> MovieTicketBookingSystem::getAllMovies() const {
 }
 
 std::vector<Movie*> MovieTicketBookingSystem::getMoviesByGenre(Genre genre) const {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
     std::vector<Movie*> result;
     for (const auto& movie : movies) {
         if (movie->getGenre() == genre && movie->getIsActive()) {
@@ -56,6 +98,11 @@ std::vector<Movie*> MovieTicketBookingSystem::getMoviesByGenre(Genre genre) cons
 }
 
 std::vector<Movie*> MovieTicketBookingSystem::getActiveMovies() const {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
+    return collectActiveMovies();
+}
+
+std::vector<Movie*> MovieTicketBookingSystem::collectActiveMovies() const {
     std::vector<Movie*> result;
     for (const auto& movie : movies) {
         if (movie->getIsActive()) {
@@ -68,33 +115,32 @@ std::vector<Movie*> MovieTicketBookingSystem::getActiveMovies() const {
 // Theater management
 Theater* MovieTicketBookingSystem::addTheater(const std::string& name, const std::string& location,
                                              const std::string& address, const std::string& phone) {
-    std::string id = generateId();
-    auto theater = std::make_unique<Theater>(id, name, location, address, phone);
-    Theater* theaterPtr = theater.get();
-    theaters.push_back(std::move(theater));
-    theaterMap[id] = theaterPtr;
-    return theaterPtr;
+    std::lock_guard<std::shared_mutex> lock(catalogMutex);
+    return theaters.emplace([&](const SlotHandle& handle) {
+        return std::make_unique<Theater>(handle.toId(THEATER_PREFIX), name, location, address, phone);
+    }).second;
 }
 
 bool MovieTicketBookingSystem::removeTheater(const std::string& theaterId) {
-    auto it = std::find_if(theaters.begin(), theaters.end(),
-                          [&theaterId](const std::unique_ptr<Theater>& theater) {
-                              return theater->getId() == theaterId;
-                          });
-    if (it != theaters.end()) {
-        theaterMap.erase(theaterId);
-        theaters.erase(it);
-        return true;
-    }
-    return false;
+    std::lock_guard<std::shared_mutex> lock(catalogMutex);
+    Theater* theater = findTheater(theaterId);
+    if (!theater) return false;
+    detachScreens(theater->getScreenIds());
+    showIndex.removeTheater(theater);
+    return removeEntity(theaters, THEATER_PREFIX, theaterId);
 }
 
 Theater* MovieTicketBookingSystem::getTheater(const std::string& theaterId) {
-    auto it = theaterMap.find(theaterId);
-    return (it != theaterMap.end()) ? it->second : nullptr;
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
+    return findTheater(theaterId);
+}
+
+Theater* MovieTicketBookingSystem::findTheater(const std::string& theaterId) const {
+    return lookup(theaters, THEATER_PREFIX, theaterId);
 }
 
 std::vector<Theater*> MovieTicketBookingSystem::getAllTheaters() const {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
     std::vector<Theater*> result;
     for (const auto& theater : theaters) {
         result.push_back(theater.get());
@@ -103,6 +149,7 @@ std::vector<Theater*> MovieTicketBookingSystem::getAllTheaters() const {
 }
 
 std::vector<Theater*> MovieTicketBookingSystem::getTheatersByLocation(const std::string& location) const {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
     std::vector<Theater*> result;
     for (const auto& theater : theaters) {
         if (theater->getLocation() == location && theater->getIsActive()) {
@@ -115,62 +162,99 @@ std::vector<Theater*> MovieTicketBookingSystem::getTheatersByLocation(const std:
 // Screen management
 Screen* MovieTicketBookingSystem::addScreenToTheater(const std::string& theaterId, const std::string& screenName,
                                                     int totalRows, int totalColumns) {
-    Theater* theater = getTheater(theaterId);
+    std::lock_guard<std::shared_mutex> lock(catalogMutex);
+    Theater* theater = findTheater(theaterId);
     if (!theater) return nullptr;
     
     std::string screenId = generateId();
     Screen screen(screenId, screenName, totalRows, totalColumns);
     theater->addScreen(screen);
+    showIndex.addScreen(screenId, theater);
     return theater->getScreen(screenId);
 }
 
 bool MovieTicketBookingSystem::removeScreenFromTheater(const std::string& theaterId, const std::string& screenId) {
-    Theater* theater = getTheater(theaterId);
+    std::lock_guard<std::shared_mutex> lock(catalogMutex);
+    Theater* theater = findTheater(theaterId);
     if (!theater) return false;
-    return theater->removeScreen(screenId);
+    if (!theater->hasScreen(screenId)) return false;
+    detachScreens({screenId});
+    theater->removeScreen(screenId);
+    showIndex.removeScreen(screenId);
+    return true;
 }
 
 Screen* MovieTicketBookingSystem::getScreen(const std::string& theaterId, const std::string& screenId) {
-    Theater* theater = getTheater(theaterId);
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
+    Theater* theater = findTheater(theaterId);
     if (!theater) return nullptr;
     return theater->getScreen(screenId);
 }
 
+void MovieTicketBookingSystem::detachScreens(const std::vector<std::string>& screenIds) {
+    if (screenIds.empty()) return;
+    // Shows keep their own layout and seat state; only the pointer to the screen goes
+    for (auto& show : shows) {
+        if (show->getScreen() &&
+            std::find(screenIds.begin(), screenIds.end(), show->getScreenId()) != screenIds.end()) {
+            show->setScreen(nullptr);
+        }
+    }
+}
+
 // Show management
 Show* MovieTicketBookingSystem::addShow(const std::string& movieId, const std::string& theaterId,
                                        const std::string& screenId, const std::chrono::system_clock::time_point& showTime,
                                        double basePrice) {
-    Movie* movie = getMovie(movieId);
-    Screen* screen = getScreen(theaterId, screenId);
+    std::lock_guard<std::shared_mutex> lock(catalogMutex);
+    Movie* movie = findMovie(movieId);
+    Theater* theater = findTheater(theaterId);
+    Screen* screen = theater ? theater->getScreen(screenId) : nullptr;
     if (!movie || !screen) return nullptr;
     
-    std::string id = generateId();
-    auto show = std::make_unique<Show>(id, movie, screen, showTime, basePrice);
-    Show* showPtr = show.get();
-    shows.push_back(std::move(show));
-    showMap[id] = showPtr;
+    Show* showPtr = shows.emplace([&](const SlotHandle& handle) {
+        return std::make_unique<Show>(handle.toId(SHOW_PREFIX), movie, screen, showTime, basePrice);
+    }).second;
+    showIndex.add(showPtr);
     return showPtr;
 }
 
 bool MovieTicketBookingSystem::removeShow(const std::string& showId) {
-    auto it = std::find_if(shows.begin(), shows.end(),
-                          [&showId](const std::unique_ptr<Show>& show) {
-                              return show->getId() == showId;
-                          });
-    if (it != shows.end()) {
-        showMap.erase(showId);
-        shows.erase(it);
-        return true;
+    std::lock_guard<std::shared_mutex> lock(catalogMutex);
+    Show* show = findShow(showId);
+    if (!show) return false;
+    detachBookings(show);
+    showIndex.remove(show);
+    return removeEntity(shows, SHOW_PREFIX, showId);
+}
+
+void MovieTicketBookingSystem::detachBookings(Show* show) {
+    // Bookings outlive their show. Drop the holds so the wheel never hands them
+    // back, expire the pending ones and clear their show pointer; the seats go
+    // with the show's inventory.
+    for (const auto& bookingId : show->getBookingIds()) {
+        Booking* booking = bookings.find(bookingId);
+        if (!booking) continue;
+        {
+            std::lock_guard<std::mutex> holdLock(holdMutex);
+            holdTimer.cancel(bookingId);
+        }
+        booking->expireBooking();
+        booking->setShow(nullptr);
     }
-    return false;
 }
 
 Show* MovieTicketBookingSystem::getShow(const std::string& showId) {
-    auto it = showMap.find(showId);
-    return (it != showMap.end()) ? it->second : nullptr;
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
+    return findShow(showId);
+}
+
+Show* MovieTicketBookingSystem::findShow(const std::string& showId) const {
+    return lookup(shows, SHOW_PREFIX, showId);
 }
 
 std::vector<Show*> MovieTicketBookingSystem::getAllShows() const {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
     std::vector<Show*> result;
     for (const auto& show : shows) {
         result.push_back(show.get());
@@ -179,6 +263,7 @@ std::vector<Show*> MovieTicketBookingSystem::getAllShows() const {
 }
 
 std::vector<Show*> MovieTicketBookingSystem::getShowsByMovie(const std::string& movieId) const {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
     std::vector<Show*> result;
     for (const auto& show : shows) {
         if (show->getMovie() && show->getMovie()->getId() == movieId) {
@@ -189,21 +274,25 @@ std::vector<Show*> MovieTicketBookingSystem::getShowsByMovie(const std::string&
 }
 
 std::vector<Show*> MovieTicketBookingSystem::getShowsByTheater(const std::string& theaterId) const {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
     std::vector<Show*> result;
-    auto it = theaterMap.find(theaterId);
-    Theater* theater = (it != theaterMap.end()) ? it->second : nullptr;
+    Theater* theater = findTheater(theaterId);
+    if (!theater) return result;
     
     for (const auto& show : shows) {
-        if (show->getScreen() && theater) {
-            if (theater->hasScreen(show->getScreen()->getId())) {
-                result.push_back(show.get());
-            }
+        if (showIndex.getTheater(show->getScreenId()) == theater) {
+            result.push_back(show.get());
         }
     }
     return result;
 }
 
 std::vector<Show*> MovieTicketBookingSystem::getUpcomingShows() const {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
+    return collectUpcomingShows();
+}
+
+std::vector<Show*> MovieTicketBookingSystem::collectUpcomingShows() const {
     std::vector<Show*> result;
     auto now = std::chrono::system_clock::now();
     for (const auto& show : shows) {
@@ -217,33 +306,28 @@ std::vector<Show*> MovieTicketBookingSystem::getUpcomingShows() const {
 // User management
 User* MovieTicketBookingSystem::addUser(const std::string& name, const std::string& email, const std::string& phone,
                                        const std::string& password, UserType type) {
-    std::string id = generateId();
-    auto user = std::make_unique<User>(id, name, email, phone, password, type);
-    User* userPtr = user.get();
-    users.push_back(std::move(user));
-    userMap[id] = userPtr;
-    return userPtr;
+    std::lock_guard<std::shared_mutex> lock(catalogMutex);
+    return users.emplace([&](const SlotHandle& handle) {
+        return std::make_unique<User>(handle.toId(USER_PREFIX), name, email, phone, password, type);
+    }).second;
 }
 
 bool MovieTicketBookingSystem::removeUser(const std::string& userId) {
-    auto it = std::find_if(users.begin(), users.end(),
-                          [&userId](const std::unique_ptr<User>& user) {
-                              return user->getId() == userId;
-                          });
-    if (it != users.end()) {
-        userMap.erase(userId);
-        users.erase(it);
-        return true;
-    }
-    return false;
+    std::lock_guard<std::shared_mutex> lock(catalogMutex);
+    return removeEntity(users, USER_PREFIX, userId);
 }
 
 User* MovieTicketBookingSystem::getUser(const std::string& userId) {
-    auto it = userMap.find(userId);
-    return (it != userMap.end()) ? it->second : nullptr;
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
+    return findUser(userId);
+}
+
+User* MovieTicketBookingSystem::findUser(const std::string& userId) const {
+    return lookup(users, USER_PREFIX, userId);
 }
 
 User* MovieTicketBookingSystem::getUserByEmail(const std::string& email) {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
     for (const auto& user : users) {
         if (user->getEmail() == email) {
             return user.get();
@@ -253,6 +337,7 @@ User* MovieTicketBookingSystem::getUserByEmail(const std::string& email) {
 }
 
 std::vector<User*> MovieTicketBookingSystem::getAllUsers() const {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
     std::vector<User*> result;
     for (const auto& user : users) {
         result.push_back(user.get());
@@ -271,69 +356,134 @@ bool MovieTicketBookingSystem::authenticateUser(const std::string& email, const
 // Booking management
 Booking* MovieTicketBookingSystem::createBooking(const std::string& userId, const std::string& showId,
                                                 const std::vector<std::string>& seatIds) {
-    User* user = getUser(userId);
-    Show* show = getShow(showId);
-    if (!user || !show) return nullptr;
+    // Free seats whose holds have lapsed before competing for them
+    sweepDueHolds();
+    
+    std::shared_lock<std::shared_mutex> catalog(catalogMutex);
+    User* user = findUser(userId);
+    Show* show = findShow(showId);
+    if (!user || !show || !show->getSeatInventory()) return nullptr;
+    
+    // Hold every requested seat or none of them. This is a compare-and-swap on the
+    // show's seat bitmap, so buyers racing for the same show never wait on a lock here.
+    std::vector<int> seatIndices;
+    if (!toSeatIndices(*show->getSeatInventory(), seatIds, seatIndices) ||
+        !show->getSeatInventory()->reserve(seatIndices)) {
+        return nullptr;
+    }
     
     // Calculate total amount
-    double totalAmount = calculateTotalAmount(showId, seatIds);
+    double totalAmount = 0.0;
+    for (int seatIndex : seatIndices) {
+        totalAmount += show->getSeatPriceByIndex(seatIndex);
+    }
     
     std::string id = generateId();
     auto booking = std::make_unique<Booking>(id, user, show, seatIds, totalAmount);
-    Booking* bookingPtr = booking.get();
-    bookings.push_back(std::move(booking));
-    bookingMap[id] = bookingPtr;
     
-    // Add booking to user and show
-    user->addBooking(id);
-    show->addBooking(id);
+    Booking* bookingPtr;
+    {
+        // Expiry and cancellation take the show's stripe too, so they cannot see the
+        // booking before it is listed and scheduled
+        std::lock_guard<std::mutex> showLock(showLocks.of(show));
+        bookingPtr = bookings.insert(id, std::move(booking));
+        show->addBooking(id);
+        std::lock_guard<std::mutex> holdLock(holdMutex);
+        bookingPtr->setExpiryTime(bookingPtr->getBookingTime() + holdDuration);
+        holdTimer.schedule(id, bookingPtr->getExpiryTime());
+    }
+    {
+        std::lock_guard<std::mutex> userLock(userLocks.of(user));
+        user->addBooking(id);
+    }
     
     return bookingPtr;
 }
 
 bool MovieTicketBookingSystem::cancelBooking(const std::string& bookingId) {
-    Booking* booking = getBooking(bookingId);
+    Booking* booking = bookings.find(bookingId);
     if (!booking) return false;
     
-    if (booking->cancelBooking()) {
-        // Release seats
-        Show* show = booking->getShow();
-        if (show && show->getScreen()) {
-            for (const auto& seatId : booking->getSeatIds()) {
-                show->getScreen()->releaseSeat(seatId);
-            }
-        }
-        return true;
+    std::shared_lock<std::shared_mutex> catalog(catalogMutex);
+    std::lock_guard<std::mutex> showLock(showLocks.of(booking->getShow()));
+    if (!booking->cancelBooking()) return false;
+    
+    // Release seats
+    {
+        std::lock_guard<std::mutex> holdLock(holdMutex);
+        holdTimer.cancel(bookingId);
     }
-    return false;
+    releaseBookingSeats(booking);
+    return true;
 }
 
 bool MovieTicketBookingSystem::confirmBooking(const std::string& bookingId) {
-    Booking* booking = getBooking(bookingId);
+    Booking* booking = bookings.find(bookingId);
     if (!booking) return false;
-    return booking->confirmBooking();
+    
+    std::shared_lock<std::shared_mutex> catalog(catalogMutex);
+    std::lock_guard<std::mutex> showLock(showLocks.of(booking->getShow()));
+    
+    // A lapsed hold cannot be confirmed, even if the wheel has not released it yet
+    if (booking->isPending() && booking->isExpiredNow()) {
+        expireHold(booking);
+        return false;
+    }
+    if (!booking->confirmBooking()) return false;
+    {
+        std::lock_guard<std::mutex> holdLock(holdMutex);
+        holdTimer.cancel(bookingId);
+    }
+    
+    // Reserved seats become sold
+    Show* show = booking->getShow();
+    std::vector<int> seatIndices;
+    if (show && show->getSeatInventory() &&
+        toSeatIndices(*show->getSeatInventory(), booking->getSeatIds(), seatIndices)) {
+        show->getSeatInventory()->occupy(seatIndices);
+    }
+    return true;
 }
 
 Booking* MovieTicketBookingSystem::getBooking(const std::string& bookingId) {
-    auto it = bookingMap.find(bookingId);
-    return (it != bookingMap.end()) ? it->second : nullptr;
+    return bookings.find(bookingId);
 }
 
 std::vector<Booking*> MovieTicketBookingSystem::getBookingsByUser(const std::string& userId) const {
+    std::vector<std::string> bookingIds;
+    {
+        std::shared_lock<std::shared_mutex> catalog(catalogMutex);
+        User* user = findUser(userId);
+        if (!user) return {};
+        std::lock_guard<std::mutex> userLock(userLocks.of(user));
+        bookingIds = user->getBookingIds();
+    }
+    
     std::vector<Booking*> result;
-    for (const auto& booking : bookings) {
-        if (booking->getUser() && booking->getUser()->getId() == userId) {
-            result.push_back(booking.get());
+    for (const auto& bookingId : bookingIds) {
+        Booking* booking = bookings.find(bookingId);
+        if (booking) {
+            result.push_back(booking);
         }
     }
     return result;
 }
 
 std::vector<Booking*> MovieTicketBookingSystem::getBookingsByShow(const std::string& showId) const {
+    std::vector<std::string> bookingIds;
+    {
+        std::shared_lock<std::shared_mutex> catalog(catalogMutex);
+        Show* show = findShow(showId);
+        if (!show) return {};
+        std::lock_guard<std::mutex> showLock(showLocks.of(show));
+        bookingIds = show->getBookingIds();
+    }
+    
     std::vector<Booking*> result;
-    for (const auto& booking : bookings) {
-        if (booking->getShow() && booking->getShow()->getId() == showId) {
-            result.push_back(booking.get());
+    for (const auto& bookingId : bookingIds) {
+        Booking* booking = bookings.find(bookingId);
+        if (booking) {
+            result.push_back(booking);
         }
     }
     return result;
@@ -341,23 +491,105 @@ std::vector<Booking*> MovieTicketBookingSystem::getBookingsByShow(const std::str
 
 std::vector<Booking*> MovieTicketBookingSystem::getAllBookings() const {
     std::vector<Booking*> result;
-    for (const auto& booking : bookings) {
-        result.push_back(booking.get());
-    }
+    bookings.forEach([&result](Booking* booking) { result.push_back(booking); });
+    
+    // The registry is hashed; list bookings in the order they were made
+    std::sort(result.begin(), result.end(), [](const Booking* a, const Booking* b) {
+        return a->getBookingTime() < b->getBookingTime();
+    });
     return result;
 }
 
+// Seat holds
+void MovieTicketBookingSystem::setHoldDuration(std::chrono::seconds duration) {
+    if (duration.count() > 0) {
+        std::lock_guard<std::mutex> lock(holdMutex);
+        holdDuration = duration;
+    }
+}
+
+std::chrono::seconds MovieTicketBookingSystem::getHoldDuration() const {
+    std::lock_guard<std::mutex> lock(holdMutex);
+    return holdDuration;
+}
+
+bool MovieTicketBookingSystem::extendHold(const std::string& bookingId, std::chrono::seconds extra) {
+    Booking* booking = bookings.find(bookingId);
+    if (!booking || extra.count() <= 0) return false;
+    
+    std::shared_lock<std::shared_mutex> catalog(catalogMutex);
+    std::lock_guard<std::mutex> showLock(showLocks.of(booking->getShow()));
+    if (!booking->isPending() || booking->isExpiredNow()) return false;
+    
+    std::lock_guard<std::mutex> holdLock(holdMutex);
+    booking->setExpiryTime(booking->getExpiryTime() + extra);
+    holdTimer.schedule(bookingId, booking->getExpiryTime());
+    return true;
+}
+
+size_t MovieTicketBookingSystem::releaseExpiredHolds(const std::chrono::system_clock::time_point& now) {
+    std::vector<std::string> due;
+    {
+        std::lock_guard<std::mutex> holdLock(holdMutex);
+        due = holdTimer.advance(now);
+    }
+    if (due.empty()) return 0;
+    
+    size_t released = 0;
+    std::shared_lock<std::shared_mutex> catalog(catalogMutex);
+    for (const auto& bookingId : due) {
+        Booking* booking = bookings.find(bookingId);
+        if (!booking) continue;
+        std::lock_guard<std::mutex> showLock(showLocks.of(booking->getShow()));
+        // Extended after the wheel handed it out; the extension rescheduled it
+        if (booking->getExpiryTime() > now) continue;
+        if (expireHold(booking)) {
+            released++;
+        }
+    }
+    return released;
+}
+
+void MovieTicketBookingSystem::sweepDueHolds() {
+    // The wheel only releases holds once per tick, so sweeping more often finds
+    // nothing. The first caller to see a new tick claims it; everyone else reads
+    // one atomic and moves on without touching holdMutex.
+    auto now = std::chrono::system_clock::now();
+    std::chrono::system_clock::rep nowTicks = now.time_since_epoch().count();
+    std::chrono::system_clock::rep due = nextHoldSweep.load(std::memory_order_relaxed);
+    if (nowTicks < due) return;
+    if (!nextHoldSweep.compare_exchange_strong(due, nowTicks + holdTimer.getTick().count(),
+                                               std::memory_order_relaxed)) {
+        return;
+    }
+    releaseExpiredHolds(now);
+}
+
+size_t MovieTicketBookingSystem::getActiveHoldCount() const {
+    std::lock_guard<std::mutex> lock(holdMutex);
+    return holdTimer.size();
+}
+
+bool MovieTicketBookingSystem::expireHold(Booking* booking) {
+    {
+        std::lock_guard<std::mutex> holdLock(holdMutex);
+        holdTimer.cancel(booking->getId());
+    }
+    if (!booking->expireBooking()) return false;
+    releaseBookingSeats(booking);
+    return true;
+}
+
 // Payment management
 Payment* MovieTicketBookingSystem::createPayment(const std::string& bookingId, double amount, PaymentMethod method) {
     std::string id = generateId();
-    auto payment = std::make_unique<Payment>(id, bookingId, amount, method);
-    Payment* paymentPtr = payment.get();
-    payments.push_back(std::move(payment));
-    paymentMap[id] = paymentPtr;
+    Payment* paymentPtr = payments.insert(id, std::make_unique<Payment>(id, bookingId, amount, method));
     
     // Link payment to booking
-    Booking* booking = getBooking(bookingId);
+    Booking* booking = bookings.find(bookingId);
     if (booking) {
+        std::shared_lock<std::shared_mutex> catalog(catalogMutex);
+        std::lock_guard<std::mutex> showLock(showLocks.of(booking->getShow()));
         booking->setPayment(paymentPtr);
     }
     
@@ -365,133 +597,133 @@ Payment* MovieTicketBookingSystem::createPayment(const std::string& bookingId, d
 }
 
 bool MovieTicketBookingSystem::processPayment(const std::string& paymentId) {
-    Payment* payment = getPayment(paymentId);
+    Payment* payment = payments.find(paymentId);
     if (!payment) return false;
+    std::lock_guard<std::mutex> lock(paymentLocks.of(payment));
     return payment->processPayment();
 }
 
 bool MovieTicketBookingSystem::refundPayment(const std::string& paymentId) {
-    Payment* payment = getPayment(paymentId);
+    Payment* payment = payments.find(paymentId);
     if (!payment) return false;
+    std::lock_guard<std::mutex> lock(paymentLocks.of(payment));
     return payment->refundPayment();
 }
 
 Payment* MovieTicketBookingSystem::getPayment(const std::string& paymentId) {
-    auto it = paymentMap.find(paymentId);
-    return (it != paymentMap.end()) ? it->second : nullptr;
+    return payments.find(paymentId);
 }
 
 std::vector<Payment*> MovieTicketBookingSystem::getPaymentsByBooking(const std::string& bookingId) const {
     std::vector<Payment*> result;
-    for (const auto& payment : payments) {
+    payments.forEach([&](Payment* payment) {
         if (payment->getBookingId() == bookingId) {
-            result.push_back(payment.get());
+            result.push_back(payment);
         }
-    }
+    });
     return result;
 }
 
 // Seat management
 bool MovieTicketBookingSystem::reserveSeats(const std::string& showId, const std::vector<std::string>& seatIds,
-                                           const std::string& bookingId) {
-    Show* show = getShow(showId);
-    if (!show || !show->getScreen()) return false;
-    
-    bool allReserved = true;
-    for (const auto& seatId : seatIds) {
-        if (!show->getScreen()->reserveSeat(seatId, bookingId)) {
-            allReserved = false;
-            break;
-        }
-    }
-    
-    if (!allReserved) {
-        // Release any seats that were reserved
-        for (const auto& seatId : seatIds) {
-            show->getScreen()->releaseSeat(seatId);
-        }
-    }
+                                           const std::string& /* bookingId */) {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
+    Show* show = findShow(showId);
+    if (!show || !show->getSeatInventory()) return false;
     
-    return allReserved;
+    std::vector<int> seatIndices;
+    if (!toSeatIndices(*show->getSeatInventory(), seatIds, seatIndices)) return false;
+    return show->getSeatInventory()->reserve(seatIndices);
 }
 
 bool MovieTicketBookingSystem::releaseSeats(const std::string& showId, const std::vector<std::string>& seatIds) {
-    Show* show = getShow(showId);
-    if (!show || !show->getScreen()) return false;
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
+    Show* show = findShow(showId);
+    if (!show || !show->getSeatInventory()) return false;
     
-    for (const auto& seatId : seatIds) {
-        show->getScreen()->releaseSeat(seatId);
-    }
-    return true;
+    std::vector<int> seatIndices;
+    if (!toSeatIndices(*show->getSeatInventory(), seatIds, seatIndices)) return false;
+    return show->getSeatInventory()->release(seatIndices);
 }
 
 std::vector<Seat*> MovieTicketBookingSystem::getAvailableSeats(const std::string& showId) const {
-    auto it = showMap.find(showId);
-    Show* show = (it != showMap.end()) ? it->second : nullptr;
-    if (!show || !show->getScreen()) return {};
-    return show->getScreen()->getAvailableSeats();
+    return getSeatsWithStatus(showId, SeatStatus::AVAILABLE);
 }
 
 std::vector<Seat*> MovieTicketBookingSystem::getReservedSeats(const std::string& showId) const {
-    auto it = showMap.find(showId);
-    Show* show = (it != showMap.end()) ? it->second : nullptr;
-    if (!show || !show->getScreen()) return {};
-    return show->getScreen()->getReservedSeats();
+    return getSeatsWithStatus(showId, SeatStatus::RESERVED);
+}
+
+std::vector<Seat*> MovieTicketBookingSystem::getSeatsWithStatus(const std::string& showId, SeatStatus status) const {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
+    Show* show = findShow(showId);
+    if (!show || !show->getScreen() || !show->getSeatInventory()) return {};
+    
+    // Seat objects carry the screen layout; their status is not the show's
+    std::vector<Seat*> result;
+    SeatInventory* inventory = show->getSeatInventory();
+    for (int index : inventory->getSeatsWithStatus(status)) {
+        Seat* seat = show->getScreen()->getSeat(index / inventory->getColumns(), index % inventory->getColumns());
+        if (seat) {
+            result.push_back(seat);
+        }
+    }
+    return result;
+}
+
+std::vector<std::string> MovieTicketBookingSystem::findBestSeats(const std::string& showId, int count,
+                                                                const SeatPreference& preference) const {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
+    Show* show = findShow(showId);
+    if (!show || !show->getSeatInventory()) return {};
+    
+    const SeatInventory& inventory = *show->getSeatInventory();
+    std::vector<std::string> seatIds;
+    for (int index : SeatFinder::seatIndicesOf(inventory, SeatFinder::findBestBlock(inventory, count, preference))) {
+        seatIds.push_back(inventory.seatIdOf(index));
+    }
+    return seatIds;
+}
+
+Booking* MovieTicketBookingSystem::bookBestSeats(const std::string& userId, const std::string& showId, int count,
+                                                const SeatPreference& preference) {
+    // Another buyer can take the block between finding and reserving it; look again
+    for (int attempt = 0; attempt < 3; ++attempt) {
+        std::vector<std::string> seatIds = findBestSeats(showId, count, preference);
+        if (seatIds.empty()) return nullptr;
+        Booking* booking = createBooking(userId, showId, seatIds);
+        if (booking) return booking;
+    }
+    return nullptr;
 }
 
 bool MovieTicketBookingSystem::isSeatAvailable(const std::string& showId, const std::string& seatId) const {
-    auto it = showMap.find(showId);
-    Show* show = (it != showMap.end()) ? it->second : nullptr;
-    if (!show || !show->getScreen()) return false;
-    return show->getScreen()->isSeatAvailable(seatId);
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
+    Show* show = findShow(showId);
+    if (!show || !show->getSeatInventory()) return false;
+    return show->getSeatInventory()->isAvailable(show->getSeatInventory()->indexOf(seatId));
 }
 
 // Search and query methods
 std::vector<Show*> MovieTicketBookingSystem::searchShows(const std::string& movieTitle, const std::string& location,
                                                         const std::chrono::system_clock::time_point& date) const {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
     std::vector<Show*> result;
-    for (const auto& show : shows) {
-        bool matches = true;
-        
-        if (!movieTitle.empty() && show->getMovie()) {
-            if (show->getMovie()->getTitle().find(movieTitle) == std::string::npos) {
-                matches = false;
-            }
-        }
-        
-        if (!location.empty() && show->getScreen()) {
-            // Check if screen belongs to a theater in the specified location
-            bool foundLocation = false;
-            for (const auto& theater : theaters) {
-                if (theater->getLocation() == location && theater->hasScreen(show->getScreen()->getId())) {
-                    foundLocation = true;
-                    break;
-                }
-            }
-            if (!foundLocation) matches = false;
-        }
-        
-        if (date != std::chrono::system_clock::time_point{}) {
-            auto showDate = std::chrono::system_clock::to_time_t(show->getShowTime());
-            auto searchDate = std::chrono::system_clock::to_time_t(date);
-            auto showTm = *std::localtime(&showDate);
-            auto searchTm = *std::localtime(&searchDate);
-            
-            if (showTm.tm_year != searchTm.tm_year || 
-                showTm.tm_mon != searchTm.tm_mon || 
-                showTm.tm_mday != searchTm.tm_mday) {
-                matches = false;
-            }
-        }
-        
-        if (matches) {
-            result.push_back(show.get());
+    int dayKey = (date != std::chrono::system_clock::time_point{}) ? ShowIndex::dayKeyOf(date) : 0;
+    
+    // Title matching is a substring test, so it runs over movies; the rest is index lookups
+    for (const auto& movie : movies) {
+        if (!movieTitle.empty() && movie->getTitle().find(movieTitle) == std::string::npos) {
+            continue;
         }
+        std::vector<Show*> movieShows = showIndex.find(movie->getId(), location, dayKey);
+        result.insert(result.end(), movieShows.begin(), movieShows.end());
     }
     return result;
 }
 
 std::vector<Movie*> MovieTicketBookingSystem::searchMovies(const std::string& title, Genre genre) const {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
     std::vector<Movie*> result;
     for (const auto& movie : movies) {
         bool matches = true;
@@ -521,15 +753,11 @@ std::vector<Theater*> MovieTicketBookingSystem::searchTheaters(const std::string
 
 // Utility methods
 void MovieTicketBookingSystem::cleanupExpiredBookings() {
-    auto now = std::chrono::system_clock::now();
-    for (auto& booking : bookings) {
-        if (booking->isPending() && booking->isExpiredNow()) {
-            booking->expireBooking();
-        }
-    }
+    releaseExpiredHolds();
 }
 
 void MovieTicketBookingSystem::updateShowStatuses() {
+    std::lock_guard<std::shared_mutex> lock(catalogMutex);
     auto now = std::chrono::system_clock::now();
     for (auto& show : shows) {
         if (show->isUpcoming() && now >= show->getShowTime()) {
@@ -541,15 +769,14 @@ void MovieTicketBookingSystem::updateShowStatuses() {
 }
 
 std::string MovieTicketBookingSystem::generateId() const {
-    static int counter = 0;
     std::ostringstream oss;
-    oss << "ID" << std::hex << std::hash<std::string>{}(std::to_string(counter++));
+    oss << "ID" << std::hex << nextId.fetch_add(1, std::memory_order_relaxed);
     return oss.str();
 }
 
 double MovieTicketBookingSystem::calculateTotalAmount(const std::string& showId, const std::vector<std::string>& seatIds) const {
-    auto it = showMap.find(showId);
-    Show* show = (it != showMap.end()) ? it->second : nullptr;
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
+    Show* show = findShow(showId);
     if (!show) return 0.0;
     
     double total = 0.0;
@@ -560,6 +787,7 @@ double MovieTicketBookingSystem::calculateTotalAmount(const std::string& showId,
 }
 
 std::string MovieTicketBookingSystem::getSystemStatus() const {
+    std::shared_lock<std::shared_mutex> lock(catalogMutex);
     std::ostringstream oss;
     oss << "=== Movie Ticket Booking System Status ===\n";
     oss << "Movies: " << movies.size() << "\n";
@@ -568,7 +796,7 @@ std::string MovieTicketBookingSystem::getSystemStatus() const {
     oss << "Users: " << users.size() << "\n";
     oss << "Bookings: " << bookings.size() << "\n";
     oss << "Payments: " << payments.size() << "\n";
-    oss << "Active Movies: " << getActiveMovies().size() << "\n";
-    oss << "Upcoming Shows: " << getUpcomingShows().size() << "\n";
+    oss << "Active Movies: " << collectActiveMovies().size() << "\n";
+    oss << "Upcoming Shows: " << collectUpcomingShows().size() << "\n";
     return oss.str();
 }
\ No newline at end of file
@@ -18,7 +18,7 @@ void Screen::setIsActive(bool isActive) { this->isActive = isActive; }
 
 Seat* Screen::getSeat(const std::string& seatId) {
     auto it = seatMap.find(seatId);
-    return (it != seatMap.end()) ? it->second : nullptr;
+    return (it != seatMap.end()) ? &seats[it->second.first][it->second.second] : nullptr;
 }
 
 Seat* Screen::getSeat(int row, int column) {
@@ -30,71 +30,53 @@ Seat* Screen::getSeat(int row, int column) {
 
 std::vector<std::vector<Seat>> Screen::getAllSeats() const { return seats; }
 
-bool Screen::reserveSeat(const std::string& seatId, const std::string& bookingId) {
-    Seat* seat = getSeat(seatId);
-    if (seat && seat->isAvailable()) {
-        seat->reserve(bookingId);
-        return true;
-    }
-    return false;
-}
-
-bool Screen::reserveSeat(int row, int column, const std::string& bookingId) {
-    Seat* seat = getSeat(row, column);
-    if (seat && seat->isAvailable()) {
-        seat->reserve(bookingId);
-        return true;
-    }
-    return false;
-}
-
-bool Screen::occupySeat(const std::string& seatId) {
-    Seat* seat = getSeat(seatId);
-    if (seat && seat->isReserved()) {
-        seat->occupy();
-        return true;
-    }
-    return false;
-}
-
-bool Screen::occupySeat(int row, int column) {
-    Seat* seat = getSeat(row, column);
-    if (seat && seat->isReserved()) {
-        seat->occupy();
-        return true;
+std::shared_ptr<const SeatLayout> Screen::getLayout() const {
+    if (!layout) {
+        auto snapshot = std::make_shared<SeatLayout>();
+        snapshot->screenId = id;
+        snapshot->rows = totalRows;
+        snapshot->columns = totalColumns;
+        for (const auto& row : seats) {
+            for (const auto& seat : row) {
+                snapshot->types.push_back(seat.getType());
+                snapshot->surcharges.push_back(seat.getPrice());
+                snapshot->blocked.push_back(seat.getStatus() == SeatStatus::MAINTENANCE ? 1 : 0);
+            }
+        }
+        layout = snapshot;
     }
-    return false;
+    return layout;
 }
 
-bool Screen::releaseSeat(const std::string& seatId) {
+void Screen::setSeatMaintenance(const std::string& seatId) {
     Seat* seat = getSeat(seatId);
     if (seat) {
-        seat->release();
-        return true;
+        seat->setMaintenance();
+        layout.reset();
     }
-    return false;
 }
 
-bool Screen::releaseSeat(int row, int column) {
+void Screen::setSeatMaintenance(int row, int column) {
     Seat* seat = getSeat(row, column);
     if (seat) {
-        seat->release();
-        return true;
+        seat->setMaintenance();
+        layout.reset();
     }
-    return false;
 }
 
-void Screen::setSeatMaintenance(const std::string& seatId) {
+void Screen::clearSeatMaintenance(const std::string& seatId) {
     Seat* seat = getSeat(seatId);
     if (seat) {
-        seat->setMaintenance();
+        seat->release();
+        layout.reset();
     }
 }
 
-void Screen::setSeatMaintenance(int row, int column) {
+void Screen::clearSeatMaintenance(int row, int column) {
     Seat* seat = getSeat(row, column);
     if (seat) {
-        seat->setMaintenance();
+        seat->release();
+        layout.reset();
     }
 }
 
@@ -110,30 +92,6 @@ std::vector<Seat*> Screen::getAvailableSeats() const {
     return availableSeats;
 }
 
-std::vector<Seat*> Screen::getReservedSeats() const {
-    std::vector<Seat*> reservedSeats;
-    for (const auto& row : seats) {
-        for (const auto& seat : row) {
-            if (seat.isReserved()) {
-                reservedSeats.push_back(const_cast<Seat*>(&seat));
-            }
-        }
-    }
-    return reservedSeats;
-}
-
-std::vector<Seat*> Screen::getOccupiedSeats() const {
-    std::vector<Seat*> occupiedSeats;
-    for (const auto& row : seats) {
-        for (const auto& seat : row) {
-            if (seat.isOccupied()) {
-                occupiedSeats.push_back(const_cast<Seat*>(&seat));
-            }
-        }
-    }
-    return occupiedSeats;
-}
-
 int Screen::getAvailableSeatCount() const {
     int count = 0;
     for (const auto& row : seats) {
@@ -144,29 +102,9 @@ int Screen::getAvailableSeatCount() const {
     return count;
 }
 
-int Screen::getReservedSeatCount() const {
-    int count = 0;
-    for (const auto& row : seats) {
-        for (const auto& seat : row) {
-            if (seat.isReserved()) count++;
-        }
-    }
-    return count;
-}
-
-int Screen::getOccupiedSeatCount() const {
-    int count = 0;
-    for (const auto& row : seats) {
-        for (const auto& seat : row) {
-            if (seat.isOccupied()) count++;
-        }
-    }
-    return count;
-}
-
 bool Screen::isSeatAvailable(const std::string& seatId) const {
     auto it = seatMap.find(seatId);
-    return (it != seatMap.end()) ? it->second->isAvailable() : false;
+    return (it != seatMap.end()) ? seats[it->second.first][it->second.second].isAvailable() : false;
 }
 
 bool Screen::isSeatAvailable(int row, int column) const {
@@ -202,13 +140,16 @@ std::string Screen::getSeatLayoutString() const {
 }
 
 void Screen::initializeSeats() {
+    seats.clear();
+    seatMap.clear();
+    layout.reset();
     seats.resize(totalRows);
     for (int row = 0; row < totalRows; ++row) {
-        seats[row].resize(totalColumns);
+        seats[row].reserve(totalColumns);
         for (int col = 0; col < totalColumns; ++col) {
             std::string seatId = id + "_" + std::to_string(row) + "_" + std::to_string(col);
-            seats[row][col] = Seat(seatId, row, col);
-            seatMap[seatId] = &seats[row][col];
+            seats[row].emplace_back(seatId, row, col);
+            seatMap[seatId] = {row, col};
         }
     }
 }
@@ -217,6 +158,7 @@ void Screen::setSeatType(int row, int column, SeatType type) {
     Seat* seat = getSeat(row, column);
     if (seat) {
         seat->setType(type);
+        layout.reset();
     }
 }
 
@@ -224,5 +166,6 @@ void Screen::setSeatPrice(int row, int column, double price) {
     Seat* seat = getSeat(row, column);
     if (seat) {
         seat->setPrice(price);
+        layout.reset();
     }
 } 
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "../include/SeatFinder.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // out bit i = bit i + shift of v, across word boundaries
+    void shiftDown(const std::vector<std::uint64_t>& v, int shift, std::vector<std::uint64_t>& out) {
+        size_t words = v.size();
+        size_t wordShift = shift / 64;
+        int bitShift = shift % 64;
+        for (size_t i = 0; i < words; ++i) {
+            std::uint64_t low = i + wordShift < words ? v[i + wordShift] >> bitShift : 0;
+            std::uint64_t high = bitShift && i + wordShift + 1 < words ? v[i + wordShift + 1] << (64 - bitShift) : 0;
+            out[i] = low | high;
+        }
+    }
+
+    // First set bit at or after `from`, or -1
+    int nextSetBit(const std::vector<std::uint64_t>& v, int from) {
+        if (from < 0) from = 0;
+        for (size_t w = from / 64; w < v.size(); ++w) {
+            std::uint64_t word = v[w];
+            if (w == static_cast<size_t>(from / 64)) {
+                word &= ~std::uint64_t(0) << (from % 64);
+            }
+            if (word) {
+                return static_cast<int>(w * 64) + __builtin_ctzll(word);
+            }
+        }
+        return -1;
+    }
+
+    // Last set bit strictly before `before`, or -1
+    int prevSetBit(const std::vector<std::uint64_t>& v, int before) {
+        if (before <= 0) return -1;
+        int last = std::min(before - 1, static_cast<int>(v.size() * 64) - 1);
+        for (int w = last / 64; w >= 0; --w) {
+            std::uint64_t word = v[w];
+            if (w == last / 64 && last % 64 != 63) {
+                word &= (std::uint64_t(1) << (last % 64 + 1)) - 1;
+            }
+            if (word) {
+                return w * 64 + 63 - __builtin_clzll(word);
+            }
+        }
+        return -1;
+    }
+
+    double rowPenalty(const SeatInventory& inventory, int row, const SeatPreference& preference) {
+        int rows = inventory.getRows();
+        double idealRow = std::max(0.0, std::min(1.0, preference.idealRowFraction)) * (rows - 1);
+        return std::fabs(row - idealRow) / std::max(1, rows - 1);
+    }
+
+    double columnPenalty(const SeatInventory& inventory, int firstColumn, int count) {
+        double centre = inventory.getColumns() / 2.0;
+        double total = 0.0;
+        for (int c = firstColumn; c < firstColumn + count; ++c) {
+            total += std::fabs(c + 0.5 - centre);
+        }
+        return total / count / centre;
+    }
+}
+
+double SeatFinder::scoreBlock(const SeatInventory& inventory, int row, int firstColumn, int count,
+                              const SeatPreference& preference) {
+    return -(preference.rowWeight * rowPenalty(inventory, row, preference) +
+             preference.columnWeight * columnPenalty(inventory, firstColumn, count));
+}
+
+SeatBlock SeatFinder::findBestBlock(const SeatInventory& inventory, int count, const SeatPreference& preference) {
+    SeatBlock best;
+    int rows = inventory.getRows();
+    int columns = inventory.getColumns();
+    if (count <= 0 || count > columns || rows <= 0) {
+        return best;
+    }
+
+    // Rows from the ideal one outward, so the row penalty only grows
+    std::vector<std::pair<double, int>> order(rows);
+    for (int row = 0; row < rows; ++row) {
+        order[row] = {preference.rowWeight * rowPenalty(inventory, row, preference), row};
+    }
+    std::sort(order.begin(), order.end());
+
+    int wordsPerRow = inventory.getWordsPerRow();
+    std::vector<std::uint64_t> runs(wordsPerRow), shifted(wordsPerRow);
+    int idealStart = (columns - count) / 2;
+    double bestPenalty = 0.0;
+
+    for (const auto& entry : order) {
+        double penalty = entry.first;
+        int row = entry.second;
+        if (best.found() && penalty >= bestPenalty) {
+            break;
+        }
+
+        for (int w = 0; w < wordsPerRow; ++w) {
+            runs[w] = ~inventory.getTakenWord(row, w);
+        }
+        if (!preference.anyType) {
+            for (int c = 0; c < columns; ++c) {
+                if (inventory.getType(inventory.indexOf(row, c)) != preference.type) {
+                    runs[c / 64] &= ~(std::uint64_t(1) << (c % 64));
+                }
+            }
+        }
+
+        // After this, bit c is set iff seats c..c+length-1 are free
+        for (int length = 1; length < count;) {
+            int shift = std::min(length, count - length);
+            shiftDown(runs, shift, shifted);
+            for (int w = 0; w < wordsPerRow; ++w) {
+                runs[w] &= shifted[w];
+            }
+            length += shift;
+        }
+
+        int candidates[2] = {nextSetBit(runs, idealStart), prevSetBit(runs, idealStart)};
+        for (int start : candidates) {
+            if (start < 0) continue;
+            double total = penalty + preference.columnWeight * columnPenalty(inventory, start, count);
+            if (!best.found() || total < bestPenalty) {
+                bestPenalty = total;
+                best.row = row;
+                best.firstColumn = start;
+                best.count = count;
+                best.score = -total;
+            }
+        }
+    }
+    return best;
+}
+
+std::vector<int> SeatFinder::seatIndicesOf(const SeatInventory& inventory, const SeatBlock& block) {
+    std::vector<int> seatIndices;
+    if (!block.found()) {
+        return seatIndices;
+    }
+    for (int c = block.firstColumn; c < block.firstColumn + block.count; ++c) {
+        seatIndices.push_back(inventory.indexOf(block.row, c));
+    }
+    return seatIndices;
+}
@@ -0,0 +1,157 @@
+#include "../include/SeatFinderBenchmark.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+
+const double SeatFinderBenchmark::SCORE_TOLERANCE = 1e-9;
+
+namespace {
+    double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Premium seats in the back fifth of the rows, as in most auditoriums
+    std::shared_ptr<const SeatLayout> makeLayout(const SeatFinderScenario& scenario) {
+        auto layout = std::make_shared<SeatLayout>();
+        layout->screenId = "BENCH";
+        layout->rows = scenario.rows;
+        layout->columns = scenario.columns;
+        for (int row = 0; row < scenario.rows; ++row) {
+            SeatType type = row >= scenario.rows * 4 / 5 ? SeatType::PREMIUM : SeatType::REGULAR;
+            layout->types.insert(layout->types.end(), scenario.columns, type);
+        }
+        layout->surcharges.assign(layout->types.size(), 0.0);
+        layout->blocked.assign(layout->types.size(), 0);
+        return layout;
+    }
+
+    SeatPreference randomPreference(std::mt19937& rng) {
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        SeatPreference preference;
+        preference.anyType = unit(rng) < 0.75;
+        preference.type = SeatType::PREMIUM;
+        preference.idealRowFraction = unit(rng);
+        return preference;
+    }
+}
+
+SeatFinderBenchmark::SeatFinderBenchmark(const SeatFinderBenchmarkConfig& config) : config(config) {
+    this->config.inventories = std::max<size_t>(1, config.inventories);
+    this->config.searchesPerInventory = std::max<size_t>(1, config.searchesPerInventory);
+    this->config.minSeats = std::max(1, config.minSeats);
+    this->config.maxSeats = std::max(this->config.minSeats, config.maxSeats);
+    this->config.checkedSearches = std::min(config.checkedSearches, this->config.searchesPerInventory);
+}
+
+SeatBlock SeatFinderBenchmark::scanBestBlock(const SeatInventory& inventory, int count,
+                                             const SeatPreference& preference) {
+    SeatBlock best;
+    for (int row = 0; row < inventory.getRows(); ++row) {
+        for (int column = 0; column + count <= inventory.getColumns(); ++column) {
+            bool free = true;
+            for (int k = 0; free && k < count; ++k) {
+                int index = inventory.indexOf(row, column + k);
+                free = inventory.isAvailable(index) &&
+                       (preference.anyType || inventory.getType(index) == preference.type);
+            }
+            if (!free) continue;
+            double score = SeatFinder::scoreBlock(inventory, row, column, count, preference);
+            if (!best.found() || score > best.score) {
+                best = {row, column, count, score};
+            }
+        }
+    }
+    return best;
+}
+
+SeatFinderBenchmarkReport SeatFinderBenchmark::run() const {
+    auto wallStart = std::chrono::steady_clock::now();
+    SeatFinderBenchmarkReport report;
+    std::mt19937 rng(config.seed);
+    std::uniform_int_distribution<int> seatCount(config.minSeats, config.maxSeats);
+
+    for (const auto& scenario : config.scenarios) {
+        SeatFinderBenchmarkRow row;
+        row.scenario = scenario;
+        auto layout = makeLayout(scenario);
+        size_t found = 0;
+        double searchSeconds = 0.0, scanSeconds = 0.0;
+
+        for (size_t n = 0; n < config.inventories; ++n) {
+            SeatInventory inventory(layout);
+            std::vector<int> seats(inventory.getTotalSeats());
+            std::iota(seats.begin(), seats.end(), 0);
+            std::shuffle(seats.begin(), seats.end(), rng);
+            seats.resize(static_cast<size_t>(scenario.soldShare * seats.size()));
+            for (int seat : seats) {
+                inventory.reserve({seat});
+            }
+
+            std::vector<int> counts(config.searchesPerInventory);
+            std::vector<SeatPreference> preferences(config.searchesPerInventory);
+            for (size_t i = 0; i < config.searchesPerInventory; ++i) {
+                counts[i] = seatCount(rng);
+                if (config.randomPreferences) preferences[i] = randomPreference(rng);
+            }
+
+            std::vector<SeatBlock> blocks(config.searchesPerInventory);
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < config.searchesPerInventory; ++i) {
+                blocks[i] = SeatFinder::findBestBlock(inventory, counts[i], preferences[i]);
+            }
+            searchSeconds += elapsedSeconds(start);
+
+            std::vector<SeatBlock> scanned(config.checkedSearches);
+            start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < config.checkedSearches; ++i) {
+                scanned[i] = scanBestBlock(inventory, counts[i], preferences[i]);
+            }
+            scanSeconds += elapsedSeconds(start);
+
+            for (size_t i = 0; i < config.searchesPerInventory; ++i) {
+                if (blocks[i].found()) found++;
+            }
+            for (size_t i = 0; i < config.checkedSearches; ++i) {
+                if (blocks[i].found() != scanned[i].found() ||
+                    std::abs(blocks[i].score - scanned[i].score) > SCORE_TOLERANCE) {
+                    row.mismatches++;
+                }
+            }
+        }
+
+        double searches = static_cast<double>(config.inventories * config.searchesPerInventory);
+        row.searchMicros = searchSeconds * 1e6 / searches;
+        if (config.checkedSearches > 0) {
+            row.scanMicros = scanSeconds * 1e6 / (config.inventories * config.checkedSearches);
+        }
+        row.foundShare = found / searches;
+        report.rows.push_back(row);
+    }
+
+    report.consistent = std::all_of(report.rows.begin(), report.rows.end(),
+                                    [](const SeatFinderBenchmarkRow& row) { return row.mismatches == 0; });
+    report.wallSeconds = elapsedSeconds(wallStart);
+    return report;
+}
+
+void SeatFinderBenchmark::printReport(const std::string& label, const SeatFinderBenchmarkReport& report) {
+    std::cout << "=== " << label << " ===" << std::endl;
+    std::cout << std::right << std::setw(8) << "Seats" << std::setw(8) << "Sold" << std::setw(14) << "Search(us)"
+              << std::setw(12) << "Scan(us)" << std::setw(8) << "Found" << std::setw(12) << "Mismatches"
+              << std::endl;
+    std::cout << std::fixed;
+    for (const auto& row : report.rows) {
+        std::cout << std::setw(8) << row.scenario.rows * row.scenario.columns
+                  << std::setprecision(0) << std::setw(7) << row.scenario.soldShare * 100.0 << "%"
+                  << std::setprecision(2) << std::setw(14) << row.searchMicros << std::setw(12) << row.scanMicros
+                  << std::setprecision(0) << std::setw(7) << row.foundShare * 100.0 << "%"
+                  << std::setw(12) << row.mismatches << std::endl;
+    }
+    std::cout << std::setprecision(2) << "Consistent: " << (report.consistent ? "yes" : "NO") << std::endl;
+    std::cout << "Wall time: " << report.wallSeconds << " s" << std::endl;
+}
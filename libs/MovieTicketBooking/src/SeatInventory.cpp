@@ -0,0 +1,266 @@
+#include "../include/SeatInventory.hpp"
+#include <algorithm>
+#include <bitset>
+
+namespace {
+    int wordsPerRowOf(const SeatLayout& layout) {
+        return std::max(1, (layout.columns + 63) / 64);
+    }
+
+    size_t wordCountOf(const SeatLayout& layout) {
+        return static_cast<size_t>(layout.rows) * wordsPerRowOf(layout);
+    }
+
+    // Parses the digits at `pos` and advances past them. No empty numbers or leading
+    // zeros, so every seat has a single ID, as seatIdOf writes it.
+    bool parseNumber(const std::string& text, size_t& pos, int& value) {
+        size_t start = pos;
+        value = 0;
+        while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9' && pos - start < 9) {
+            value = value * 10 + (text[pos] - '0');
+            pos++;
+        }
+        return pos > start && (text[start] != '0' || pos - start == 1);
+    }
+}
+
+SeatInventory::SeatInventory(std::shared_ptr<const SeatLayout> layout)
+    : layout(std::move(layout)), wordsPerRow(wordsPerRowOf(*this->layout)),
+      taken(wordCountOf(*this->layout)), sold(wordCountOf(*this->layout)), blocked(wordCountOf(*this->layout)) {
+    const SeatLayout& seats = *this->layout;
+    for (int row = 0; row < seats.rows; ++row) {
+        for (int word = 0; word < wordsPerRow; ++word) {
+            // Columns past the end of the row are permanently taken
+            int firstColumn = word * 64;
+            int width = std::max(0, std::min(64, seats.columns - firstColumn));
+            std::uint64_t padding = width >= 64 ? 0 : ~((std::uint64_t(1) << width) - 1);
+            size_t index = static_cast<size_t>(row) * wordsPerRow + word;
+            taken[index].store(padding, std::memory_order_relaxed);
+            sold[index].store(0, std::memory_order_relaxed);
+            blocked[index].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    for (int seat = 0; seat < getTotalSeats(); ++seat) {
+        if (seat < static_cast<int>(seats.blocked.size()) && seats.blocked[seat]) {
+            taken[wordOf(seat)].fetch_or(bitOf(seat), std::memory_order_relaxed);
+            blocked[wordOf(seat)].fetch_or(bitOf(seat), std::memory_order_relaxed);
+        }
+    }
+}
+
+const SeatLayout& SeatInventory::getLayout() const { return *layout; }
+int SeatInventory::getRows() const { return layout->rows; }
+int SeatInventory::getColumns() const { return layout->columns; }
+int SeatInventory::getTotalSeats() const { return layout->rows * layout->columns; }
+int SeatInventory::getWordsPerRow() const { return wordsPerRow; }
+
+size_t SeatInventory::wordOf(int seatIndex) const {
+    int row = seatIndex / layout->columns;
+    int column = seatIndex % layout->columns;
+    return static_cast<size_t>(row) * wordsPerRow + column / 64;
+}
+
+std::uint64_t SeatInventory::bitOf(int seatIndex) const {
+    return std::uint64_t(1) << (seatIndex % layout->columns % 64);
+}
+
+int SeatInventory::indexOf(int row, int column) const {
+    if (row < 0 || row >= layout->rows || column < 0 || column >= layout->columns) {
+        return -1;
+    }
+    return row * layout->columns + column;
+}
+
+int SeatInventory::indexOf(const std::string& seatId) const {
+    const std::string& prefix = layout->screenId;
+    if (seatId.size() <= prefix.size() + 1 || seatId.compare(0, prefix.size(), prefix) != 0 ||
+        seatId[prefix.size()] != '_') {
+        return -1;
+    }
+
+    size_t pos = prefix.size() + 1;
+    int row, column;
+    if (!parseNumber(seatId, pos, row) || pos >= seatId.size() || seatId[pos++] != '_' ||
+        !parseNumber(seatId, pos, column) || pos != seatId.size()) {
+        return -1;
+    }
+    return indexOf(row, column);
+}
+
+std::string SeatInventory::seatIdOf(int seatIndex) const {
+    if (seatIndex < 0 || seatIndex >= getTotalSeats()) {
+        return "";
+    }
+    return layout->screenId + "_" + std::to_string(seatIndex / layout->columns) + "_" +
+           std::to_string(seatIndex % layout->columns);
+}
+
+SeatType SeatInventory::getType(int seatIndex) const {
+    if (seatIndex < 0 || seatIndex >= static_cast<int>(layout->types.size())) {
+        return SeatType::REGULAR;
+    }
+    return layout->types[seatIndex];
+}
+
+double SeatInventory::getSurcharge(int seatIndex) const {
+    if (seatIndex < 0 || seatIndex >= static_cast<int>(layout->surcharges.size())) {
+        return 0.0;
+    }
+    return layout->surcharges[seatIndex];
+}
+
+bool SeatInventory::buildMasks(const std::vector<int>& seatIndices,
+                               std::vector<std::pair<size_t, std::uint64_t>>& masks) const {
+    masks.clear();
+    masks.reserve(seatIndices.size());
+    for (int seat : seatIndices) {
+        if (seat < 0 || seat >= getTotalSeats()) {
+            return false;
+        }
+        masks.push_back({wordOf(seat), bitOf(seat)});
+    }
+    std::sort(masks.begin(), masks.end());
+
+    // Merge seats sharing a word; a seat listed twice makes the request invalid
+    size_t merged = 0;
+    for (size_t i = 0; i < masks.size(); ++i) {
+        if (merged > 0 && masks[merged - 1].first == masks[i].first) {
+            if (masks[merged - 1].second & masks[i].second) {
+                return false;
+            }
+            masks[merged - 1].second |= masks[i].second;
+        } else {
+            masks[merged++] = masks[i];
+        }
+    }
+    masks.resize(merged);
+    return !masks.empty();
+}
+
+bool SeatInventory::reserve(const std::vector<int>& seatIndices) {
+    std::vector<std::pair<size_t, std::uint64_t>> masks;
+    if (!buildMasks(seatIndices, masks)) {
+        return false;
+    }
+
+    for (size_t i = 0; i < masks.size(); ++i) {
+        std::atomic<std::uint64_t>& word = taken[masks[i].first];
+        std::uint64_t mask = masks[i].second;
+        std::uint64_t current = word.load(std::memory_order_relaxed);
+        do {
+            if (current & mask) {
+                // Give back the words claimed so far
+                for (size_t j = 0; j < i; ++j) {
+                    taken[masks[j].first].fetch_and(~masks[j].second, std::memory_order_release);
+                }
+                return false;
+            }
+        } while (!word.compare_exchange_weak(current, current | mask, std::memory_order_acq_rel,
+                                             std::memory_order_relaxed));
+    }
+    return true;
+}
+
+bool SeatInventory::occupy(const std::vector<int>& seatIndices) {
+    std::vector<std::pair<size_t, std::uint64_t>> masks;
+    if (!buildMasks(seatIndices, masks)) {
+        return false;
+    }
+
+    // The caller holds the reservation, so only it can move these seats on
+    for (const auto& mask : masks) {
+        if ((taken[mask.first].load(std::memory_order_acquire) & mask.second) != mask.second ||
+            (sold[mask.first].load(std::memory_order_acquire) & mask.second) ||
+            (blocked[mask.first].load(std::memory_order_acquire) & mask.second)) {
+            return false;
+        }
+    }
+    for (const auto& mask : masks) {
+        sold[mask.first].fetch_or(mask.second, std::memory_order_release);
+    }
+    return true;
+}
+
+bool SeatInventory::release(const std::vector<int>& seatIndices) {
+    std::vector<std::pair<size_t, std::uint64_t>> masks;
+    if (!buildMasks(seatIndices, masks)) {
+        return false;
+    }
+
+    for (const auto& mask : masks) {
+        if ((taken[mask.first].load(std::memory_order_acquire) & mask.second) != mask.second ||
+            (blocked[mask.first].load(std::memory_order_acquire) & mask.second)) {
+            return false;
+        }
+    }
+    for (const auto& mask : masks) {
+        sold[mask.first].fetch_and(~mask.second, std::memory_order_release);
+        taken[mask.first].fetch_and(~mask.second, std::memory_order_release);
+    }
+    return true;
+}
+
+bool SeatInventory::setMaintenance(int seatIndex) {
+    if (!reserve({seatIndex})) {
+        return false;
+    }
+    blocked[wordOf(seatIndex)].fetch_or(bitOf(seatIndex), std::memory_order_release);
+    return true;
+}
+
+bool SeatInventory::clearMaintenance(int seatIndex) {
+    if (seatIndex < 0 || seatIndex >= getTotalSeats()) {
+        return false;
+    }
+    std::uint64_t bit = bitOf(seatIndex);
+    if (!(blocked[wordOf(seatIndex)].fetch_and(~bit, std::memory_order_acq_rel) & bit)) {
+        return false;
+    }
+    taken[wordOf(seatIndex)].fetch_and(~bit, std::memory_order_release);
+    return true;
+}
+
+SeatStatus SeatInventory::getStatus(int seatIndex) const {
+    if (seatIndex < 0 || seatIndex >= getTotalSeats()) {
+        return SeatStatus::MAINTENANCE;
+    }
+    size_t word = wordOf(seatIndex);
+    std::uint64_t bit = bitOf(seatIndex);
+    if (blocked[word].load(std::memory_order_acquire) & bit) return SeatStatus::MAINTENANCE;
+    if (sold[word].load(std::memory_order_acquire) & bit) return SeatStatus::OCCUPIED;
+    if (taken[word].load(std::memory_order_acquire) & bit) return SeatStatus::RESERVED;
+    return SeatStatus::AVAILABLE;
+}
+
+bool SeatInventory::isAvailable(int seatIndex) const {
+    if (seatIndex < 0 || seatIndex >= getTotalSeats()) {
+        return false;
+    }
+    return !(taken[wordOf(seatIndex)].load(std::memory_order_acquire) & bitOf(seatIndex));
+}
+
+int SeatInventory::getAvailableCount() const {
+    size_t count = 0;
+    for (const auto& word : taken) {
+        count += std::bitset<64>(~word.load(std::memory_order_acquire)).count();
+    }
+    return static_cast<int>(count);
+}
+
+std::vector<int> SeatInventory::getSeatsWithStatus(SeatStatus status) const {
+    std::vector<int> result;
+    for (int seat = 0; seat < getTotalSeats(); ++seat) {
+        if (getStatus(seat) == status) {
+            result.push_back(seat);
+        }
+    }
+    return result;
+}
+
+std::uint64_t SeatInventory::getTakenWord(int row, int wordInRow) const {
+    if (row < 0 || row >= layout->rows || wordInRow < 0 || wordInRow >= wordsPerRow) {
+        return ~std::uint64_t(0);
+    }
+    return taken[static_cast<size_t>(row) * wordsPerRow + wordInRow].load(std::memory_order_acquire);
+}
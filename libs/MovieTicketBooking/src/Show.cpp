@@ -8,6 +8,9 @@ Show::Show(const std::string& id, Movie* movie, Screen* screen,
     : id(id), movie(movie), screen(screen), showTime(showTime), basePrice(basePrice), 
       status(ShowStatus::SCHEDULED) {
     calculateEndTime();
+    if (screen) {
+        seatInventory = std::make_unique<SeatInventory>(screen->getLayout());
+    }
 }
 
 std::string Show::getId() const { return id; }
@@ -18,6 +21,11 @@ std::chrono::system_clock::time_point Show::getEndTime() const { return endTime;
 ShowStatus Show::getStatus() const { return status; }
 double Show::getBasePrice() const { return basePrice; }
 std::vector<std::string> Show::getBookingIds() const { return bookingIds; }
+SeatInventory* Show::getSeatInventory() const { return seatInventory.get(); }
+
+std::string Show::getScreenId() const {
+    return seatInventory ? seatInventory->getLayout().screenId : std::string();
+}
 
 void Show::setShowTime(const std::chrono::system_clock::time_point& showTime) { 
     this->showTime = showTime; 
@@ -25,6 +33,7 @@ void Show::setShowTime(const std::chrono::system_clock::time_point& showTime) {
 }
 void Show::setStatus(ShowStatus status) { this->status = status; }
 void Show::setBasePrice(double basePrice) { this->basePrice = basePrice; }
+void Show::setScreen(Screen* screen) { this->screen = screen; }
 
 void Show::addBooking(const std::string& bookingId) {
     if (std::find(bookingIds.begin(), bookingIds.end(), bookingId) == bookingIds.end()) {
@@ -86,21 +95,49 @@ bool Show::isCompleted() const { return status == ShowStatus::COMPLETED; }
 bool Show::isCancelled() const { return status == ShowStatus::CANCELLED; }
 
 double Show::getSeatPrice(const std::string& seatId) const {
-    if (!screen) return basePrice;
-    Seat* seat = screen->getSeat(seatId);
-    if (seat) {
-        return basePrice + seat->getPrice();
-    }
-    return basePrice;
+    if (!seatInventory) return basePrice;
+    return getSeatPriceByIndex(seatInventory->indexOf(seatId));
 }
 
 double Show::getSeatPrice(int row, int column) const {
-    if (!screen) return basePrice;
-    Seat* seat = screen->getSeat(row, column);
-    if (seat) {
-        return basePrice + seat->getPrice();
+    if (!seatInventory) return basePrice;
+    return getSeatPriceByIndex(seatInventory->indexOf(row, column));
+}
+
+double Show::getSeatPriceByIndex(int seatIndex) const {
+    if (!seatInventory) return basePrice;
+    return basePrice + seatInventory->getSurcharge(seatIndex);
+}
+
+int Show::getAvailableSeatCount() const {
+    return seatInventory ? seatInventory->getAvailableCount() : 0;
+}
+
+std::string Show::getSeatLayoutString() const {
+    if (!seatInventory) return "";
+    int rows = seatInventory->getRows();
+    int columns = seatInventory->getColumns();
+    std::ostringstream oss;
+    oss << "Show: " << id << " (" << rows << "x" << columns << ")\n";
+    oss << "   ";
+    for (int col = 0; col < columns; ++col) {
+        oss << " " << (col + 1) << " ";
+    }
+    oss << "\n";
+
+    for (int row = 0; row < rows; ++row) {
+        oss << static_cast<char>('A' + row) << " ";
+        for (int col = 0; col < columns; ++col) {
+            switch (seatInventory->getStatus(seatInventory->indexOf(row, col))) {
+                case SeatStatus::AVAILABLE: oss << " [ ]"; break;
+                case SeatStatus::RESERVED: oss << " [R]"; break;
+                case SeatStatus::OCCUPIED: oss << " [X]"; break;
+                case SeatStatus::MAINTENANCE: oss << " [M]"; break;
+            }
+        }
+        oss << "\n";
     }
-    return basePrice;
+    return oss.str();
 }
 
 void Show::calculateEndTime() {
@@ -126,6 +163,7 @@ std::string Show::getShowInfo() const {
     oss << "End Time: " << getEndTimeString() << "\n";
     oss << "Status: " << getStatusString() << "\n";
     oss << "Base Price: $" << std::fixed << std::setprecision(2) << basePrice << "\n";
-    oss << "Bookings: " << getBookingCount();
+    oss << "Bookings: " << getBookingCount() << "\n";
+    oss << "Available Seats: " << getAvailableSeatCount();
     return oss.str();
 } 
\ No newline at end of file
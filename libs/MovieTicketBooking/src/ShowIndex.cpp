@@ -0,0 +1,159 @@
+#include "../include/ShowIndex.hpp"
+#include <algorithm>
+#include <ctime>
+
+namespace {
+    bool earlier(const ShowIndex::Entry& a, const ShowIndex::Entry& b) {
+        return a.startTime < b.startTime;
+    }
+}
+
+int ShowIndex::dayKeyOf(const std::chrono::system_clock::time_point& time) {
+    std::time_t seconds = std::chrono::system_clock::to_time_t(time);
+    std::tm local{};
+    localtime_r(&seconds, &local);
+    return (local.tm_year + 1900) * 10000 + (local.tm_mon + 1) * 100 + local.tm_mday;
+}
+
+void ShowIndex::addScreen(const std::string& screenId, Theater* theater) {
+    if (theater) {
+        screenTheaters[screenId] = theater;
+    }
+}
+
+void ShowIndex::removeScreen(const std::string& screenId) {
+    screenTheaters.erase(screenId);
+    removeShowsOn({screenId});
+}
+
+void ShowIndex::removeTheater(const Theater* theater) {
+    std::vector<std::string> screenIds;
+    for (auto it = screenTheaters.begin(); it != screenTheaters.end();) {
+        if (it->second == theater) {
+            screenIds.push_back(it->first);
+            it = screenTheaters.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    removeShowsOn(screenIds);
+}
+
+void ShowIndex::removeShowsOn(const std::vector<std::string>& screenIds) {
+    if (screenIds.empty()) return;
+
+    // Screens and theaters are removed rarely, so one pass over the shows is enough
+    std::vector<const Show*> stale;
+    for (const auto& position : positions) {
+        if (std::find(screenIds.begin(), screenIds.end(), position.second.screenId) != screenIds.end()) {
+            stale.push_back(position.first);
+        }
+    }
+    for (const Show* show : stale) {
+        remove(show);
+    }
+}
+
+Theater* ShowIndex::getTheater(const std::string& screenId) const {
+    auto it = screenTheaters.find(screenId);
+    return (it != screenTheaters.end()) ? it->second : nullptr;
+}
+
+bool ShowIndex::add(Show* show) {
+    if (!show || !show->getMovie()) return false;
+    Theater* theater = getTheater(show->getScreenId());
+    if (!theater) return false;
+
+    remove(show);
+    Position position{show->getMovie()->getId(), theater->getLocation(), dayKeyOf(show->getShowTime()),
+                      show->getScreenId()};
+    std::vector<Entry>& entries = byMovie[position.movieId][position.city][position.dayKey];
+    Entry entry{show->getShowTime(), show};
+    entries.insert(std::upper_bound(entries.begin(), entries.end(), entry, earlier), entry);
+    positions[show] = position;
+    return true;
+}
+
+bool ShowIndex::remove(const Show* show) {
+    auto it = positions.find(show);
+    if (it == positions.end()) return false;
+    const Position& position = it->second;
+
+    auto movie = byMovie.find(position.movieId);
+    auto city = movie->second.find(position.city);
+    auto day = city->second.find(position.dayKey);
+    std::vector<Entry>& entries = day->second;
+    entries.erase(std::find_if(entries.begin(), entries.end(),
+                               [show](const Entry& entry) { return entry.show == show; }));
+
+    // Drop buckets that became empty so searches never walk them
+    if (entries.empty()) {
+        city->second.erase(day);
+        if (city->second.empty()) {
+            movie->second.erase(city);
+            if (movie->second.empty()) {
+                byMovie.erase(movie);
+            }
+        }
+    }
+    positions.erase(it);
+    return true;
+}
+
+bool ShowIndex::contains(const Show* show) const {
+    return positions.count(show) > 0;
+}
+
+size_t ShowIndex::size() const { return positions.size(); }
+
+const std::vector<ShowIndex::Entry>* ShowIndex::bucket(const std::string& movieId, const std::string& city,
+                                                         int dayKey) const {
+    auto movie = byMovie.find(movieId);
+    if (movie == byMovie.end()) return nullptr;
+    auto cityIt = movie->second.find(city);
+    if (cityIt == movie->second.end()) return nullptr;
+    auto day = cityIt->second.find(dayKey);
+    return (day != cityIt->second.end()) ? &day->second : nullptr;
+}
+
+void ShowIndex::appendDays(const DayBuckets& days, int dayKey, std::vector<Show*>& result) {
+    if (dayKey != 0) {
+        auto day = days.find(dayKey);
+        if (day != days.end()) {
+            for (const auto& entry : day->second) {
+                result.push_back(entry.show);
+            }
+        }
+        return;
+    }
+    for (const auto& day : days) {
+        for (const auto& entry : day.second) {
+            result.push_back(entry.show);
+        }
+    }
+}
+
+std::vector<Show*> ShowIndex::find(const std::string& movieId, const std::string& city, int dayKey) const {
+    std::vector<Show*> result;
+    auto movie = byMovie.find(movieId);
+    if (movie == byMovie.end()) return result;
+
+    if (!city.empty()) {
+        auto cityIt = movie->second.find(city);
+        if (cityIt != movie->second.end()) {
+            appendDays(cityIt->second, dayKey, result);
+        }
+        return result;
+    }
+
+    // Several cities: interleave them by start time
+    for (const auto& cityIt : movie->second) {
+        appendDays(cityIt.second, dayKey, result);
+    }
+    if (movie->second.size() > 1) {
+        std::stable_sort(result.begin(), result.end(), [](const Show* a, const Show* b) {
+            return a->getShowTime() < b->getShowTime();
+        });
+    }
+    return result;
+}
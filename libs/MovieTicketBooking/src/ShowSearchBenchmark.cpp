@@ -0,0 +1,159 @@
+#include "../include/ShowSearchBenchmark.hpp"
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+namespace {
+    double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Trailing colon so that "Movie 1:" is not a substring of "Movie 12:"
+    std::string movieTitle(size_t movie) {
+        return "Movie " + std::to_string(movie + 1) + ":";
+    }
+
+    std::string cityName(size_t city) {
+        return "City " + std::to_string(city + 1);
+    }
+}
+
+ShowSearchBenchmark::ShowSearchBenchmark(const ShowSearchConfig& config) : config(config) {
+    this->config.movieCount = std::max<size_t>(1, config.movieCount);
+    this->config.cityCount = std::max<size_t>(1, config.cityCount);
+    this->config.theatersPerCity = std::max<size_t>(1, config.theatersPerCity);
+    this->config.screensPerTheater = std::max<size_t>(1, config.screensPerTheater);
+    this->config.days = std::max(1, config.days);
+    this->config.rows = std::max(1, config.rows);
+    this->config.columns = std::max(1, config.columns);
+    this->config.queries = std::max<size_t>(1, config.queries);
+    this->config.scanQueries = std::max<size_t>(1, std::min(config.scanQueries, this->config.queries));
+}
+
+void ShowSearchBenchmark::setUp() {
+    std::mt19937 rng(config.seed);
+    std::vector<std::string> movieIds;
+    for (size_t i = 0; i < config.movieCount; ++i) {
+        movieIds.push_back(system.addMovie(movieTitle(i), "Search benchmark", Genre::DRAMA, 120, Rating::PG13,
+                                           "Director", {"Lead"}, "English")->getId());
+    }
+
+    // (theater, screen) pairs, theaters grouped by city
+    std::vector<std::pair<std::string, std::string>> screens;
+    for (size_t city = 0; city < config.cityCount; ++city) {
+        for (size_t t = 0; t < config.theatersPerCity; ++t) {
+            Theater* theater = system.addTheater("Theater " + std::to_string(t + 1), cityName(city),
+                                                 std::to_string(t + 1) + " Main Street", "555-0100");
+            for (size_t s = 0; s < config.screensPerTheater; ++s) {
+                Screen* screen = system.addScreenToTheater(theater->getId(), "Screen " + std::to_string(s + 1),
+                                                           config.rows, config.columns);
+                screens.emplace_back(theater->getId(), screen->getId());
+            }
+        }
+    }
+
+    auto firstDay = std::chrono::system_clock::now() + std::chrono::hours(1);
+    std::uniform_int_distribution<long long> offset(0, static_cast<long long>(config.days) * 24 * 3600 - 1);
+    for (size_t i = 0; i < config.showCount; ++i) {
+        const auto& screen = screens[rng() % screens.size()];
+        system.addShow(movieIds[rng() % movieIds.size()], screen.first, screen.second,
+                       firstDay + std::chrono::seconds(offset(rng)), 12.0);
+    }
+
+    for (size_t i = 0; i < config.queries; ++i) {
+        queries.push_back({movieTitle(rng() % config.movieCount), cityName(rng() % config.cityCount),
+                           firstDay + std::chrono::hours(24 * static_cast<int>(rng() % config.days))});
+    }
+}
+
+std::vector<Show*> ShowSearchBenchmark::scan(const Query& query) const {
+    // The search as it was before the index
+    std::vector<Theater*> theaters = system.getAllTheaters();
+    std::vector<Show*> result;
+    for (Show* show : system.getAllShows()) {
+        bool matches = true;
+
+        if (show->getMovie() && show->getMovie()->getTitle().find(query.title) == std::string::npos) {
+            matches = false;
+        }
+
+        if (show->getScreen()) {
+            bool foundLocation = false;
+            for (Theater* theater : theaters) {
+                if (theater->getLocation() == query.city && theater->hasScreen(show->getScreen()->getId())) {
+                    foundLocation = true;
+                    break;
+                }
+            }
+            if (!foundLocation) matches = false;
+        }
+
+        auto showDate = std::chrono::system_clock::to_time_t(show->getShowTime());
+        auto searchDate = std::chrono::system_clock::to_time_t(query.date);
+        auto showTm = *std::localtime(&showDate);
+        auto searchTm = *std::localtime(&searchDate);
+        if (showTm.tm_year != searchTm.tm_year || showTm.tm_mon != searchTm.tm_mon ||
+            showTm.tm_mday != searchTm.tm_mday) {
+            matches = false;
+        }
+
+        if (matches) {
+            result.push_back(show);
+        }
+    }
+    return result;
+}
+
+ShowSearchReport ShowSearchBenchmark::run() {
+    auto wallStart = std::chrono::steady_clock::now();
+    ShowSearchReport report;
+    setUp();
+    report.shows = system.getAllShows().size();
+    report.setUpSeconds = elapsedSeconds(wallStart);
+
+    std::vector<std::vector<Show*>> found(config.queries);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < config.queries; ++i) {
+        found[i] = system.searchShows(queries[i].title, queries[i].city, queries[i].date);
+    }
+    report.indexMicros = elapsedSeconds(start) * 1e6 / config.queries;
+
+    size_t matches = 0;
+    for (const auto& shows : found) {
+        matches += shows.size();
+    }
+    report.averageMatches = static_cast<double>(matches) / config.queries;
+
+    std::vector<std::vector<Show*>> scanned(config.scanQueries);
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < config.scanQueries; ++i) {
+        scanned[i] = scan(queries[i]);
+    }
+    report.scanMicros = elapsedSeconds(start) * 1e6 / config.scanQueries;
+
+    // Same shows; the index returns them by start time, the scan in catalog order
+    for (size_t i = 0; i < config.scanQueries; ++i) {
+        std::vector<Show*> indexed = found[i];
+        std::sort(indexed.begin(), indexed.end());
+        std::sort(scanned[i].begin(), scanned[i].end());
+        if (indexed != scanned[i]) report.mismatches++;
+    }
+    report.consistent = report.mismatches == 0 && report.shows == config.showCount;
+    report.wallSeconds = elapsedSeconds(wallStart);
+    return report;
+}
+
+void ShowSearchBenchmark::printReport(const std::string& label, const ShowSearchReport& report) {
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "=== " << label << " ===" << std::endl;
+    std::cout << "Shows: " << report.shows << ", set up in " << report.setUpSeconds << " s" << std::endl;
+    std::cout << "searchShows (index): " << report.indexMicros << " us/query, " << report.averageMatches
+              << " shows on average" << std::endl;
+    std::cout << "Full scan: " << report.scanMicros / 1e3 << " ms/query" << std::endl;
+    std::cout << "Mismatches: " << report.mismatches << ", consistent: " << (report.consistent ? "yes" : "NO")
+              << std::endl;
+    std::cout << "Wall time: " << report.wallSeconds << " s" << std::endl;
+}
@@ -12,9 +12,26 @@ std::string Theater::getLocation() const { return location; }
 std::string Theater::getAddress() const { return address; }
 std::string Theater::getPhone() const { return phone; }
 bool Theater::getIsActive() const { return isActive; }
-std::vector<Screen> Theater::getScreens() const { return screens; }
 int Theater::getTotalScreens() const { return screens.size(); }
 
+std::vector<Screen> Theater::getScreens() const {
+    std::vector<Screen> result;
+    result.reserve(screens.size());
+    for (const auto& screen : screens) {
+        result.push_back(*screen);
+    }
+    return result;
+}
+
+std::vector<std::string> Theater::getScreenIds() const {
+    std::vector<std::string> result;
+    result.reserve(screens.size());
+    for (const auto& screen : screens) {
+        result.push_back(screen->getId());
+    }
+    return result;
+}
+
 void Theater::setName(const std::string& name) { this->name = name; }
 void Theater::setLocation(const std::string& location) { this->location = location; }
 void Theater::setAddress(const std::string& address) { this->address = address; }
@@ -23,21 +40,21 @@ void Theater::setIsActive(bool isActive) { this->isActive = isActive; }
 
 Screen* Theater::getScreen(const std::string& screenId) {
     for (auto& screen : screens) {
-        if (screen.getId() == screenId) {
-            return &screen;
+        if (screen->getId() == screenId) {
+            return screen.get();
         }
     }
     return nullptr;
 }
 
 void Theater::addScreen(const Screen& screen) {
-    screens.push_back(screen);
+    screens.push_back(std::make_unique<Screen>(screen));
 }
 
 bool Theater::removeScreen(const std::string& screenId) {
     auto it = std::find_if(screens.begin(), screens.end(),
-                          [&screenId](const Screen& screen) {
-                              return screen.getId() == screenId;
+                          [&screenId](const std::unique_ptr<Screen>& screen) {
+                              return screen->getId() == screenId;
                           });
     if (it != screens.end()) {
         screens.erase(it);
@@ -48,15 +65,15 @@ bool Theater::removeScreen(const std::string& screenId) {
 
 bool Theater::hasScreen(const std::string& screenId) const {
     return std::any_of(screens.begin(), screens.end(),
-                      [&screenId](const Screen& screen) {
-                          return screen.getId() == screenId;
+                      [&screenId](const std::unique_ptr<Screen>& screen) {
+                          return screen->getId() == screenId;
                       });
 }
 
 int Theater::getTotalSeats() const {
     int total = 0;
     for (const auto& screen : screens) {
-        total += screen.getTotalSeats();
+        total += screen->getTotalSeats();
     }
     return total;
 }
@@ -64,7 +81,7 @@ int Theater::getTotalSeats() const {
 int Theater::getAvailableSeats() const {
     int total = 0;
     for (const auto& screen : screens) {
-        total += screen.getAvailableSeatCount();
+        total += screen->getAvailableSeatCount();
     }
     return total;
 }
@@ -72,8 +89,8 @@ int Theater::getAvailableSeats() const {
 std::vector<Screen*> Theater::getActiveScreens() const {
     std::vector<Screen*> activeScreens;
     for (const auto& screen : screens) {
-        if (screen.getIsActive()) {
-            activeScreens.push_back(const_cast<Screen*>(&screen));
+        if (screen->getIsActive()) {
+            activeScreens.push_back(screen.get());
         }
     }
     return activeScreens;
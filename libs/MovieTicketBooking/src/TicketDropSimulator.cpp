@@ -0,0 +1,219 @@
+#include "../include/TicketDropSimulator.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <unordered_set>
+
+namespace {
+    double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Value at `fraction` of the way through the sorted values; reorders them
+    double percentile(std::vector<double>& values, double fraction) {
+        if (values.empty()) return 0.0;
+        size_t rank = std::min(values.size() - 1, static_cast<size_t>(fraction * values.size()));
+        std::nth_element(values.begin(), values.begin() + rank, values.end());
+        return values[rank];
+    }
+}
+
+TicketDropSimulator::TicketDropSimulator(const TicketDropConfig& config) : config(config) {
+    this->config.showCount = std::max<size_t>(1, config.showCount);
+    this->config.userCount = std::max<size_t>(1, config.userCount);
+    this->config.minSeats = std::max(1, config.minSeats);
+    this->config.maxSeats = std::max(this->config.minSeats, config.maxSeats);
+}
+
+void TicketDropSimulator::setUp() {
+    Movie* movie = system.addMovie("Opening Night", "Ticket drop", Genre::ACTION, 150, Rating::PG13,
+                                   "Director", {"Lead"}, "English");
+    Theater* theater = system.addTheater("Drop Theater", "Metro City", "1 Main Street", "555-0100");
+
+    auto showTime = std::chrono::system_clock::now() + std::chrono::hours(24);
+    for (size_t i = 0; i < config.showCount; ++i) {
+        Screen* screen = system.addScreenToTheater(theater->getId(), "Screen " + std::to_string(i + 1),
+                                                   config.rows, config.columns);
+        shows.push_back(system.addShow(movie->getId(), theater->getId(), screen->getId(), showTime, 12.0));
+    }
+
+    for (size_t i = 0; i < config.userCount; ++i) {
+        std::string name = "fan" + std::to_string(i);
+        userIds.push_back(system.addUser(name, name + "@example.com", "555-0101", "secret")->getId());
+    }
+}
+
+std::vector<std::string> TicketDropSimulator::randomSeats(const SeatInventory& inventory, int count,
+                                                          std::mt19937& rng) const {
+    // Adjacent seats in a random row, as a buyer picking from the seat map would
+    count = std::min(count, inventory.getColumns());
+    int row = static_cast<int>(rng() % inventory.getRows());
+    int column = static_cast<int>(rng() % (inventory.getColumns() - count + 1));
+    std::vector<std::string> seatIds;
+    for (int i = 0; i < count; ++i) {
+        seatIds.push_back(inventory.seatIdOf(inventory.indexOf(row, column + i)));
+    }
+    return seatIds;
+}
+
+void TicketDropSimulator::runWorker(size_t worker, WorkerResult& result) {
+    std::mt19937 rng(config.seed + static_cast<unsigned>(worker) * 7919u);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::uniform_int_distribution<int> seatCount(config.minSeats, config.maxSeats);
+    result.latencies.reserve(config.requestsPerThread);
+
+    for (size_t i = 0; i < config.requestsPerThread; ++i) {
+        Show* show = shows[0];
+        if (shows.size() > 1 && unit(rng) >= config.hotShowShare) {
+            show = shows[1 + rng() % (shows.size() - 1)];
+        }
+        int count = seatCount(rng);
+        const std::string& userId = userIds[rng() % userIds.size()];
+        bool bestAvailable = unit(rng) < config.bestAvailableShare;
+        std::vector<std::string> seatIds;
+        if (!bestAvailable) {
+            seatIds = randomSeats(*show->getSeatInventory(), count, rng);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        Booking* booking = bestAvailable ? system.bookBestSeats(userId, show->getId(), count)
+                                         : system.createBooking(userId, show->getId(), seatIds);
+        result.latencies.push_back(elapsedSeconds(start) * 1e6);
+        result.counts.requests++;
+
+        if (!booking) {
+            if (show->getAvailableSeatCount() < count) {
+                result.counts.soldOut++;
+            } else {
+                result.counts.rejected++;
+            }
+            continue;
+        }
+        result.counts.holds++;
+
+        if (unit(rng) < config.confirmShare) {
+            if (system.confirmBooking(booking->getId())) result.counts.confirmed++;
+        } else if (system.cancelBooking(booking->getId())) {
+            result.counts.cancelled++;
+        }
+    }
+}
+
+bool TicketDropSimulator::checkConsistency(std::uint64_t& seatsSold) {
+    bool consistent = true;
+    seatsSold = 0;
+    for (Show* show : shows) {
+        const SeatInventory& inventory = *show->getSeatInventory();
+        std::unordered_set<int> soldSeats;
+        size_t heldSeats = 0;
+        for (Booking* booking : system.getBookingsByShow(show->getId())) {
+            if (booking->isPending()) {
+                heldSeats += booking->getSeatIds().size();
+            }
+            if (!booking->isConfirmed()) continue;
+            for (const auto& seatId : booking->getSeatIds()) {
+                int index = inventory.indexOf(seatId);
+                // Sold twice, or a confirmed seat the bitmap does not show as sold
+                if (!soldSeats.insert(index).second || inventory.getStatus(index) != SeatStatus::OCCUPIED) {
+                    consistent = false;
+                }
+            }
+        }
+        if (inventory.getSeatsWithStatus(SeatStatus::OCCUPIED).size() != soldSeats.size() ||
+            inventory.getSeatsWithStatus(SeatStatus::RESERVED).size() != heldSeats) {
+            consistent = false;
+        }
+        seatsSold += soldSeats.size();
+    }
+    return consistent;
+}
+
+TicketDropReport TicketDropSimulator::run() {
+    auto wallStart = std::chrono::steady_clock::now();
+    setUp();
+
+    std::vector<WorkerResult> results(config.threads);
+    std::vector<std::uint64_t> reads(config.readerThreads, 0);
+    std::atomic<bool> go(false);
+    std::atomic<size_t> running(config.threads);
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < config.threads; ++t) {
+        threads.emplace_back([&, t]() {
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            runWorker(t, results[t]);
+            running.fetch_sub(1, std::memory_order_release);
+        });
+    }
+    for (size_t t = 0; t < config.readerThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 rng(config.seed ^ (0x9e3779b9u + static_cast<unsigned>(t)));
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            while (running.load(std::memory_order_acquire) > 0) {
+                Show* show = shows[rng() % shows.size()];
+                const SeatInventory& inventory = *show->getSeatInventory();
+                system.isSeatAvailable(show->getId(), inventory.seatIdOf(rng() % inventory.getTotalSeats()));
+                show->getAvailableSeatCount();
+                reads[t] += 2;
+            }
+        });
+    }
+
+    // The drop: every buyer starts at once
+    auto rushStart = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double rushSeconds = elapsedSeconds(rushStart);
+
+    TicketDropReport report;
+    std::vector<double> latencies;
+    for (auto& result : results) {
+        report.requests += result.counts.requests;
+        report.holds += result.counts.holds;
+        report.rejected += result.counts.rejected;
+        report.soldOut += result.counts.soldOut;
+        report.confirmed += result.counts.confirmed;
+        report.cancelled += result.counts.cancelled;
+        latencies.insert(latencies.end(), result.latencies.begin(), result.latencies.end());
+    }
+    for (std::uint64_t count : reads) {
+        report.availabilityReads += count;
+    }
+    if (report.requests > 0) {
+        report.successRate = static_cast<double>(report.holds) / report.requests;
+    }
+    if (rushSeconds > 0) {
+        report.requestsPerSecond = report.requests / rushSeconds;
+    }
+    report.p50LatencyMicros = percentile(latencies, 0.50);
+    report.p99LatencyMicros = percentile(latencies, 0.99);
+    report.maxLatencyMicros = latencies.empty() ? 0.0 : *std::max_element(latencies.begin(), latencies.end());
+    report.consistent = checkConsistency(report.seatsSold);
+    report.wallSeconds = elapsedSeconds(wallStart);
+    return report;
+}
+
+void TicketDropSimulator::printReport(const std::string& label, const TicketDropReport& report) {
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "=== " << label << " ===" << std::endl;
+    std::cout << "Requests: " << report.requests << ", " << report.holds << " held, " << report.rejected
+              << " rejected, " << report.soldOut << " sold out" << std::endl;
+    std::cout << "Success rate: " << report.successRate * 100.0 << "%" << std::endl;
+    std::cout << "Holds: " << report.confirmed << " confirmed, " << report.cancelled << " cancelled" << std::endl;
+    std::cout << "Throughput: " << report.requestsPerSecond << " requests/sec" << std::endl;
+    std::cout << "Latency: p50 " << report.p50LatencyMicros << " us, p99 " << report.p99LatencyMicros
+              << " us, max " << report.maxLatencyMicros << " us" << std::endl;
+    std::cout << "Availability reads: " << report.availabilityReads << std::endl;
+    std::cout << "Seats sold: " << report.seatsSold << ", consistent: " << (report.consistent ? "yes" : "NO")
+              << std::endl;
+    std::cout << "Wall time: " << report.wallSeconds << " s" << std::endl;
+}
@@ -0,0 +1,70 @@
+#include "../include/TimingWheel.hpp"
+#include <algorithm>
+
+TimingWheel::TimingWheel(Clock::duration tick, size_t slotCount, Clock::time_point origin)
+    : origin(origin), tick(tick > Clock::duration::zero() ? tick : Clock::duration(1)),
+      slots(std::max<size_t>(1, slotCount)), currentTick(0) {}
+
+std::int64_t TimingWheel::tickOf(const Clock::time_point& time, bool roundUp) const {
+    auto elapsed = (time - origin).count();
+    auto length = tick.count();
+    std::int64_t ticks = elapsed / length;
+    // Integer division truncates toward zero; correct it to floor or ceiling
+    if (elapsed % length != 0) {
+        if (roundUp && elapsed > 0) ticks++;
+        if (!roundUp && elapsed < 0) ticks--;
+    }
+    return ticks;
+}
+
+void TimingWheel::schedule(const std::string& key, const Clock::time_point& deadline) {
+    std::int64_t deadlineTick = std::max(tickOf(deadline, true), currentTick + 1);
+    deadlines[key] = deadlineTick;
+    slots[static_cast<size_t>(deadlineTick % static_cast<std::int64_t>(slots.size()))].push_back({key, deadlineTick});
+}
+
+bool TimingWheel::cancel(const std::string& key) {
+    return deadlines.erase(key) > 0;
+}
+
+bool TimingWheel::contains(const std::string& key) const {
+    return deadlines.count(key) > 0;
+}
+
+size_t TimingWheel::size() const { return deadlines.size(); }
+
+std::vector<std::string> TimingWheel::advance(const Clock::time_point& now) {
+    std::vector<std::string> expired;
+    std::int64_t nowTick = tickOf(now, false);
+    if (nowTick <= currentTick) {
+        return expired;
+    }
+
+    // After a full revolution every slot has been visited once
+    std::int64_t steps = std::min<std::int64_t>(nowTick - currentTick, static_cast<std::int64_t>(slots.size()));
+    for (std::int64_t t = currentTick + 1; t <= currentTick + steps; ++t) {
+        std::vector<Entry>& slot = slots[static_cast<size_t>(t % static_cast<std::int64_t>(slots.size()))];
+        size_t kept = 0;
+        for (size_t i = 0; i < slot.size(); ++i) {
+            auto it = deadlines.find(slot[i].key);
+            if (it == deadlines.end() || it->second != slot[i].deadlineTick) {
+                continue; // Cancelled or rescheduled
+            }
+            if (slot[i].deadlineTick <= nowTick) {
+                expired.push_back(std::move(slot[i].key));
+                deadlines.erase(it);
+                continue;
+            }
+            if (kept != i) {
+                slot[kept] = std::move(slot[i]);
+            }
+            kept++;
+        }
+        slot.resize(kept);
+    }
+    currentTick = nowTick;
+    return expired;
+}
+
+TimingWheel::Clock::duration TimingWheel::getTick() const { return tick; }
+size_t TimingWheel::getSlotCount() const { return slots.size(); }
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Payment.hpp"
+#include "VehicleType.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+enum class ParkingEventType : std::uint8_t { PARK = 1, UNPARK = 2, PAYMENT = 3 };
+
+struct ParkingEvent {
+    ParkingEventType type = ParkingEventType::PARK;
+    std::uint64_t sequence = 0;
+    std::int64_t timestamp = 0;     // system_clock ticks since epoch
+    int levelNumber = 0;
+    int slotId = 0;
+    VehicleType vehicleType = VehicleType::CAR;
+    std::uint64_t ticketSeq = 0;
+    PaymentMethod method = PaymentMethod::CASH;
+    double amount = 0.0;
+    std::string license;
+    std::string ticketId;
+};
+
+struct OccupancyRecord {
+    int levelNumber = 0;
+    int slotId = 0;
+    VehicleType vehicleType = VehicleType::CAR;
+    std::string license;
+    std::string ticketId;
+    std::int64_t entryTime = 0;
+    bool isPaid = false;
+};
+
+struct ParkingSnapshot {
+    std::uint64_t lastSequence = 0;
+    std::uint64_t nextTicketSeq = 1;
+    std::vector<OccupancyRecord> occupancy;
+};
+
+// Append-only binary log of park/unpark/payment events plus a compact
+// occupancy snapshot. Records are length-prefixed and checksummed so a torn
+// tail write is detected and dropped on load. Files use native byte order.
+class ParkingEventLog {
+    std::string logPath;
+    std::string snapshotPath;
+    std::ofstream logStream;
+    std::uint64_t nextSequence;
+    std::size_t eventsSinceSnapshot;
+    std::size_t snapshotInterval;
+
+    bool openLog(bool truncate);
+
+public:
+    explicit ParkingEventLog(const std::string& directory, std::size_t snapshotEvery = 10000);
+
+    // reads the snapshot and every logged event newer than it
+    bool load(ParkingSnapshot& snapshot, std::vector<ParkingEvent>& tail);
+
+    // assigns the next sequence number and appends the event
+    std::uint64_t append(ParkingEvent event);
+
+    // atomically replaces the snapshot, then truncates the log
+    bool writeSnapshot(const ParkingSnapshot& snapshot);
+
+    bool shouldSnapshot() const { return eventsSinceSnapshot >= snapshotInterval; }
+    std::uint64_t getLastSequence() const { return nextSequence - 1; }
+    std::string getLogPath() const { return logPath; }
+    std::string getSnapshotPath() const { return snapshotPath; }
+};
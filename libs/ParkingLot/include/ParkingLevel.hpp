@@ -2,6 +2,7 @@
 
 #include "ParkingSlot.hpp"
 #include "Vehicle.hpp"
+#include <array>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -11,6 +12,14 @@ class ParkingLevel {
     std::vector<std::shared_ptr<ParkingSlot>> slots;
     std::unordered_map<std::string, std::shared_ptr<ParkingSlot>> vehicleToSlot;
 
+    // free slot indices per SlotType; freePosition[i] is slot i's index in its list, -1 when occupied
+    std::array<std::vector<int>, 3> freeSlots;
+    std::vector<int> freePosition;
+    std::array<int, 3> totalSlots;
+
+    void markOccupied(int slotIndex);
+    void markFree(int slotIndex);
+
 public:
     ParkingLevel(int floorNumber, int carSlots, int bikeSlots, int truckSlots);
 
@@ -19,6 +28,12 @@ public:
     bool parkVehicle(std::shared_ptr<Vehicle> v);
     bool unParkVehicle(const std::string& licenseNumber);
 
+    // recovery support
+    std::shared_ptr<ParkingSlot> getSlotForVehicle(const std::string& licenseNumber) const;
+    const std::unordered_map<std::string, std::shared_ptr<ParkingSlot>>& getParkedVehicles() const { return vehicleToSlot; }
+    bool restoreVehicle(std::shared_ptr<Vehicle> v, int slotId);
+
     int getAvailableSlots(SlotType type) const;
     int getTotalSlots(SlotType type) const;
+    int getOccupiedSlots() const { return static_cast<int>(vehicleToSlot.size()); }
 };
\ No newline at end of file
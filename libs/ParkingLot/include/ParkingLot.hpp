@@ -1,10 +1,12 @@
 #pragma once
 
+#include "ParkingEventLog.hpp"
 #include "ParkingLevel.hpp"
 #include "Payment.hpp"
 #include "Strategy.hpp"
 #include "Ticket.hpp"
 #include "Vehicle.hpp"
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -14,10 +16,19 @@ class ParkingLot {
     std::string name;
     std::vector<std::shared_ptr<ParkingLevel>> levels;
     std::unordered_map<std::string, std::shared_ptr<Ticket>> activeTickets;
+    std::unordered_map<std::string, std::shared_ptr<Ticket>> ticketsById;
+    std::uint64_t nextTicketSeq;
     std::unique_ptr<PricingStrategy> pricingStrategy;
     double hourlyRate;
+    std::unique_ptr<ParkingEventLog> eventLog;
     mutable std::mutex parkingMutex;
 
+    std::string generateTicketId();
+    std::shared_ptr<Ticket> findTicketById(const std::string& ticketId) const;
+    void logEvent(ParkingEvent event);
+    ParkingSnapshot buildSnapshot() const;
+    bool checkpointLocked();
+
 public:
     ParkingLot(std::string lotName, int levelNums, int slotsPerLevel, double rate);
 
@@ -34,8 +45,13 @@ public:
     // status queries
     int getAvailableSlots() const;
     int getTotalSlots() const;
+    std::vector<int> getOccupiedSlotsByLevel() const;
     bool isVehicleParked(const std::string& license) const;
 
     // strategy pattern for pricing
     void setPricingStrategy(std::unique_ptr<PricingStrategy> strategy);
+
+    // persistence: replays snapshot + log tail into this (empty) lot, then logs every change
+    bool attachEventLog(std::unique_ptr<ParkingEventLog> log);
+    bool checkpoint();
 };
\ No newline at end of file
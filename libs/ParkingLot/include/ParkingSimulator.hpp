@@ -0,0 +1,56 @@
+#pragma once
+
+#include "ParkingLot.hpp"
+#include "Strategy.hpp"
+#include "VehicleType.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+struct ParkingTraceEvent {
+    double time;            // hours; any origin, replayed traces may use negative times
+    bool arrival;
+    VehicleType type;
+    std::uint32_t vehicleId;
+};
+
+struct OccupancySample {
+    double time;
+    std::vector<int> occupiedByLevel;
+};
+
+struct StrategyRevenue {
+    std::string name;
+    double revenue;
+};
+
+struct SimulationResult {
+    std::size_t arrivals = 0;
+    std::size_t departures = 0;
+    std::size_t rejected = 0;
+    std::vector<OccupancySample> occupancy;
+    std::vector<StrategyRevenue> revenue;
+    double eventsPerSecond = 0.0;
+};
+
+// Replays arrival/departure traces through a ParkingLot in trace time, sampling
+// per-level occupancy and pricing every departure under each registered strategy.
+class ParkingSimulator {
+    ParkingLot& lot;
+    double sampleInterval;
+    std::vector<std::pair<std::string, std::unique_ptr<PricingStrategy>>> strategies;
+
+public:
+    explicit ParkingSimulator(ParkingLot& parkingLot, double sampleIntervalHours = 0.25);
+
+    void addStrategy(std::string name, std::unique_ptr<PricingStrategy> strategy);
+
+    // trace sources
+    static std::vector<ParkingTraceEvent> generateTrace(std::size_t vehicles, double horizonHours, double meanStayHours, unsigned seed);
+    static std::vector<ParkingTraceEvent> loadTrace(const std::string& csvPath);
+
+    // the lot should be empty; every vehicle still parked at the end is unparked
+    SimulationResult run(std::vector<ParkingTraceEvent> trace);
+};
@@ -12,6 +12,7 @@ class Ticket {
 
 public:
     Ticket(std::string id, std::string license);
+    Ticket(std::string id, std::string license, std::chrono::system_clock::time_point entry);
 
     std::string getTicketId() const { return ticketId; }
     std::string getLicenseNumber() const { return licenseNumber; }
@@ -0,0 +1,257 @@
+#include "../include/ParkingEventLog.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+const std::uint32_t SNAPSHOT_MAGIC = 0x50534e50; // "PNSP"
+const std::uint32_t SNAPSHOT_VERSION = 1;
+
+std::uint32_t checksum(const char* data, std::size_t len) {
+    std::uint32_t hash = 2166136261u;
+    for(std::size_t i = 0; i < len; i++) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+template <typename T>
+void put(std::string& out, T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    out.append(bytes, sizeof(T));
+}
+
+void putString(std::string& out, const std::string& s) {
+    put<std::uint32_t>(out, static_cast<std::uint32_t>(s.size()));
+    out.append(s);
+}
+
+struct Reader {
+    const char* data;
+    std::size_t size;
+    std::size_t pos;
+    bool ok;
+
+    Reader(const char* d, std::size_t n): data(d), size(n), pos(0), ok(true) {}
+
+    template <typename T>
+    T get() {
+        T value{};
+        if(!ok || size - pos < sizeof(T)) {
+            ok = false;
+            return value;
+        }
+        std::memcpy(&value, data + pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+
+    std::string getString() {
+        auto len = get<std::uint32_t>();
+        if(!ok || size - pos < len) {
+            ok = false;
+            return {};
+        }
+        std::string s(data + pos, len);
+        pos += len;
+        return s;
+    }
+};
+
+void encodeEvent(std::string& out, const ParkingEvent& e) {
+    put<std::uint8_t>(out, static_cast<std::uint8_t>(e.type));
+    put<std::uint64_t>(out, e.sequence);
+    put<std::int64_t>(out, e.timestamp);
+    put<std::int32_t>(out, e.levelNumber);
+    put<std::int32_t>(out, e.slotId);
+    put<std::uint8_t>(out, static_cast<std::uint8_t>(e.vehicleType));
+    put<std::uint64_t>(out, e.ticketSeq);
+    put<std::uint8_t>(out, static_cast<std::uint8_t>(e.method));
+    put<double>(out, e.amount);
+    putString(out, e.license);
+    putString(out, e.ticketId);
+}
+
+ParkingEvent decodeEvent(Reader& in) {
+    ParkingEvent e;
+    e.type = static_cast<ParkingEventType>(in.get<std::uint8_t>());
+    e.sequence = in.get<std::uint64_t>();
+    e.timestamp = in.get<std::int64_t>();
+    e.levelNumber = in.get<std::int32_t>();
+    e.slotId = in.get<std::int32_t>();
+    e.vehicleType = static_cast<VehicleType>(in.get<std::uint8_t>());
+    e.ticketSeq = in.get<std::uint64_t>();
+    e.method = static_cast<PaymentMethod>(in.get<std::uint8_t>());
+    e.amount = in.get<double>();
+    e.license = in.getString();
+    e.ticketId = in.getString();
+    return e;
+}
+
+bool readFile(const std::string& path, std::string& contents) {
+    std::ifstream in(path, std::ios::binary);
+    if(!in) {
+        return false;
+    }
+    contents.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return true;
+}
+
+} // namespace
+
+ParkingEventLog::ParkingEventLog(const std::string& directory, std::size_t snapshotEvery): logPath(directory + "/parking.log"), snapshotPath(directory + "/parking.snap"), nextSequence(1), eventsSinceSnapshot(0), snapshotInterval(snapshotEvery) {}
+
+bool ParkingEventLog::openLog(bool truncate) {
+    if(logStream.is_open()) {
+        logStream.close();
+    }
+    logStream.open(logPath, std::ios::binary | (truncate ? std::ios::trunc : std::ios::app));
+    return logStream.is_open();
+}
+
+bool ParkingEventLog::load(ParkingSnapshot& snapshot, std::vector<ParkingEvent>& tail) {
+    snapshot = ParkingSnapshot();
+    tail.clear();
+
+    std::string buffer;
+    if(readFile(snapshotPath, buffer)) {
+        if(buffer.size() < sizeof(std::uint32_t)) {
+            return false;
+        }
+
+        std::size_t bodySize = buffer.size() - sizeof(std::uint32_t);
+        std::uint32_t stored;
+        std::memcpy(&stored, buffer.data() + bodySize, sizeof(stored));
+        if(stored != checksum(buffer.data(), bodySize)) {
+            return false;
+        }
+
+        Reader in(buffer.data(), bodySize);
+        if(in.get<std::uint32_t>() != SNAPSHOT_MAGIC || in.get<std::uint32_t>() != SNAPSHOT_VERSION) {
+            return false;
+        }
+
+        snapshot.lastSequence = in.get<std::uint64_t>();
+        snapshot.nextTicketSeq = in.get<std::uint64_t>();
+        auto count = in.get<std::uint32_t>();
+        snapshot.occupancy.reserve(in.ok ? count : 0);
+
+        for(std::uint32_t i = 0; i < count && in.ok; i++) {
+            OccupancyRecord r;
+            r.levelNumber = in.get<std::int32_t>();
+            r.slotId = in.get<std::int32_t>();
+            r.vehicleType = static_cast<VehicleType>(in.get<std::uint8_t>());
+            r.entryTime = in.get<std::int64_t>();
+            r.isPaid = in.get<std::uint8_t>() != 0;
+            r.license = in.getString();
+            r.ticketId = in.getString();
+            snapshot.occupancy.push_back(std::move(r));
+        }
+
+        if(!in.ok) {
+            return false;
+        }
+    }
+
+    nextSequence = snapshot.lastSequence + 1;
+
+    if(readFile(logPath, buffer)) {
+        Reader in(buffer.data(), buffer.size());
+        while(in.pos < in.size) {
+            auto len = in.get<std::uint32_t>();
+            if(!in.ok || in.size - in.pos < len + sizeof(std::uint32_t)) {
+                break; // torn tail
+            }
+
+            const char* payload = in.data + in.pos;
+            std::uint32_t stored;
+            std::memcpy(&stored, payload + len, sizeof(stored));
+            if(stored != checksum(payload, len)) {
+                break;
+            }
+
+            Reader record(payload, len);
+            ParkingEvent e = decodeEvent(record);
+            in.pos += len + sizeof(std::uint32_t);
+            if(!record.ok) {
+                break;
+            }
+
+            if(e.sequence > snapshot.lastSequence) {
+                if(e.sequence >= nextSequence) {
+                    nextSequence = e.sequence + 1;
+                }
+                tail.push_back(std::move(e));
+            }
+        }
+    }
+
+    eventsSinceSnapshot = tail.size();
+    return true;
+}
+
+std::uint64_t ParkingEventLog::append(ParkingEvent event) {
+    if(!logStream.is_open() && !openLog(false)) {
+        return 0;
+    }
+
+    event.sequence = nextSequence++;
+
+    std::string payload;
+    encodeEvent(payload, event);
+
+    std::string record;
+    record.reserve(payload.size() + 2 * sizeof(std::uint32_t));
+    put<std::uint32_t>(record, static_cast<std::uint32_t>(payload.size()));
+    record.append(payload);
+    put<std::uint32_t>(record, checksum(payload.data(), payload.size()));
+
+    logStream.write(record.data(), record.size());
+    logStream.flush();
+    eventsSinceSnapshot++;
+    return event.sequence;
+}
+
+bool ParkingEventLog::writeSnapshot(const ParkingSnapshot& snapshot) {
+    std::string body;
+    body.reserve(32 + snapshot.occupancy.size() * 48);
+    put<std::uint32_t>(body, SNAPSHOT_MAGIC);
+    put<std::uint32_t>(body, SNAPSHOT_VERSION);
+    put<std::uint64_t>(body, snapshot.lastSequence);
+    put<std::uint64_t>(body, snapshot.nextTicketSeq);
+    put<std::uint32_t>(body, static_cast<std::uint32_t>(snapshot.occupancy.size()));
+
+    for(const auto &r: snapshot.occupancy) {
+        put<std::int32_t>(body, r.levelNumber);
+        put<std::int32_t>(body, r.slotId);
+        put<std::uint8_t>(body, static_cast<std::uint8_t>(r.vehicleType));
+        put<std::int64_t>(body, r.entryTime);
+        put<std::uint8_t>(body, r.isPaid ? 1 : 0);
+        putString(body, r.license);
+        putString(body, r.ticketId);
+    }
+    put<std::uint32_t>(body, checksum(body.data(), body.size()));
+
+    std::string tmpPath = snapshotPath + ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+        if(!out.write(body.data(), body.size())) {
+            return false;
+        }
+    }
+
+    if(std::rename(tmpPath.c_str(), snapshotPath.c_str()) != 0) {
+        return false;
+    }
+
+    // events up to lastSequence are now covered by the snapshot; if we crash
+    // before the truncate, load() skips them by sequence number
+    eventsSinceSnapshot = 0;
+    return openLog(true);
+}
@@ -2,7 +2,6 @@
 #include "../include/CarSlot.hpp"
 #include "../include/BikeSlot.hpp"
 #include "../include/TruckSlot.hpp"
-#include <algorithm>
 #include <memory>
 #include <string>
 
@@ -20,12 +19,35 @@ ParkingLevel::ParkingLevel(int floorNum, int carSlots, int bikeSlots, int truckS
     for(int i = 0; i < truckSlots; i++) {
         slots.push_back(std::make_shared<TruckSlot>(slotId++));
     }
+
+    totalSlots = {carSlots, bikeSlots, truckSlots};
+    freePosition.assign(slots.size(), -1);
+
+    // pushed in reverse so back() hands out the lowest slot id first
+    for(int i = static_cast<int>(slots.size()) - 1; i >= 0; i--) {
+        markFree(i);
+    }
+}
+
+void ParkingLevel::markFree(int slotIndex) {
+    auto &list = freeSlots[static_cast<int>(slots[slotIndex]->getType())];
+    freePosition[slotIndex] = static_cast<int>(list.size());
+    list.push_back(slotIndex);
+}
+
+void ParkingLevel::markOccupied(int slotIndex) {
+    auto &list = freeSlots[static_cast<int>(slots[slotIndex]->getType())];
+    int pos = freePosition[slotIndex];
+    list[pos] = list.back();
+    freePosition[list[pos]] = pos;
+    list.pop_back();
+    freePosition[slotIndex] = -1;
 }
 
 std::shared_ptr<ParkingSlot> ParkingLevel::findAvailableSlot(const Vehicle& v) {
-    for(auto &slot: slots) {
-        if(slot->isAvailable() && slot->canFitVehicle(v)) {
-            return slot;
+    for(const auto &list: freeSlots) {
+        if(!list.empty() && slots[list.back()]->canFitVehicle(v)) {
+            return slots[list.back()];
         }
     }
 
@@ -38,8 +60,10 @@ bool ParkingLevel::parkVehicle(std::shared_ptr<Vehicle> v) {
         return false;
     }
 
-    if(slot->parkVehicle(v)) {
-        vehicleToSlot[v->getLicenseNumber()] = slot;
+    std::string license = v->getLicenseNumber();
+    if(slot->parkVehicle(std::move(v))) {
+        markOccupied(slot->getSlotId() - 1);
+        vehicleToSlot[license] = slot;
         return true;
     }
 
@@ -53,18 +77,36 @@ bool ParkingLevel::unParkVehicle(const std::string& licenseNumber) {
     }
 
     it->second->unParkVehicle();
+    markFree(it->second->getSlotId() - 1);
     vehicleToSlot.erase(it);
     return true;
 }
 
+std::shared_ptr<ParkingSlot> ParkingLevel::getSlotForVehicle(const std::string& licenseNumber) const {
+    auto it = vehicleToSlot.find(licenseNumber);
+    return it == vehicleToSlot.end() ? nullptr : it->second;
+}
+
+bool ParkingLevel::restoreVehicle(std::shared_ptr<Vehicle> v, int slotId) {
+    // slot ids are assigned sequentially from 1 in the constructor
+    if(slotId < 1 || slotId > static_cast<int>(slots.size())) {
+        return false;
+    }
+
+    auto &slot = slots[slotId - 1];
+    if(!slot->parkVehicle(v)) {
+        return false;
+    }
+
+    markOccupied(slotId - 1);
+    vehicleToSlot[v->getLicenseNumber()] = slot;
+    return true;
+}
+
 int ParkingLevel::getAvailableSlots(SlotType type) const {
-    return std::count_if(slots.begin(), slots.end(), [type](const std::shared_ptr<ParkingSlot>& slot) {
-        return slot->getType() == type && !slot->isAvailable();
-    });
+    return static_cast<int>(freeSlots[static_cast<int>(type)].size());
 }
 
 int ParkingLevel::getTotalSlots(SlotType type) const {
-    return std::count_if(slots.begin(), slots.end(), [type](const std::shared_ptr<ParkingSlot>& slot)  {
-        return slot->getType() == type;
-    });
+    return totalSlots[static_cast<int>(type)];
 }
\ No newline at end of file
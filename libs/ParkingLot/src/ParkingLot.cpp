@@ -1,13 +1,39 @@
 #include "../include/ParkingLot.hpp"
 #include "../include/Strategy.hpp"
 #include "../include/Payment.hpp"
+#include "../include/Car.hpp"
+#include "../include/Bike.hpp"
+#include "../include/Truck.hpp"
+#include <algorithm>
 #include <chrono>
+#include <cstdio>
 #include <memory>
 #include <mutex>
-#include <random>
 #include <sstream>
+#include <unordered_map>
 
-ParkingLot::ParkingLot(std::string lotName, int levelNums, int slotsPerLevel, double rate): name(std::move(lotName)), hourlyRate(rate) {
+namespace {
+
+std::shared_ptr<Vehicle> makeVehicle(VehicleType type, const std::string& license) {
+    switch(type) {
+        case VehicleType::BIKE: return std::make_shared<Bike>(license);
+        case VehicleType::TRUCK: return std::make_shared<Truck>(license);
+        case VehicleType::CAR:
+        default: return std::make_shared<Car>(license);
+    }
+}
+
+std::int64_t toTicks(std::chrono::system_clock::time_point t) {
+    return t.time_since_epoch().count();
+}
+
+std::chrono::system_clock::time_point fromTicks(std::int64_t ticks) {
+    return std::chrono::system_clock::time_point(std::chrono::system_clock::duration(ticks));
+}
+
+} // namespace
+
+ParkingLot::ParkingLot(std::string lotName, int levelNums, int slotsPerLevel, double rate): name(std::move(lotName)), nextTicketSeq(1), hourlyRate(rate) {
     int carSlots = slotsPerLevel / 2;
     int bikeSlots = slotsPerLevel / 3;
     int truckSlots = slotsPerLevel - carSlots - bikeSlots;
@@ -19,25 +45,44 @@ ParkingLot::ParkingLot(std::string lotName, int levelNums, int slotsPerLevel, do
     pricingStrategy = std::make_unique<StandardPricing>();
 }
 
+// caller must hold parkingMutex
+std::string ParkingLot::generateTicketId() {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "TKT%08llu", static_cast<unsigned long long>(nextTicketSeq++));
+    return buf;
+}
+
+// caller must hold parkingMutex
+std::shared_ptr<Ticket> ParkingLot::findTicketById(const std::string& ticketId) const {
+    auto it = ticketsById.find(ticketId);
+    return it == ticketsById.end() ? nullptr : it->second;
+}
+
 std::shared_ptr<Ticket> ParkingLot::parkVehicle(std::shared_ptr<Vehicle> v) {
     std::lock_guard<std::mutex> lock(parkingMutex);
 
-    if(isVehicleParked(v->getLicenseNumber())) {
+    if(activeTickets.find(v->getLicenseNumber()) != activeTickets.end()) {
         return nullptr;
     }
 
     for(auto &level: levels) {
         if(level->parkVehicle(v)) {
-            std::random_device rd;
-            std::mt19937 gen(rd());
-            std::uniform_int_distribution<> dis(1000, 9999);
-
-            std::stringstream ss;
-            ss << "TKT" << dis(gen);
-            std::string ticketId = ss.str();
-
-            auto ticket = std::make_shared<Ticket>(ticketId, v->getLicenseNumber());
+            auto ticket = std::make_shared<Ticket>(generateTicketId(), v->getLicenseNumber());
             activeTickets[v->getLicenseNumber()] = ticket;
+            ticketsById[ticket->getTicketId()] = ticket;
+
+            if(eventLog) {
+                ParkingEvent event;
+                event.type = ParkingEventType::PARK;
+                event.timestamp = toTicks(ticket->getEntryTime());
+                event.levelNumber = level->getFloorNumber();
+                event.slotId = level->getSlotForVehicle(v->getLicenseNumber())->getSlotId();
+                event.vehicleType = v->getType();
+                event.ticketSeq = nextTicketSeq - 1;
+                event.license = v->getLicenseNumber();
+                event.ticketId = ticket->getTicketId();
+                logEvent(std::move(event));
+            }
 
             return ticket;
         }
@@ -57,7 +102,16 @@ bool ParkingLot::unParkVehicle(const std::string& licenseNumber) {
     for(auto &level: levels) {
         if(level->unParkVehicle(licenseNumber)) {
             ticketIt->second->setExitTime();
+            ticketsById.erase(ticketIt->second->getTicketId());
             activeTickets.erase(ticketIt);
+
+            if(eventLog) {
+                ParkingEvent event;
+                event.type = ParkingEventType::UNPARK;
+                event.timestamp = toTicks(std::chrono::system_clock::now());
+                event.license = licenseNumber;
+                logEvent(std::move(event));
+            }
             return true;
         }
     }
@@ -68,13 +122,8 @@ bool ParkingLot::unParkVehicle(const std::string& licenseNumber) {
 double ParkingLot::calculateFee(const std::string& ticketId) {
     std::lock_guard<std::mutex> lock(parkingMutex);
 
-    for(auto &[license, ticket]: activeTickets) {
-        if(ticket->getTicketId() == ticketId) {
-            return ticket->calculateAmount(hourlyRate);
-        }
-    }
-
-    return 0.0;
+    auto ticket = findTicketById(ticketId);
+    return ticket ? ticket->calculateAmount(hourlyRate) : 0.0;
 }
 
 std::shared_ptr<Payment> ParkingLot::processPayment(const std::string& ticketId, PaymentMethod method) {
@@ -90,10 +139,19 @@ std::shared_ptr<Payment> ParkingLot::processPayment(const std::string& ticketId,
     auto payment = std::make_shared<Payment>(paymentId, amount, method, ticketId);
 
     if(payment->processPayment()) {
-        for(auto &[license, ticket]: activeTickets) {
-            if(ticket->getTicketId() == ticketId) {
-                ticket->markAsPaid();
-                break;
+        std::lock_guard<std::mutex> lock(parkingMutex);
+        if(auto ticket = findTicketById(ticketId)) {
+            ticket->markAsPaid();
+
+            if(eventLog) {
+                ParkingEvent event;
+                event.type = ParkingEventType::PAYMENT;
+                event.timestamp = toTicks(std::chrono::system_clock::now());
+                event.method = method;
+                event.amount = amount;
+                event.license = ticket->getLicenseNumber();
+                event.ticketId = ticketId;
+                logEvent(std::move(event));
             }
         }
         return payment;
@@ -113,6 +171,29 @@ int ParkingLot::getAvailableSlots() const {
     return total;
 }
 
+int ParkingLot::getTotalSlots() const {
+    std::lock_guard<std::mutex> lock(parkingMutex);
+
+    int total = 0;
+    for(const auto &level: levels) {
+        total += level->getTotalSlots(SlotType::CAR) + level->getTotalSlots(SlotType::BIKE) + level->getTotalSlots(SlotType::TRUCK);
+    }
+
+    return total;
+}
+
+std::vector<int> ParkingLot::getOccupiedSlotsByLevel() const {
+    std::lock_guard<std::mutex> lock(parkingMutex);
+
+    std::vector<int> occupied;
+    occupied.reserve(levels.size());
+    for(const auto &level: levels) {
+        occupied.push_back(level->getOccupiedSlots());
+    }
+
+    return occupied;
+}
+
 bool ParkingLot::isVehicleParked(const std::string& licenseNumber) const {
     std::lock_guard<std::mutex> lock(parkingMutex);
     return activeTickets.find(licenseNumber) != activeTickets.end();
@@ -121,4 +202,125 @@ bool ParkingLot::isVehicleParked(const std::string& licenseNumber) const {
 void ParkingLot::setPricingStrategy(std::unique_ptr<PricingStrategy> strategy) {
     std::lock_guard<std::mutex> lock(parkingMutex);
     pricingStrategy = std::move(strategy);
-}
\ No newline at end of file
+}
+
+// caller must hold parkingMutex
+void ParkingLot::logEvent(ParkingEvent event) {
+    eventLog->append(std::move(event));
+    if(eventLog->shouldSnapshot()) {
+        checkpointLocked();
+    }
+}
+
+// caller must hold parkingMutex
+ParkingSnapshot ParkingLot::buildSnapshot() const {
+    ParkingSnapshot snapshot;
+    snapshot.lastSequence = eventLog ? eventLog->getLastSequence() : 0;
+    snapshot.nextTicketSeq = nextTicketSeq;
+    snapshot.occupancy.reserve(activeTickets.size());
+
+    for(const auto &level: levels) {
+        for(const auto &[license, slot]: level->getParkedVehicles()) {
+            auto ticketIt = activeTickets.find(license);
+            if(ticketIt == activeTickets.end()) {
+                continue;
+            }
+
+            OccupancyRecord r;
+            r.levelNumber = level->getFloorNumber();
+            r.slotId = slot->getSlotId();
+            r.vehicleType = slot->getParkedVehicle()->getType();
+            r.license = license;
+            r.ticketId = ticketIt->second->getTicketId();
+            r.entryTime = toTicks(ticketIt->second->getEntryTime());
+            r.isPaid = ticketIt->second->getIsPaid();
+            snapshot.occupancy.push_back(std::move(r));
+        }
+    }
+
+    return snapshot;
+}
+
+// caller must hold parkingMutex
+bool ParkingLot::checkpointLocked() {
+    return eventLog && eventLog->writeSnapshot(buildSnapshot());
+}
+
+bool ParkingLot::checkpoint() {
+    std::lock_guard<std::mutex> lock(parkingMutex);
+    return checkpointLocked();
+}
+
+bool ParkingLot::attachEventLog(std::unique_ptr<ParkingEventLog> log) {
+    std::lock_guard<std::mutex> lock(parkingMutex);
+
+    if(!log || !activeTickets.empty()) {
+        return false;
+    }
+
+    ParkingSnapshot snapshot;
+    std::vector<ParkingEvent> tail;
+    if(!log->load(snapshot, tail)) {
+        return false;
+    }
+
+    // fold the tail into the snapshot state before touching any slot
+    std::unordered_map<std::string, OccupancyRecord> state;
+    state.reserve(snapshot.occupancy.size() + tail.size());
+    for(auto &r: snapshot.occupancy) {
+        std::string license = r.license;
+        state.emplace(std::move(license), std::move(r));
+    }
+
+    std::uint64_t ticketSeq = snapshot.nextTicketSeq;
+    for(auto &e: tail) {
+        switch(e.type) {
+            case ParkingEventType::PARK: {
+                OccupancyRecord r;
+                r.levelNumber = e.levelNumber;
+                r.slotId = e.slotId;
+                r.vehicleType = e.vehicleType;
+                r.license = e.license;
+                r.ticketId = e.ticketId;
+                r.entryTime = e.timestamp;
+                state[e.license] = std::move(r);
+                ticketSeq = std::max(ticketSeq, e.ticketSeq + 1);
+                break;
+            }
+            case ParkingEventType::UNPARK:
+                state.erase(e.license);
+                break;
+            case ParkingEventType::PAYMENT: {
+                auto it = state.find(e.license);
+                if(it != state.end() && it->second.ticketId == e.ticketId) {
+                    it->second.isPaid = true;
+                }
+                break;
+            }
+        }
+    }
+
+    bool consistent = true;
+    activeTickets.reserve(state.size());
+    ticketsById.reserve(state.size());
+    for(auto &[license, r]: state) {
+        if(r.levelNumber < 1 || r.levelNumber > static_cast<int>(levels.size()) ||
+           !levels[r.levelNumber - 1]->restoreVehicle(makeVehicle(r.vehicleType, license), r.slotId)) {
+            consistent = false;
+            continue;
+        }
+
+        auto ticket = std::make_shared<Ticket>(r.ticketId, license, fromTicks(r.entryTime));
+        if(r.isPaid) {
+            ticket->markAsPaid();
+        }
+        activeTickets[license] = ticket;
+        ticketsById[ticket->getTicketId()] = ticket;
+    }
+
+    nextTicketSeq = std::max(nextTicketSeq, ticketSeq);
+    eventLog = std::move(log);
+
+    // compact the replayed tail so the next restart only reads the snapshot
+    return checkpointLocked() && consistent;
+}
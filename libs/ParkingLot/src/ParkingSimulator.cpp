@@ -0,0 +1,164 @@
+#include "../include/ParkingSimulator.hpp"
+#include "../include/Bike.hpp"
+#include "../include/Car.hpp"
+#include "../include/Truck.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+
+std::shared_ptr<Vehicle> makeSimVehicle(VehicleType type, std::uint32_t id) {
+    std::string license = "SIM" + std::to_string(id);
+    switch(type) {
+        case VehicleType::BIKE: return std::make_shared<Bike>(std::move(license));
+        case VehicleType::TRUCK: return std::make_shared<Truck>(std::move(license));
+        case VehicleType::CAR:
+        default: return std::make_shared<Car>(std::move(license));
+    }
+}
+
+VehicleType parseVehicleType(const std::string& s) {
+    if(s == "BIKE") return VehicleType::BIKE;
+    if(s == "TRUCK") return VehicleType::TRUCK;
+    return VehicleType::CAR;
+}
+
+} // namespace
+
+ParkingSimulator::ParkingSimulator(ParkingLot& parkingLot, double sampleIntervalHours): lot(parkingLot), sampleInterval(sampleIntervalHours) {}
+
+void ParkingSimulator::addStrategy(std::string name, std::unique_ptr<PricingStrategy> strategy) {
+    strategies.emplace_back(std::move(name), std::move(strategy));
+}
+
+std::vector<ParkingTraceEvent> ParkingSimulator::generateTrace(std::size_t vehicles, double horizonHours, double meanStayHours, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> arrivalDist(0.0, horizonHours);
+    std::exponential_distribution<double> stayDist(1.0 / meanStayHours);
+    std::discrete_distribution<int> typeDist({60, 30, 10}); // car, bike, truck
+
+    std::vector<ParkingTraceEvent> trace;
+    trace.reserve(vehicles * 2);
+    for(std::size_t i = 0; i < vehicles; i++) {
+        auto id = static_cast<std::uint32_t>(i);
+        auto type = static_cast<VehicleType>(typeDist(gen));
+        double arrival = arrivalDist(gen);
+        trace.push_back({arrival, true, type, id});
+        trace.push_back({arrival + stayDist(gen), false, type, id});
+    }
+
+    return trace;
+}
+
+// CSV rows: time_hours,ARRIVE|DEPART,CAR|BIKE|TRUCK,vehicle_id
+std::vector<ParkingTraceEvent> ParkingSimulator::loadTrace(const std::string& csvPath) {
+    std::vector<ParkingTraceEvent> trace;
+    std::ifstream in(csvPath);
+    std::string line;
+
+    while(std::getline(in, line)) {
+        if(line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::stringstream ss(line);
+        std::string time, kind, type, id;
+        if(!std::getline(ss, time, ',') || !std::getline(ss, kind, ',') ||
+           !std::getline(ss, type, ',') || !std::getline(ss, id, ',')) {
+            continue;
+        }
+
+        try {
+            trace.push_back({std::stod(time), kind == "ARRIVE", parseVehicleType(type), static_cast<std::uint32_t>(std::stoul(id))});
+        } catch(const std::exception&) {
+            continue; // header or malformed row
+        }
+    }
+
+    return trace;
+}
+
+SimulationResult ParkingSimulator::run(std::vector<ParkingTraceEvent> trace) {
+    SimulationResult result;
+
+    // departures sort before arrivals at the same instant so a freed slot can be reused
+    std::stable_sort(trace.begin(), trace.end(), [](const ParkingTraceEvent& a, const ParkingTraceEvent& b) {
+        if(a.time != b.time) return a.time < b.time;
+        return !a.arrival && b.arrival;
+    });
+
+    std::uint32_t maxId = 0;
+    for(const auto &e: trace) {
+        maxId = std::max(maxId, e.vehicleId);
+    }
+
+    // vehicles are built up front so the replay loop only touches the lot
+    std::vector<std::shared_ptr<Vehicle>> vehicles(trace.empty() ? 0 : maxId + 1);
+    std::vector<std::string> licenses(vehicles.size());
+    // trace times may be negative (relative to some reference), so "not parked" is its own state
+    std::vector<std::optional<double>> arrivalTime(vehicles.size());
+    for(const auto &e: trace) {
+        if(e.arrival && !vehicles[e.vehicleId]) {
+            vehicles[e.vehicleId] = makeSimVehicle(e.type, e.vehicleId);
+            licenses[e.vehicleId] = vehicles[e.vehicleId]->getLicenseNumber();
+        }
+    }
+
+    std::vector<double> revenue(strategies.size(), 0.0);
+    double nextSample = trace.empty() ? 0.0 : trace.front().time;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for(const auto &e: trace) {
+        while(sampleInterval > 0 && nextSample <= e.time) {
+            result.occupancy.push_back({nextSample, lot.getOccupiedSlotsByLevel()});
+            nextSample += sampleInterval;
+        }
+
+        if(e.arrival) {
+            result.arrivals++;
+            if(!arrivalTime[e.vehicleId] && lot.parkVehicle(vehicles[e.vehicleId])) {
+                arrivalTime[e.vehicleId] = e.time;
+            } else {
+                result.rejected++;
+            }
+            continue;
+        }
+
+        if(e.vehicleId >= arrivalTime.size() || !arrivalTime[e.vehicleId]) {
+            continue; // never got a slot
+        }
+
+        double hours = e.time - *arrivalTime[e.vehicleId];
+        for(std::size_t i = 0; i < strategies.size(); i++) {
+            revenue[i] += strategies[i].second->calculatePrice(*vehicles[e.vehicleId], hours);
+        }
+
+        lot.unParkVehicle(licenses[e.vehicleId]);
+        arrivalTime[e.vehicleId].reset();
+        result.departures++;
+    }
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if(elapsed > 0) {
+        result.eventsPerSecond = trace.size() / elapsed;
+    }
+
+    // leave the lot as we found it
+    for(std::size_t id = 0; id < arrivalTime.size(); id++) {
+        if(arrivalTime[id]) {
+            lot.unParkVehicle(licenses[id]);
+        }
+    }
+
+    for(std::size_t i = 0; i < strategies.size(); i++) {
+        result.revenue.push_back({strategies[i].first, revenue[i]});
+    }
+
+    return result;
+}
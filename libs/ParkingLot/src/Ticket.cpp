@@ -3,6 +3,8 @@
 
 Ticket::Ticket(std::string id, std::string license): ticketId(id), licenseNumber(std::move(license)), entryTime(std::chrono::system_clock::now()), amount(0.0), isPaid(false) {}
 
+Ticket::Ticket(std::string id, std::string license, std::chrono::system_clock::time_point entry): ticketId(std::move(id)), licenseNumber(std::move(license)), entryTime(entry), amount(0.0), isPaid(false) {}
+
 void Ticket::setExitTime() {
     exitTime = std::chrono::system_clock::now();
 }
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Money.hpp"
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Running balances of one group, kept up to date entry by entry. Each expense or
+// settlement posts its balance changes under its own ID; posting the same ID again
+// first takes back what it posted before, so creating, editing or deleting an entry
+// costs O(users in the entry) and reading a balance never replays history.
+//
+// Balances are kept for every user an entry touches, member or not; the group
+// decides whose balances it reports. Amounts are whole cents, so taking a posting
+// back restores the balance exactly and every balance is the exact sum of its
+// postings. The ledger does not force them to sum to zero: an expense posts its
+// full amount for the payer but only the shares it has split, so an unassigned
+// remainder shows up as a non-zero total (see Group::isBalanced).
+class BalanceLedger {
+public:
+    using Delta = std::pair<std::string, Money>; // userId, change to their balance
+
+private:
+    std::unordered_map<std::string, size_t> accountIndex;
+    std::vector<std::string> accounts;
+    std::vector<Money> balances;
+    std::unordered_map<std::string, std::vector<std::pair<size_t, Money>>> postings;
+
+    size_t accountOf(const std::string& userId);
+
+public:
+    // Replaces the entry's previous posting; an empty list just removes it
+    void post(const std::string& entryId, const std::vector<Delta>& deltas);
+    bool unpost(const std::string& entryId);
+    bool hasPosting(const std::string& entryId) const;
+    size_t getPostingCount() const { return postings.size(); }
+
+    Money getBalance(const std::string& userId) const;
+    void clear();
+};
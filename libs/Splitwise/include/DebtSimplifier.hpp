@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// One payment in a settlement plan: `from` pays `to` an amount in cents.
+// Members are positions in the balance vector the plan was made for.
+struct Transfer {
+    size_t from;
+    size_t to;
+    std::int64_t cents;
+};
+
+// Turns net balances (in cents, positive = is owed, summing to zero) into a list
+// of payments that clears them all.
+//
+// Greedy: repeatedly pays the largest debtor to the largest creditor using two
+// max-heaps. Every payment clears at least one of them, so it needs at most
+// (n - 1) payments for n non-zero balances, in O(n log n).
+//
+// Exact: the fewest payments possible. If the members split into k groups that
+// each sum to zero, every group can settle on its own in (size - 1) payments, so
+// the minimum is n - k for the largest such k. The largest k is found by dynamic
+// programming over subsets, O(2^n * n), so it is only used for small groups.
+class DebtSimplifier {
+public:
+    static const size_t DEFAULT_EXACT_LIMIT = 16;
+
+    // Exact when at most `exactLimit` balances are non-zero, greedy otherwise
+    static std::vector<Transfer> simplify(const std::vector<std::int64_t>& balances,
+                                          size_t exactLimit = DEFAULT_EXACT_LIMIT);
+    static std::vector<Transfer> settleGreedy(const std::vector<std::int64_t>& balances);
+    static std::vector<Transfer> settleExact(const std::vector<std::int64_t>& balances);
+
+private:
+    // Greedy over the listed members only
+    static void settleMembers(const std::vector<std::int64_t>& balances, const std::vector<size_t>& members,
+                              std::vector<Transfer>& transfers);
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "DebtSimplifier.hpp"
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+struct DebtBenchmarkConfig {
+    std::vector<size_t> memberCounts = {10, 16, 20, 1000, 10000};
+    size_t exactMaxMembers = 20;           // Larger groups are timed with greedy only
+    std::int64_t balanceRange = 2000;      // Balances are whole units in [-range/2, range/2)
+    size_t crossCheckCases = 3000;
+    size_t crossCheckMaxMembers = 10;      // Brute force is exponential
+    unsigned seed = 7;
+};
+
+struct DebtBenchmarkRow {
+    size_t members = 0;
+    std::uint64_t pairwiseEntries = 0;     // Debtor x creditor pairs the old summary listed
+    size_t greedyPayments = 0;
+    double greedyMicros = 0.0;
+    bool exactRun = false;
+    size_t exactPayments = 0;
+    double exactMicros = 0.0;
+};
+
+struct DebtBenchmarkReport {
+    std::vector<DebtBenchmarkRow> rows;
+    size_t crossCheckCases = 0;
+    size_t crossCheckMismatches = 0;       // settleExact payment count differs from brute force
+    size_t invalidPlans = 0;               // A plan that does not clear every balance
+    size_t greedyBeatExact = 0;            // Greedy used fewer payments than settleExact
+    bool consistent = true;
+};
+
+// Reproduces the README's debt simplification table and cross-checks
+// DebtSimplifier::settleExact against a brute-force search for the most zero-sum
+// groups on small random groups. Every plan produced is checked to clear all
+// balances with positive payments.
+class DebtSimplifierBenchmark {
+private:
+    DebtBenchmarkConfig config;
+
+    static std::vector<std::int64_t> randomBalances(size_t members, std::int64_t range, std::mt19937& rng);
+    static bool clears(std::vector<std::int64_t> balances, const std::vector<Transfer>& transfers);
+
+public:
+    explicit DebtSimplifierBenchmark(const DebtBenchmarkConfig& config);
+
+    DebtBenchmarkReport run();
+
+    // Fewest payments for the balances, by trying every zero-sum partition
+    static size_t bruteForceMinimum(const std::vector<std::int64_t>& balances);
+
+    static void printReport(const std::string& label, const DebtBenchmarkReport& report);
+};
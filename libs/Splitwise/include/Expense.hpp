@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Money.hpp"
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -27,20 +29,24 @@ enum class PaymentMethod {
 
 struct SplitDetail {
     std::string userId;
-    double amount;
+    Money amount;
     double percentage;
     int shares;
     bool isPaid;
     
-    SplitDetail(const std::string& uid, double amt, double pct = 0.0, int shr = 1, bool paid = false)
+    SplitDetail(const std::string& uid, Money amt, double pct = 0.0, int shr = 1, bool paid = false)
         : userId(uid), amount(amt), percentage(pct), shares(shr), isPaid(paid) {}
 };
 
 class Expense {
+public:
+    // Called after every change to the amount or the splits
+    using ChangeListener = std::function<void(const Expense&)>;
+
 private:
     std::string expenseId;
     std::string description;
-    double amount;
+    Money amount;
     std::string paidBy;
     std::string groupId;
     ExpenseCategory category;
@@ -53,9 +59,14 @@ private:
     std::string receiptImage;
     std::string notes;
     bool isSettled;
+    ChangeListener changeListener;
+
+    void notifyChange() const;
+    // Writable split; callers that change an amount must notifyChange()
+    SplitDetail* getSplitForUser(const std::string& userId);
 
 public:
-    Expense(const std::string& expenseId, const std::string& description, double amount,
+    Expense(const std::string& expenseId, const std::string& description, Money amount,
             const std::string& paidBy, const std::string& groupId,
             ExpenseCategory category = ExpenseCategory::OTHER,
             PaymentMethod paymentMethod = PaymentMethod::CASH,
@@ -64,7 +75,7 @@ public:
     // Getters
     std::string getExpenseId() const { return expenseId; }
     std::string getDescription() const { return description; }
-    double getAmount() const { return amount; }
+    Money getAmount() const { return amount; }
     std::string getPaidBy() const { return paidBy; }
     std::string getGroupId() const { return groupId; }
     ExpenseCategory getCategory() const { return category; }
@@ -80,7 +91,7 @@ public:
 
     // Setters
     void setDescription(const std::string& desc) { description = desc; }
-    void setAmount(double amt) { amount = amt; }
+    void setAmount(Money amt) { amount = amt; notifyChange(); }
     void setCategory(ExpenseCategory cat) { category = cat; }
     void setPaymentMethod(PaymentMethod method) { paymentMethod = method; }
     void setCurrency(const std::string& curr) { currency = curr; }
@@ -88,17 +99,18 @@ public:
     void setReceiptImage(const std::string& image) { receiptImage = image; }
     void setNotes(const std::string& expenseNotes) { notes = expenseNotes; }
     void setIsSettled(bool settled) { isSettled = settled; }
+    void setChangeListener(ChangeListener listener) { changeListener = std::move(listener); }
 
     // Split management
     void addSplit(const SplitDetail& split);
     void removeSplit(const std::string& userId);
-    void updateSplit(const std::string& userId, double amount, double percentage = 0.0, int shares = 1);
-    SplitDetail* getSplitForUser(const std::string& userId);
+    void updateSplit(const std::string& userId, Money amount, double percentage = 0.0, int shares = 1);
     const SplitDetail* getSplitForUser(const std::string& userId) const;
-    double getAmountForUser(const std::string& userId) const;
+    Money getAmountForUser(const std::string& userId) const;
     bool hasUserSplit(const std::string& userId) const;
 
-    // Split calculation methods
+    // Split calculation methods. Shares are allocated in whole cents and always add up
+    // to the expense amount; see Money::allocate for how leftover cents are assigned.
     void splitEqually(const std::vector<std::string>& userIds);
     void splitByPercentage(const std::vector<std::string>& userIds, const std::vector<double>& percentages);
     void splitByShares(const std::vector<std::string>& userIds, const std::vector<int>& shares);
@@ -107,7 +119,7 @@ public:
     // Utility methods
     std::string getCategoryString() const;
     std::string getPaymentMethodString() const;
-    double getTotalSplitAmount() const;
+    Money getTotalSplitAmount() const;
     bool isFullySplit() const;
     std::vector<std::string> getInvolvedUsers() const;
     void markAsPaid(const std::string& userId);
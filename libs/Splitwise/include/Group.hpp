@@ -1,5 +1,6 @@
 #pragma once
 
+#include "BalanceLedger.hpp"
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -28,8 +29,10 @@ private:
     std::string createdBy;
     GroupType type;
     std::vector<std::string> memberIds;
-    std::unordered_map<std::string, double> memberBalances;
+    BalanceLedger ledger;
+    std::vector<BalanceLedger::Delta> adjustments; // Manual changes, each posted as its own entry
     std::vector<std::string> expenseIds;
+    std::vector<std::string> settlementIds;
     std::string currency;
     std::string createdAt;
     std::string updatedAt;
@@ -48,8 +51,9 @@ public:
     std::string getCreatedBy() const { return createdBy; }
     GroupType getType() const { return type; }
     std::vector<std::string> getMemberIds() const { return memberIds; }
-    std::unordered_map<std::string, double> getMemberBalances() const { return memberBalances; }
+    std::unordered_map<std::string, Money> getMemberBalances() const;
     std::vector<std::string> getExpenseIds() const { return expenseIds; }
+    std::vector<std::string> getSettlementIds() const { return settlementIds; }
     std::string getCurrency() const { return currency; }
     std::string getCreatedAt() const { return createdAt; }
     std::string getUpdatedAt() const { return updatedAt; }
@@ -70,10 +74,18 @@ public:
     bool hasMember(const std::string& userId) const;
     int getMemberCount() const { return memberIds.size(); }
 
-    // Balance management
-    void updateMemberBalance(const std::string& userId, double amount);
-    double getMemberBalance(const std::string& userId) const;
-    double getTotalGroupBalance() const;
+    // Balance management: expenses and settlements post their balance changes to the
+    // ledger as they change, so reading a balance is a lookup rather than a recomputation
+    void postEntry(const std::string& entryId, const std::vector<BalanceLedger::Delta>& deltas);
+    bool unpostEntry(const std::string& entryId);
+    bool hasPostedEntry(const std::string& entryId) const { return ledger.hasPosting(entryId); }
+    // A manual correction is posted as an entry of its own ("ADJ1", "ADJ2", ...) and
+    // kept, so rebuilding or verifying the ledger replays it like any other entry
+    void updateMemberBalance(const std::string& userId, Money amount);
+    const std::vector<BalanceLedger::Delta>& getAdjustments() const { return adjustments; }
+    static std::string adjustmentEntryId(size_t index);
+    Money getMemberBalance(const std::string& userId) const;
+    Money getTotalGroupBalance() const;
     void resetAllBalances();
 
     // Expense management
@@ -82,6 +94,11 @@ public:
     bool hasExpense(const std::string& expenseId) const;
     int getExpenseCount() const { return expenseIds.size(); }
 
+    // Settlement management
+    void addSettlement(const std::string& settlementId);
+    void removeSettlement(const std::string& settlementId);
+    bool hasSettlement(const std::string& settlementId) const;
+
     // Utility methods
     std::string getTypeString() const;
     std::vector<std::string> getDebtors() const;
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// An amount of money as a whole number of minor units (cents). Sums and differences
+// are exact, so balances that should cancel come out exactly zero however many
+// entries a group accumulates. Converting from a double rounds to the nearest cent
+// and splitting an amount rounds each share; nothing else rounds.
+class Money {
+private:
+    std::int64_t cents;
+
+    explicit constexpr Money(std::int64_t cents) : cents(cents) {}
+
+public:
+    static const std::int64_t CENTS_PER_UNIT = 100;
+
+    constexpr Money() : cents(0) {}
+
+    static constexpr Money fromCents(std::int64_t cents) { return Money(cents); }
+    // Nearest cent to the binary value of `amount`, halves away from zero. Decimal
+    // text that is not exact in binary may round the other way: 0.285 is stored as
+    // 0.28499999..., so it becomes 0.28.
+    static Money fromDouble(double amount);
+
+    std::int64_t getCents() const { return cents; }
+    double toDouble() const { return static_cast<double>(cents) / CENTS_PER_UNIT; }
+    std::string toString() const; // "-12.05"
+
+    bool isZero() const { return cents == 0; }
+    bool isPositive() const { return cents > 0; }
+    bool isNegative() const { return cents < 0; }
+    Money abs() const { return Money(cents < 0 ? -cents : cents); }
+
+    // Split into one part per weight, in proportion to the weights, so the parts add
+    // up to exactly this amount. Each part is rounded down and the leftover cents go
+    // to the parts that lost the most to rounding (largest remainder); ties go to the
+    // earlier part, so the same inputs always give the same split. The weights must
+    // add up to at most 2^63 - 1; products are worked out exactly in 64-bit arithmetic.
+    std::vector<Money> allocate(const std::vector<std::int64_t>& weights) const;
+
+    Money operator-() const { return Money(-cents); }
+    Money& operator+=(Money other) { cents += other.cents; return *this; }
+    Money& operator-=(Money other) { cents -= other.cents; return *this; }
+    friend Money operator+(Money a, Money b) { return a += b; }
+    friend Money operator-(Money a, Money b) { return a -= b; }
+
+    friend bool operator==(Money a, Money b) { return a.cents == b.cents; }
+    friend bool operator!=(Money a, Money b) { return a.cents != b.cents; }
+    friend bool operator<(Money a, Money b) { return a.cents < b.cents; }
+    friend bool operator>(Money a, Money b) { return a.cents > b.cents; }
+    friend bool operator<=(Money a, Money b) { return a.cents <= b.cents; }
+    friend bool operator>=(Money a, Money b) { return a.cents >= b.cents; }
+};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Money.hpp"
+#include <functional>
 #include <string>
 
 enum class SettlementStatus {
@@ -18,12 +20,16 @@ enum class SettlementMethod {
 };
 
 class Settlement {
+public:
+    // Called after every change to the amount or the status
+    using ChangeListener = std::function<void(const Settlement&)>;
+
 private:
     std::string settlementId;
     std::string fromUserId;
     std::string toUserId;
     std::string groupId;
-    double amount;
+    Money amount;
     std::string currency;
     SettlementStatus status;
     SettlementMethod method;
@@ -33,10 +39,13 @@ private:
     std::string completedAt;
     std::string notes;
     std::string transactionReference;
+    ChangeListener changeListener;
+
+    void notifyChange() const;
 
 public:
     Settlement(const std::string& settlementId, const std::string& fromUserId,
-               const std::string& toUserId, const std::string& groupId, double amount,
+               const std::string& toUserId, const std::string& groupId, Money amount,
                const std::string& currency = "USD", SettlementMethod method = SettlementMethod::CASH,
                const std::string& description = "");
 
@@ -45,7 +54,7 @@ public:
     std::string getFromUserId() const { return fromUserId; }
     std::string getToUserId() const { return toUserId; }
     std::string getGroupId() const { return groupId; }
-    double getAmount() const { return amount; }
+    Money getAmount() const { return amount; }
     std::string getCurrency() const { return currency; }
     SettlementStatus getStatus() const { return status; }
     SettlementMethod getMethod() const { return method; }
@@ -57,13 +66,14 @@ public:
     std::string getTransactionReference() const { return transactionReference; }
 
     // Setters
-    void setAmount(double amt) { amount = amt; }
-    void setStatus(SettlementStatus newStatus) { status = newStatus; }
+    void setAmount(Money amt) { amount = amt; notifyChange(); }
+    void setStatus(SettlementStatus newStatus) { status = newStatus; notifyChange(); }
     void setMethod(SettlementMethod newMethod) { method = newMethod; }
     void setDescription(const std::string& desc) { description = desc; }
     void setDate(const std::string& settlementDate) { date = settlementDate; }
     void setNotes(const std::string& settlementNotes) { notes = settlementNotes; }
     void setTransactionReference(const std::string& ref) { transactionReference = ref; }
+    void setChangeListener(ChangeListener listener) { changeListener = std::move(listener); }
 
     // Status management
     void markAsCompleted();
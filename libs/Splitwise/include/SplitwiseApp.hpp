@@ -4,6 +4,7 @@
 #include "Group.hpp"
 #include "Expense.hpp"
 #include "Settlement.hpp"
+#include "DebtSimplifier.hpp"
 #include <unordered_map>
 #include <vector>
 #include <memory>
@@ -12,24 +13,24 @@
 struct DebtSummary {
     std::string fromUserId;
     std::string toUserId;
-    double amount;
+    Money amount;
     std::string currency;
     
-    DebtSummary(const std::string& from, const std::string& to, double amt, const std::string& curr = "USD")
+    DebtSummary(const std::string& from, const std::string& to, Money amt, const std::string& curr = "USD")
         : fromUserId(from), toUserId(to), amount(amt), currency(curr) {}
 };
 
 struct GroupSummary {
     std::string groupId;
     std::string groupName;
-    double totalExpenses;
-    double totalSettlements;
-    double netBalance;
+    Money totalExpenses;
+    Money totalSettlements;
+    Money netBalance;
     int memberCount;
     int expenseCount;
     
-    GroupSummary(const std::string& id, const std::string& name, double expenses = 0.0, 
-                 double settlements = 0.0, double balance = 0.0, int members = 0, int expenses_count = 0)
+    GroupSummary(const std::string& id, const std::string& name, Money expenses = Money(), 
+                 Money settlements = Money(), Money balance = Money(), int members = 0, int expenses_count = 0)
         : groupId(id), groupName(name), totalExpenses(expenses), totalSettlements(settlements),
           netBalance(balance), memberCount(members), expenseCount(expenses_count) {}
 };
@@ -48,10 +49,22 @@ private:
     int nextGroupId;
     int nextExpenseId;
     int nextSettlementId;
+    bool consistencyChecks;
+
+    // Keep the group ledger in step with an expense or settlement
+    void postExpense(const Expense& expense);
+    void postSettlement(const Settlement& settlement);
+    void checkBalances(const std::string& groupId);
+    std::vector<DebtSummary> settleGroup(const std::string& groupId, size_t exactLimit);
 
 public:
     SplitwiseApp(const std::string& name = "Splitwise", const std::string& ver = "1.0.0",
                  const std::string& defaultCurr = "USD");
+    ~SplitwiseApp();
+
+    // Expenses and settlements report their changes back to the app that created them
+    SplitwiseApp(const SplitwiseApp&) = delete;
+    SplitwiseApp& operator=(const SplitwiseApp&) = delete;
 
     // User management
     std::shared_ptr<User> createUser(const std::string& name, const std::string& email,
@@ -72,7 +85,7 @@ public:
     bool removeUserFromGroup(const std::string& userId, const std::string& groupId);
 
     // Expense management
-    std::shared_ptr<Expense> createExpense(const std::string& description, double amount,
+    std::shared_ptr<Expense> createExpense(const std::string& description, Money amount,
                                           const std::string& paidBy, const std::string& groupId,
                                           ExpenseCategory category = ExpenseCategory::OTHER);
     std::shared_ptr<Expense> findExpense(const std::string& expenseId);
@@ -84,27 +97,34 @@ public:
     // Settlement management
     std::shared_ptr<Settlement> createSettlement(const std::string& fromUserId,
                                                  const std::string& toUserId, const std::string& groupId,
-                                                 double amount, SettlementMethod method = SettlementMethod::CASH);
+                                                 Money amount, SettlementMethod method = SettlementMethod::CASH);
     std::shared_ptr<Settlement> findSettlement(const std::string& settlementId);
     bool deleteSettlement(const std::string& settlementId);
     std::vector<std::shared_ptr<Settlement>> getSettlementsForGroup(const std::string& groupId);
     std::vector<std::shared_ptr<Settlement>> getSettlementsForUser(const std::string& userId);
     bool completeSettlement(const std::string& settlementId);
 
-    // Balance and debt management
+    // Balance and debt management. Balances are maintained as expenses and settlements
+    // change; calculateBalances rebuilds a group's ledger from its history.
     void calculateBalances(const std::string& groupId);
+    bool verifyBalances(const std::string& groupId);
+    void setConsistencyChecks(bool enabled) { consistencyChecks = enabled; } // Verify on every balance query
+    bool getConsistencyChecks() const { return consistencyChecks; }
+    // Who pays whom to clear the group: greedy, at most (members - 1) payments
     std::vector<DebtSummary> getDebtSummary(const std::string& groupId);
     std::vector<DebtSummary> getDebtSummaryForUser(const std::string& userId);
-    double getUserBalance(const std::string& userId, const std::string& groupId);
-    double getTotalUserBalance(const std::string& userId);
-    std::vector<std::string> getSimplifiedDebts(const std::string& groupId);
+    Money getUserBalance(const std::string& userId, const std::string& groupId);
+    Money getTotalUserBalance(const std::string& userId);
+    // Fewest payments that clear the group; exact up to DebtSimplifier::DEFAULT_EXACT_LIMIT
+    // members with a balance, greedy beyond that
+    std::vector<DebtSummary> getSimplifiedDebts(const std::string& groupId);
 
     // Reporting and analytics
     GroupSummary getGroupSummary(const std::string& groupId);
     std::vector<GroupSummary> getAllGroupSummaries();
     std::vector<std::shared_ptr<Expense>> getTopExpenses(const std::string& groupId, int limit = 10);
-    std::unordered_map<ExpenseCategory, double> getExpenseBreakdown(const std::string& groupId);
-    std::vector<std::pair<std::string, double>> getTopSpenders(const std::string& groupId, int limit = 5);
+    std::unordered_map<ExpenseCategory, Money> getExpenseBreakdown(const std::string& groupId);
+    std::vector<std::pair<std::string, Money>> getTopSpenders(const std::string& groupId, int limit = 5);
 
     // Utility methods
     std::string generateUserId();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Money.hpp"
 #include <string>
 #include <vector>
 
@@ -29,7 +30,7 @@ private:
     std::string profilePicture;
     UserStatus status;
     Currency preferredCurrency;
-    double totalBalance;
+    Money totalBalance;
     std::vector<std::string> groupIds;
     std::vector<std::string> friendIds;
     std::string createdAt;
@@ -48,7 +49,7 @@ public:
     std::string getProfilePicture() const { return profilePicture; }
     UserStatus getStatus() const { return status; }
     Currency getPreferredCurrency() const { return preferredCurrency; }
-    double getTotalBalance() const { return totalBalance; }
+    Money getTotalBalance() const { return totalBalance; }
     std::vector<std::string> getGroupIds() const { return groupIds; }
     std::vector<std::string> getFriendIds() const { return friendIds; }
     std::string getCreatedAt() const { return createdAt; }
@@ -61,7 +62,7 @@ public:
     void setProfilePicture(const std::string& picture) { profilePicture = picture; }
     void setStatus(UserStatus newStatus) { status = newStatus; }
     void setPreferredCurrency(Currency currency) { preferredCurrency = currency; }
-    void setTotalBalance(double balance) { totalBalance = balance; }
+    void setTotalBalance(Money balance) { totalBalance = balance; }
     void setLastActive(const std::string& timestamp) { lastActive = timestamp; }
 
     // Utility methods
@@ -71,7 +72,7 @@ public:
     void removeFriend(const std::string& friendId);
     bool isInGroup(const std::string& groupId) const;
     bool isFriend(const std::string& friendId) const;
-    void updateBalance(double amount);
+    void updateBalance(Money amount);
     std::string getStatusString() const;
     std::string getCurrencyString() const;
     bool isActive() const { return status == UserStatus::ACTIVE; }
@@ -0,0 +1,52 @@
+#include "../include/BalanceLedger.hpp"
+
+size_t BalanceLedger::accountOf(const std::string& userId) {
+    auto it = accountIndex.find(userId);
+    if (it != accountIndex.end()) {
+        return it->second;
+    }
+    accountIndex[userId] = accounts.size();
+    accounts.push_back(userId);
+    balances.emplace_back();
+    return accounts.size() - 1;
+}
+
+void BalanceLedger::post(const std::string& entryId, const std::vector<Delta>& deltas) {
+    unpost(entryId);
+    if (deltas.empty()) return;
+
+    std::vector<std::pair<size_t, Money>>& posting = postings[entryId];
+    posting.reserve(deltas.size());
+    for (const auto& delta : deltas) {
+        size_t account = accountOf(delta.first);
+        balances[account] += delta.second;
+        posting.emplace_back(account, delta.second);
+    }
+}
+
+bool BalanceLedger::unpost(const std::string& entryId) {
+    auto it = postings.find(entryId);
+    if (it == postings.end()) return false;
+
+    for (const auto& change : it->second) {
+        balances[change.first] -= change.second;
+    }
+    postings.erase(it);
+    return true;
+}
+
+bool BalanceLedger::hasPosting(const std::string& entryId) const {
+    return postings.find(entryId) != postings.end();
+}
+
+Money BalanceLedger::getBalance(const std::string& userId) const {
+    auto it = accountIndex.find(userId);
+    return (it != accountIndex.end()) ? balances[it->second] : Money();
+}
+
+void BalanceLedger::clear() {
+    accountIndex.clear();
+    accounts.clear();
+    balances.clear();
+    postings.clear();
+}
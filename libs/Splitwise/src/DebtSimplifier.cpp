@@ -0,0 +1,103 @@
+#include "../include/DebtSimplifier.hpp"
+#include <algorithm>
+#include <queue>
+#include <utility>
+
+namespace {
+    // Subset tables take 9 bytes per subset: 9 MB at 20 members, 2.3 GB at 28
+    const size_t MAX_EXACT_MEMBERS = 20;
+}
+
+std::vector<Transfer> DebtSimplifier::simplify(const std::vector<std::int64_t>& balances, size_t exactLimit) {
+    size_t nonZero = std::count_if(balances.begin(), balances.end(), [](std::int64_t cents) { return cents != 0; });
+    return nonZero <= exactLimit ? settleExact(balances) : settleGreedy(balances);
+}
+
+void DebtSimplifier::settleMembers(const std::vector<std::int64_t>& balances, const std::vector<size_t>& members,
+                                   std::vector<Transfer>& transfers) {
+    // (amount, member) so ties break the same way on every run
+    std::priority_queue<std::pair<std::int64_t, size_t>> creditors;
+    std::priority_queue<std::pair<std::int64_t, size_t>> debtors;
+    for (size_t member : members) {
+        if (balances[member] > 0) {
+            creditors.emplace(balances[member], member);
+        } else if (balances[member] < 0) {
+            debtors.emplace(-balances[member], member);
+        }
+    }
+
+    while (!creditors.empty() && !debtors.empty()) {
+        auto creditor = creditors.top();
+        auto debtor = debtors.top();
+        creditors.pop();
+        debtors.pop();
+
+        std::int64_t cents = std::min(creditor.first, debtor.first);
+        transfers.push_back({debtor.second, creditor.second, cents});
+        if (creditor.first > cents) {
+            creditors.emplace(creditor.first - cents, creditor.second);
+        }
+        if (debtor.first > cents) {
+            debtors.emplace(debtor.first - cents, debtor.second);
+        }
+    }
+}
+
+std::vector<Transfer> DebtSimplifier::settleGreedy(const std::vector<std::int64_t>& balances) {
+    std::vector<size_t> members(balances.size());
+    for (size_t i = 0; i < members.size(); ++i) {
+        members[i] = i;
+    }
+    std::vector<Transfer> transfers;
+    settleMembers(balances, members, transfers);
+    return transfers;
+}
+
+std::vector<Transfer> DebtSimplifier::settleExact(const std::vector<std::int64_t>& balances) {
+    std::vector<size_t> members;
+    for (size_t i = 0; i < balances.size(); ++i) {
+        if (balances[i] != 0) {
+            members.push_back(i);
+        }
+    }
+    if (members.empty()) return {};
+    if (members.size() > MAX_EXACT_MEMBERS) return settleGreedy(balances);
+
+    // sums[s]: total balance of subset s. groups[s]: most zero-sum groups s can be
+    // cut into, counting s itself when it sums to zero (the standard subset DP).
+    const std::uint32_t full = (1u << members.size()) - 1;
+    std::vector<std::int64_t> sums(full + 1, 0);
+    std::vector<std::uint8_t> groups(full + 1, 0);
+    for (std::uint32_t subset = 1; subset <= full; ++subset) {
+        std::uint32_t lowest = subset & (~subset + 1);
+        sums[subset] = sums[subset ^ lowest] + balances[members[__builtin_ctz(subset)]];
+
+        std::uint8_t best = 0;
+        for (std::uint32_t rest = subset; rest; rest &= rest - 1) {
+            best = std::max(best, groups[subset ^ (rest & (~rest + 1))]);
+        }
+        groups[subset] = best + (sums[subset] == 0 ? 1 : 0);
+    }
+
+    // Peel members off along an optimal path; the members removed between two
+    // zero-sum subsets form one group, which settles on its own
+    std::vector<Transfer> transfers;
+    std::vector<size_t> group;
+    std::uint32_t subset = full;
+    while (subset) {
+        std::uint8_t closes = sums[subset] == 0 ? 1 : 0;
+        for (std::uint32_t rest = subset; rest; rest &= rest - 1) {
+            std::uint32_t bit = rest & (~rest + 1);
+            if (groups[subset ^ bit] + closes == groups[subset]) {
+                group.push_back(members[__builtin_ctz(bit)]);
+                subset ^= bit;
+                break;
+            }
+        }
+        if (sums[subset] == 0) {
+            settleMembers(balances, group, transfers);
+            group.clear();
+        }
+    }
+    return transfers;
+}
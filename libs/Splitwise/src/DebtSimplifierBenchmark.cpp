@@ -0,0 +1,159 @@
+#include "../include/DebtSimplifierBenchmark.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+namespace {
+    // Most groups the values split into that each sum to zero. Tries every zero-sum
+    // subset holding the first value, then recurses on the rest.
+    size_t maxZeroSumGroups(const std::vector<std::int64_t>& values) {
+        if (values.empty()) return 0;
+
+        size_t count = values.size();
+        size_t best = 0;
+        for (size_t mask = 1; mask < (size_t(1) << count); mask += 2) {
+            std::int64_t sum = 0;
+            for (size_t i = 0; i < count; ++i) {
+                if (mask >> i & 1) sum += values[i];
+            }
+            if (sum != 0) continue;
+
+            std::vector<std::int64_t> rest;
+            for (size_t i = 0; i < count; ++i) {
+                if (!(mask >> i & 1)) rest.push_back(values[i]);
+            }
+            best = std::max(best, 1 + maxZeroSumGroups(rest));
+        }
+        return best;
+    }
+
+    double microsPerRun(std::chrono::steady_clock::time_point start, int runs) {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / runs;
+    }
+
+    std::string formatMicros(double micros) {
+        std::ostringstream out;
+        out << std::fixed;
+        if (micros >= 1000.0) {
+            out << std::setprecision(micros >= 10000.0 ? 0 : 1) << micros / 1000.0 << " ms";
+        } else {
+            out << std::setprecision(micros >= 10.0 ? 0 : 1) << micros << " µs";
+        }
+        return out.str();
+    }
+}
+
+DebtSimplifierBenchmark::DebtSimplifierBenchmark(const DebtBenchmarkConfig& config) : config(config) {
+    this->config.balanceRange = std::max<std::int64_t>(2, config.balanceRange);
+    this->config.crossCheckMaxMembers = std::max<size_t>(2, std::min<size_t>(config.crossCheckMaxMembers, 16));
+}
+
+std::vector<std::int64_t> DebtSimplifierBenchmark::randomBalances(size_t members, std::int64_t range, std::mt19937& rng) {
+    // Whole units, so small groups often contain subsets that cancel
+    std::vector<std::int64_t> balances(members);
+    std::int64_t sum = 0;
+    for (size_t i = 0; i + 1 < members; ++i) {
+        balances[i] = (static_cast<std::int64_t>(rng() % range) - range / 2) * 100;
+        sum += balances[i];
+    }
+    if (members > 0) {
+        balances[members - 1] = -sum;
+    }
+    return balances;
+}
+
+bool DebtSimplifierBenchmark::clears(std::vector<std::int64_t> balances, const std::vector<Transfer>& transfers) {
+    for (const auto& transfer : transfers) {
+        if (transfer.cents <= 0 || transfer.from >= balances.size() || transfer.to >= balances.size()) {
+            return false;
+        }
+        balances[transfer.from] += transfer.cents;
+        balances[transfer.to] -= transfer.cents;
+    }
+    return std::all_of(balances.begin(), balances.end(), [](std::int64_t cents) { return cents == 0; });
+}
+
+size_t DebtSimplifierBenchmark::bruteForceMinimum(const std::vector<std::int64_t>& balances) {
+    std::vector<std::int64_t> nonZero;
+    for (std::int64_t cents : balances) {
+        if (cents != 0) nonZero.push_back(cents);
+    }
+    return nonZero.size() - maxZeroSumGroups(nonZero);
+}
+
+DebtBenchmarkReport DebtSimplifierBenchmark::run() {
+    DebtBenchmarkReport report;
+    std::mt19937 rng(config.seed);
+
+    // Small groups with few distinct values, so many have cancelling subsets
+    for (size_t c = 0; c < config.crossCheckCases; ++c) {
+        size_t members = 2 + rng() % (config.crossCheckMaxMembers - 1);
+        std::vector<std::int64_t> balances = randomBalances(members, 9, rng);
+        std::vector<Transfer> exact = DebtSimplifier::settleExact(balances);
+        std::vector<Transfer> greedy = DebtSimplifier::settleGreedy(balances);
+
+        if (!clears(balances, exact) || !clears(balances, greedy)) report.invalidPlans++;
+        if (exact.size() != bruteForceMinimum(balances)) report.crossCheckMismatches++;
+        if (greedy.size() < exact.size()) report.greedyBeatExact++;
+        report.crossCheckCases++;
+    }
+
+    for (size_t members : config.memberCounts) {
+        DebtBenchmarkRow row;
+        row.members = members;
+        std::vector<std::int64_t> balances = randomBalances(members, config.balanceRange, rng);
+        std::uint64_t debtors = 0, creditors = 0;
+        for (std::int64_t cents : balances) {
+            if (cents < 0) debtors++;
+            if (cents > 0) creditors++;
+        }
+        row.pairwiseEntries = debtors * creditors;
+
+        int runs = members <= 20 ? 5 : (members <= 1000 ? 50 : 5);
+        std::vector<Transfer> greedy;
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < runs; ++r) {
+            greedy = DebtSimplifier::settleGreedy(balances);
+        }
+        row.greedyMicros = microsPerRun(start, runs);
+        row.greedyPayments = greedy.size();
+        if (!clears(balances, greedy)) report.invalidPlans++;
+
+        if (members <= config.exactMaxMembers) {
+            std::vector<Transfer> exact;
+            start = std::chrono::steady_clock::now();
+            for (int r = 0; r < runs; ++r) {
+                exact = DebtSimplifier::settleExact(balances);
+            }
+            row.exactMicros = microsPerRun(start, runs);
+            row.exactPayments = exact.size();
+            row.exactRun = true;
+            if (!clears(balances, exact)) report.invalidPlans++;
+        }
+        report.rows.push_back(row);
+    }
+
+    report.consistent = report.crossCheckMismatches == 0 && report.invalidPlans == 0 && report.greedyBeatExact == 0;
+    return report;
+}
+
+void DebtSimplifierBenchmark::printReport(const std::string& label, const DebtBenchmarkReport& report) {
+    std::cout << "=== " << label << " ===" << std::endl;
+    std::cout << "| Members | Pairwise entries | Greedy payments | Greedy time | Exact payments | Exact time |" << std::endl;
+    std::cout << "|--------:|-----------------:|----------------:|------------:|---------------:|-----------:|" << std::endl;
+    for (const auto& row : report.rows) {
+        std::cout << "| " << row.members << " | " << row.pairwiseEntries << " | " << row.greedyPayments << " | "
+                  << formatMicros(row.greedyMicros) << " | ";
+        if (row.exactRun) {
+            std::cout << row.exactPayments << " | " << formatMicros(row.exactMicros) << " |" << std::endl;
+        } else {
+            std::cout << "– | – |" << std::endl;
+        }
+    }
+    std::cout << "Cross-check: " << report.crossCheckCases << " cases, " << report.crossCheckMismatches
+              << " differ from brute force, " << report.invalidPlans << " invalid plans, "
+              << report.greedyBeatExact << " where greedy beat exact" << std::endl;
+    std::cout << "Consistent: " << (report.consistent ? "yes" : "NO") << std::endl;
+}
@@ -1,11 +1,21 @@
 #include "../include/Expense.hpp"
 #include <algorithm>
+#include <cmath>
 #include <ctime>
 #include <sstream>
 #include <iomanip>
 #include <stdexcept>
 
-Expense::Expense(const std::string& expenseId, const std::string& description, double amount,
+namespace {
+    // Percentages become allocation weights in millionths of a percent
+    const double PERCENT_WEIGHT = 1e6;
+    const std::int64_t FULL_WEIGHT = 100 * 1000000LL;
+    // Percentages this close to 100 in total (0.0001%) split the whole amount, so
+    // thirds written as 33.3333 leave nothing unassigned
+    const std::int64_t FULL_WEIGHT_SLACK = 100;
+}
+
+Expense::Expense(const std::string& expenseId, const std::string& description, Money amount,
                  const std::string& paidBy, const std::string& groupId,
                  ExpenseCategory category, PaymentMethod paymentMethod, const std::string& currency)
     : expenseId(expenseId), description(description), amount(amount), paidBy(paidBy), groupId(groupId),
@@ -21,24 +31,35 @@ Expense::Expense(const std::string& expenseId, const std::string& description, d
     date = createdAt;
 }
 
+void Expense::notifyChange() const {
+    if (changeListener) {
+        changeListener(*this);
+    }
+}
+
 void Expense::addSplit(const SplitDetail& split) {
     // Remove existing split for this user if exists
-    removeSplit(split.userId);
+    splits.erase(std::remove_if(splits.begin(), splits.end(),
+                               [&split](const SplitDetail& existing) { return existing.userId == split.userId; }),
+                 splits.end());
     splits.push_back(split);
+    notifyChange();
 }
 
 void Expense::removeSplit(const std::string& userId) {
     splits.erase(std::remove_if(splits.begin(), splits.end(),
                                [&userId](const SplitDetail& split) { return split.userId == userId; }),
                  splits.end());
+    notifyChange();
 }
 
-void Expense::updateSplit(const std::string& userId, double amount, double percentage, int shares) {
+void Expense::updateSplit(const std::string& userId, Money amount, double percentage, int shares) {
     auto split = getSplitForUser(userId);
     if (split) {
         split->amount = amount;
         split->percentage = percentage;
         split->shares = shares;
+        notifyChange();
     }
 }
 
@@ -60,9 +81,9 @@ const SplitDetail* Expense::getSplitForUser(const std::string& userId) const {
     return nullptr;
 }
 
-double Expense::getAmountForUser(const std::string& userId) const {
+Money Expense::getAmountForUser(const std::string& userId) const {
     const auto* split = getSplitForUser(userId);
-    return split ? split->amount : 0.0;
+    return split ? split->amount : Money();
 }
 
 bool Expense::hasUserSplit(const std::string& userId) const {
@@ -73,11 +94,12 @@ void Expense::splitEqually(const std::vector<std::string>& userIds) {
     if (userIds.empty()) return;
     
     splits.clear();
-    double amountPerPerson = amount / userIds.size();
+    std::vector<Money> parts = amount.allocate(std::vector<std::int64_t>(userIds.size(), 1));
     
-    for (const auto& userId : userIds) {
-        splits.emplace_back(userId, amountPerPerson, 100.0 / userIds.size(), 1, false);
+    for (size_t i = 0; i < userIds.size(); ++i) {
+        splits.emplace_back(userIds[i], parts[i], 100.0 / userIds.size(), 1, false);
     }
+    notifyChange();
 }
 
 void Expense::splitByPercentage(const std::vector<std::string>& userIds, const std::vector<double>& percentages) {
@@ -85,11 +107,30 @@ void Expense::splitByPercentage(const std::vector<std::string>& userIds, const s
         throw std::invalid_argument("User IDs and percentages must have the same size");
     }
     
+    std::vector<std::int64_t> weights;
+    std::int64_t totalWeight = 0;
+    for (double percentage : percentages) {
+        if (!(percentage >= 0.0 && percentage <= 100.0)) {
+            throw std::invalid_argument("Percentages must be between 0 and 100");
+        }
+        weights.push_back(std::llround(percentage * PERCENT_WEIGHT));
+        totalWeight += weights.back();
+    }
+    if (totalWeight > FULL_WEIGHT + FULL_WEIGHT_SLACK) {
+        throw std::invalid_argument("Percentages add up to more than 100");
+    }
+    // Percentages short of 100 leave the rest of the amount unassigned, as one more
+    // part that nobody is given
+    if (totalWeight < FULL_WEIGHT - FULL_WEIGHT_SLACK) {
+        weights.push_back(FULL_WEIGHT - totalWeight);
+    }
+    std::vector<Money> parts = amount.allocate(weights);
+    
     splits.clear();
     for (size_t i = 0; i < userIds.size(); ++i) {
-        double userAmount = amount * (percentages[i] / 100.0);
-        splits.emplace_back(userIds[i], userAmount, percentages[i], 1, false);
+        splits.emplace_back(userIds[i], parts[i], percentages[i], 1, false);
     }
+    notifyChange();
 }
 
 void Expense::splitByShares(const std::vector<std::string>& userIds, const std::vector<int>& shares) {
@@ -97,20 +138,20 @@ void Expense::splitByShares(const std::vector<std::string>& userIds, const std::
         throw std::invalid_argument("User IDs and shares must have the same size");
     }
     
-    int totalShares = 0;
-    for (int share : shares) {
-        totalShares += share;
-    }
+    if (userIds.empty()) return;
+    
+    std::vector<Money> parts = amount.allocate(std::vector<std::int64_t>(shares.begin(), shares.end()));
     
     splits.clear();
     for (size_t i = 0; i < userIds.size(); ++i) {
-        double userAmount = amount * (static_cast<double>(shares[i]) / totalShares);
-        splits.emplace_back(userIds[i], userAmount, 0.0, shares[i], false);
+        splits.emplace_back(userIds[i], parts[i], 0.0, shares[i], false);
     }
+    notifyChange();
 }
 
 void Expense::splitCustom(const std::vector<SplitDetail>& customSplits) {
     splits = customSplits;
+    notifyChange();
 }
 
 std::string Expense::getCategoryString() const {
@@ -141,8 +182,8 @@ std::string Expense::getPaymentMethodString() const {
     }
 }
 
-double Expense::getTotalSplitAmount() const {
-    double total = 0.0;
+Money Expense::getTotalSplitAmount() const {
+    Money total;
     for (const auto& split : splits) {
         total += split.amount;
     }
@@ -150,7 +191,7 @@ double Expense::getTotalSplitAmount() const {
 }
 
 bool Expense::isFullySplit() const {
-    return std::abs(getTotalSplitAmount() - amount) < 0.01; // Allow small floating point differences
+    return getTotalSplitAmount() == amount;
 }
 
 std::vector<std::string> Expense::getInvolvedUsers() const {
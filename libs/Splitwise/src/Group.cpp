@@ -24,42 +24,58 @@ Group::Group(const std::string& groupId, const std::string& name, const std::str
 void Group::addMember(const std::string& userId) {
     if (!hasMember(userId)) {
         memberIds.push_back(userId);
-        memberBalances[userId] = 0.0;
     }
 }
 
 void Group::removeMember(const std::string& userId) {
     memberIds.erase(std::remove(memberIds.begin(), memberIds.end(), userId), memberIds.end());
-    memberBalances.erase(userId);
 }
 
 bool Group::hasMember(const std::string& userId) const {
     return std::find(memberIds.begin(), memberIds.end(), userId) != memberIds.end();
 }
 
-void Group::updateMemberBalance(const std::string& userId, double amount) {
+void Group::postEntry(const std::string& entryId, const std::vector<BalanceLedger::Delta>& deltas) {
+    ledger.post(entryId, deltas);
+}
+
+bool Group::unpostEntry(const std::string& entryId) {
+    return ledger.unpost(entryId);
+}
+
+void Group::updateMemberBalance(const std::string& userId, Money amount) {
     if (hasMember(userId)) {
-        memberBalances[userId] += amount;
+        adjustments.emplace_back(userId, amount);
+        ledger.post(adjustmentEntryId(adjustments.size() - 1), {adjustments.back()});
     }
 }
 
-double Group::getMemberBalance(const std::string& userId) const {
-    auto it = memberBalances.find(userId);
-    return (it != memberBalances.end()) ? it->second : 0.0;
+std::string Group::adjustmentEntryId(size_t index) {
+    return "ADJ" + std::to_string(index + 1);
+}
+
+Money Group::getMemberBalance(const std::string& userId) const {
+    return hasMember(userId) ? ledger.getBalance(userId) : Money();
+}
+
+std::unordered_map<std::string, Money> Group::getMemberBalances() const {
+    std::unordered_map<std::string, Money> balances;
+    for (const auto& memberId : memberIds) {
+        balances[memberId] = ledger.getBalance(memberId);
+    }
+    return balances;
 }
 
-double Group::getTotalGroupBalance() const {
-    double total = 0.0;
-    for (const auto& balance : memberBalances) {
-        total += balance.second;
+Money Group::getTotalGroupBalance() const {
+    Money total;
+    for (const auto& memberId : memberIds) {
+        total += ledger.getBalance(memberId);
     }
     return total;
 }
 
 void Group::resetAllBalances() {
-    for (auto& balance : memberBalances) {
-        balance.second = 0.0;
-    }
+    ledger.clear();
 }
 
 void Group::addExpense(const std::string& expenseId) {
@@ -76,6 +92,20 @@ bool Group::hasExpense(const std::string& expenseId) const {
     return std::find(expenseIds.begin(), expenseIds.end(), expenseId) != expenseIds.end();
 }
 
+void Group::addSettlement(const std::string& settlementId) {
+    if (!hasSettlement(settlementId)) {
+        settlementIds.push_back(settlementId);
+    }
+}
+
+void Group::removeSettlement(const std::string& settlementId) {
+    settlementIds.erase(std::remove(settlementIds.begin(), settlementIds.end(), settlementId), settlementIds.end());
+}
+
+bool Group::hasSettlement(const std::string& settlementId) const {
+    return std::find(settlementIds.begin(), settlementIds.end(), settlementId) != settlementIds.end();
+}
+
 std::string Group::getTypeString() const {
     switch (type) {
         case GroupType::TRIP: return "Trip";
@@ -90,9 +120,9 @@ std::string Group::getTypeString() const {
 
 std::vector<std::string> Group::getDebtors() const {
     std::vector<std::string> debtors;
-    for (const auto& balance : memberBalances) {
-        if (balance.second < 0) {
-            debtors.push_back(balance.first);
+    for (const auto& memberId : memberIds) {
+        if (ledger.getBalance(memberId).isNegative()) {
+            debtors.push_back(memberId);
         }
     }
     return debtors;
@@ -100,16 +130,16 @@ std::vector<std::string> Group::getDebtors() const {
 
 std::vector<std::string> Group::getCreditors() const {
     std::vector<std::string> creditors;
-    for (const auto& balance : memberBalances) {
-        if (balance.second > 0) {
-            creditors.push_back(balance.first);
+    for (const auto& memberId : memberIds) {
+        if (ledger.getBalance(memberId).isPositive()) {
+            creditors.push_back(memberId);
         }
     }
     return creditors;
 }
 
 bool Group::isBalanced() const {
-    return getTotalGroupBalance() == 0.0;
+    return getTotalGroupBalance().isZero();
 }
 
 void Group::updateTimestamp() {
@@ -0,0 +1,103 @@
+#include "../include/Money.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    // value * factor = quotient * divisor + remainder, without a 128-bit type. Needs
+    // value and factor below 2^63 and 0 < divisor < 2^63, so that doubling a remainder
+    // cannot wrap; the quotient fits whenever factor <= divisor.
+    std::uint64_t mulDiv(std::uint64_t value, std::uint64_t factor, std::uint64_t divisor,
+                         std::uint64_t& remainder) {
+        if (factor == 0 || value <= std::numeric_limits<std::uint64_t>::max() / factor) {
+            remainder = value * factor % divisor;
+            return value * factor / divisor;
+        }
+        // Shift-and-add over the bits of factor, keeping the running product reduced
+        std::uint64_t valueQuotient = value / divisor, valueRemainder = value % divisor;
+        std::uint64_t quotient = 0;
+        remainder = 0;
+        for (int bit = 62; bit >= 0; --bit) {
+            quotient <<= 1;
+            remainder <<= 1;
+            if (remainder >= divisor) {
+                remainder -= divisor;
+                quotient++;
+            }
+            if ((factor >> bit) & 1) {
+                quotient += valueQuotient;
+                remainder += valueRemainder;
+                if (remainder >= divisor) {
+                    remainder -= divisor;
+                    quotient++;
+                }
+            }
+        }
+        return quotient;
+    }
+}
+
+Money Money::fromDouble(double amount) {
+    if (!std::isfinite(amount)) {
+        throw std::invalid_argument("Amount must be a finite number");
+    }
+    return Money(std::llround(amount * CENTS_PER_UNIT));
+}
+
+std::string Money::toString() const {
+    std::int64_t whole = cents / CENTS_PER_UNIT;
+    std::int64_t fraction = cents % CENTS_PER_UNIT;
+    std::string text = (cents < 0) ? "-" : "";
+    text += std::to_string(whole < 0 ? -whole : whole) + ".";
+    fraction = fraction < 0 ? -fraction : fraction;
+    if (fraction < 10) text += "0";
+    return text + std::to_string(fraction);
+}
+
+std::vector<Money> Money::allocate(const std::vector<std::int64_t>& weights) const {
+    std::int64_t totalWeight = 0;
+    for (std::int64_t weight : weights) {
+        if (weight < 0) {
+            throw std::invalid_argument("Allocation weights must not be negative");
+        }
+        if (weight > std::numeric_limits<std::int64_t>::max() - totalWeight) {
+            throw std::overflow_error("Allocation weights add up to more than 2^63 - 1");
+        }
+        totalWeight += weight;
+    }
+    if (totalWeight == 0) {
+        throw std::invalid_argument("Allocation weights must not all be zero");
+    }
+
+    // Work on the magnitude so rounding down means the same thing for refunds
+    std::int64_t magnitude = cents < 0 ? -cents : cents;
+    std::vector<Money> parts(weights.size());
+    std::vector<std::uint64_t> remainders(weights.size());
+    std::int64_t allocated = 0;
+    for (size_t i = 0; i < weights.size(); ++i) {
+        parts[i].cents = static_cast<std::int64_t>(mulDiv(magnitude, weights[i], totalWeight, remainders[i]));
+        allocated += parts[i].cents;
+    }
+
+    // Fewer leftover cents than parts, one each to the largest remainders
+    std::vector<size_t> order(weights.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::int64_t leftover = magnitude - allocated;
+    std::partial_sort(order.begin(), order.begin() + leftover, order.end(),
+                      [&remainders](size_t a, size_t b) {
+                          return remainders[a] != remainders[b] ? remainders[a] > remainders[b] : a < b;
+                      });
+    for (std::int64_t i = 0; i < leftover; ++i) {
+        parts[order[i]].cents++;
+    }
+
+    if (cents < 0) {
+        for (auto& part : parts) {
+            part.cents = -part.cents;
+        }
+    }
+    return parts;
+}
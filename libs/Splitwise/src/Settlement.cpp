@@ -4,7 +4,7 @@
 #include <iomanip>
 
 Settlement::Settlement(const std::string& settlementId, const std::string& fromUserId,
-                       const std::string& toUserId, const std::string& groupId, double amount,
+                       const std::string& toUserId, const std::string& groupId, Money amount,
                        const std::string& currency, SettlementMethod method, const std::string& description)
     : settlementId(settlementId), fromUserId(fromUserId), toUserId(toUserId), groupId(groupId),
       amount(amount), currency(currency), status(SettlementStatus::PENDING), method(method),
@@ -19,6 +19,12 @@ Settlement::Settlement(const std::string& settlementId, const std::string& fromU
     date = createdAt;
 }
 
+void Settlement::notifyChange() const {
+    if (changeListener) {
+        changeListener(*this);
+    }
+}
+
 void Settlement::markAsCompleted() {
     if (status == SettlementStatus::PENDING) {
         status = SettlementStatus::COMPLETED;
@@ -27,18 +33,21 @@ void Settlement::markAsCompleted() {
         std::ostringstream oss;
         oss << std::put_time(&tm, "%Y-%m-%d %H:%M:%S");
         completedAt = oss.str();
+        notifyChange();
     }
 }
 
 void Settlement::markAsCancelled() {
     if (status == SettlementStatus::PENDING) {
         status = SettlementStatus::CANCELLED;
+        notifyChange();
     }
 }
 
 void Settlement::markAsExpired() {
     if (status == SettlementStatus::PENDING) {
         status = SettlementStatus::EXPIRED;
+        notifyChange();
     }
 }
 
@@ -80,7 +89,5 @@ void Settlement::updateTimestamp() {
 }
 
 std::string Settlement::getFormattedAmount() const {
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(2) << amount;
-    return currency + " " + oss.str();
+    return currency + " " + amount.toString();
 } 
\ No newline at end of file
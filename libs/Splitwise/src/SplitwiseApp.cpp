@@ -5,9 +5,48 @@
 #include <iomanip>
 #include <stdexcept>
 
+namespace {
+    // The payer is owed the whole amount; everyone in the split owes their share
+    std::vector<BalanceLedger::Delta> expenseDeltas(const Expense& expense) {
+        std::vector<BalanceLedger::Delta> deltas;
+        deltas.emplace_back(expense.getPaidBy(), expense.getAmount());
+        for (const auto& split : expense.getSplits()) {
+            deltas.emplace_back(split.userId, -split.amount);
+        }
+        return deltas;
+    }
+
+    // A completed settlement pays down the payer's debt and what the payee is owed
+    std::vector<BalanceLedger::Delta> settlementDeltas(const Settlement& settlement) {
+        if (!settlement.isCompleted()) return {};
+        return {{settlement.getFromUserId(), settlement.getAmount()},
+                {settlement.getToUserId(), -settlement.getAmount()}};
+    }
+
+    // Members' balances in cents, in member order, for DebtSimplifier
+    std::vector<std::int64_t> balancesInCents(const Group& group, const std::vector<std::string>& memberIds) {
+        std::vector<std::int64_t> cents;
+        cents.reserve(memberIds.size());
+        for (const auto& memberId : memberIds) {
+            cents.push_back(group.getMemberBalance(memberId).getCents());
+        }
+        return cents;
+    }
+}
+
 SplitwiseApp::SplitwiseApp(const std::string& name, const std::string& ver, const std::string& defaultCurr)
     : appName(name), version(ver), defaultCurrency(defaultCurr), nextUserId(1), nextGroupId(1),
-      nextExpenseId(1), nextSettlementId(1) {}
+      nextExpenseId(1), nextSettlementId(1), consistencyChecks(false) {}
+
+SplitwiseApp::~SplitwiseApp() {
+    // Expenses and settlements may outlive the app through shared pointers
+    for (auto& pair : expenses) {
+        pair.second->setChangeListener(nullptr);
+    }
+    for (auto& pair : settlements) {
+        pair.second->setChangeListener(nullptr);
+    }
+}
 
 // User management
 std::shared_ptr<User> SplitwiseApp::createUser(const std::string& name, const std::string& email,
@@ -144,7 +183,7 @@ bool SplitwiseApp::removeUserFromGroup(const std::string& userId, const std::str
 }
 
 // Expense management
-std::shared_ptr<Expense> SplitwiseApp::createExpense(const std::string& description, double amount,
+std::shared_ptr<Expense> SplitwiseApp::createExpense(const std::string& description, Money amount,
                                                     const std::string& paidBy, const std::string& groupId,
                                                     ExpenseCategory category) {
     validateUserExists(paidBy);
@@ -164,6 +203,10 @@ std::shared_ptr<Expense> SplitwiseApp::createExpense(const std::string& descript
         group->addExpense(expenseId);
     }
     
+    // Splits are usually set after creation; each change re-posts the expense
+    postExpense(*expense);
+    expense->setChangeListener([this](const Expense& changed) { postExpense(changed); });
+    
     return expense;
 }
 
@@ -179,7 +222,9 @@ bool SplitwiseApp::deleteExpense(const std::string& expenseId) {
         auto group = findGroup(it->second->getGroupId());
         if (group) {
             group->removeExpense(expenseId);
+            group->unpostEntry(expenseId);
         }
+        it->second->setChangeListener(nullptr);
         expenses.erase(it);
         return true;
     }
@@ -188,9 +233,13 @@ bool SplitwiseApp::deleteExpense(const std::string& expenseId) {
 
 std::vector<std::shared_ptr<Expense>> SplitwiseApp::getExpensesForGroup(const std::string& groupId) {
     std::vector<std::shared_ptr<Expense>> result;
-    for (const auto& pair : expenses) {
-        if (pair.second->getGroupId() == groupId) {
-            result.push_back(pair.second);
+    auto group = findGroup(groupId);
+    if (group) {
+        for (const auto& expenseId : group->getExpenseIds()) {
+            auto expense = findExpense(expenseId);
+            if (expense) {
+                result.push_back(expense);
+            }
         }
     }
     return result;
@@ -219,7 +268,7 @@ std::vector<std::shared_ptr<Expense>> SplitwiseApp::getExpensesByCategory(const
 // Settlement management
 std::shared_ptr<Settlement> SplitwiseApp::createSettlement(const std::string& fromUserId,
                                                           const std::string& toUserId, const std::string& groupId,
-                                                          double amount, SettlementMethod method) {
+                                                          Money amount, SettlementMethod method) {
     validateUserExists(fromUserId);
     validateUserExists(toUserId);
     validateGroupExists(groupId);
@@ -227,6 +276,11 @@ std::shared_ptr<Settlement> SplitwiseApp::createSettlement(const std::string& fr
     std::string settlementId = generateSettlementId();
     auto settlement = std::make_shared<Settlement>(settlementId, fromUserId, toUserId, groupId, amount, defaultCurrency, method);
     settlements[settlementId] = settlement;
+    findGroup(groupId)->addSettlement(settlementId);
+    
+    // Counts towards balances once completed
+    postSettlement(*settlement);
+    settlement->setChangeListener([this](const Settlement& changed) { postSettlement(changed); });
     
     return settlement;
 }
@@ -239,6 +293,12 @@ std::shared_ptr<Settlement> SplitwiseApp::findSettlement(const std::string& sett
 bool SplitwiseApp::deleteSettlement(const std::string& settlementId) {
     auto it = settlements.find(settlementId);
     if (it != settlements.end()) {
+        auto group = findGroup(it->second->getGroupId());
+        if (group) {
+            group->removeSettlement(settlementId);
+            group->unpostEntry(settlementId);
+        }
+        it->second->setChangeListener(nullptr);
         settlements.erase(it);
         return true;
     }
@@ -247,9 +307,13 @@ bool SplitwiseApp::deleteSettlement(const std::string& settlementId) {
 
 std::vector<std::shared_ptr<Settlement>> SplitwiseApp::getSettlementsForGroup(const std::string& groupId) {
     std::vector<std::shared_ptr<Settlement>> result;
-    for (const auto& pair : settlements) {
-        if (pair.second->getGroupId() == groupId) {
-            result.push_back(pair.second);
+    auto group = findGroup(groupId);
+    if (group) {
+        for (const auto& settlementId : group->getSettlementIds()) {
+            auto settlement = findSettlement(settlementId);
+            if (settlement) {
+                result.push_back(settlement);
+            }
         }
     }
     return result;
@@ -275,61 +339,93 @@ bool SplitwiseApp::completeSettlement(const std::string& settlementId) {
 }
 
 // Balance and debt management
+void SplitwiseApp::postExpense(const Expense& expense) {
+    auto group = findGroup(expense.getGroupId());
+    if (group) {
+        group->postEntry(expense.getExpenseId(), expenseDeltas(expense));
+    }
+}
+
+void SplitwiseApp::postSettlement(const Settlement& settlement) {
+    auto group = findGroup(settlement.getGroupId());
+    if (group) {
+        group->postEntry(settlement.getSettlementId(), settlementDeltas(settlement));
+    }
+}
+
 void SplitwiseApp::calculateBalances(const std::string& groupId) {
     auto group = findGroup(groupId);
     if (!group) return;
     
-    // Reset all balances
+    // Rebuild the ledger from the group's own history
     group->resetAllBalances();
+    for (const auto& expense : getExpensesForGroup(groupId)) {
+        postExpense(*expense);
+    }
+    for (const auto& settlement : getSettlementsForGroup(groupId)) {
+        postSettlement(*settlement);
+    }
+    const auto& adjustments = group->getAdjustments();
+    for (size_t i = 0; i < adjustments.size(); ++i) {
+        group->postEntry(Group::adjustmentEntryId(i), {adjustments[i]});
+    }
+}
+
+bool SplitwiseApp::verifyBalances(const std::string& groupId) {
+    auto group = findGroup(groupId);
+    if (!group) return false;
     
-    // Calculate balances from expenses
-    for (const auto& pair : expenses) {
-        auto expense = pair.second;
-        if (expense->getGroupId() == groupId) {
-            // Add the full amount to the person who paid
-            group->updateMemberBalance(expense->getPaidBy(), expense->getAmount());
-            
-            // Subtract each person's share
-            for (const auto& split : expense->getSplits()) {
-                group->updateMemberBalance(split.userId, -split.amount);
-            }
-        }
+    // Full recomputation into a scratch ledger; amounts are exact, so they must match exactly
+    BalanceLedger expected;
+    for (const auto& expense : getExpensesForGroup(groupId)) {
+        expected.post(expense->getExpenseId(), expenseDeltas(*expense));
+    }
+    for (const auto& settlement : getSettlementsForGroup(groupId)) {
+        expected.post(settlement->getSettlementId(), settlementDeltas(*settlement));
+    }
+    const auto& adjustments = group->getAdjustments();
+    for (size_t i = 0; i < adjustments.size(); ++i) {
+        expected.post(Group::adjustmentEntryId(i), {adjustments[i]});
     }
     
-    // Apply settlements
-    for (const auto& pair : settlements) {
-        auto settlement = pair.second;
-        if (settlement->getGroupId() == groupId && settlement->isCompleted()) {
-            group->updateMemberBalance(settlement->getFromUserId(), -settlement->getAmount());
-            group->updateMemberBalance(settlement->getToUserId(), settlement->getAmount());
+    for (const auto& memberId : group->getMemberIds()) {
+        if (group->getMemberBalance(memberId) != expected.getBalance(memberId)) {
+            return false;
         }
     }
+    return true;
 }
 
-std::vector<DebtSummary> SplitwiseApp::getDebtSummary(const std::string& groupId) {
-    calculateBalances(groupId);
+void SplitwiseApp::checkBalances(const std::string& groupId) {
+    if (consistencyChecks && !verifyBalances(groupId)) {
+        throw std::runtime_error("Balances out of sync with history for group: " + groupId);
+    }
+}
+
+std::vector<DebtSummary> SplitwiseApp::settleGroup(const std::string& groupId, size_t exactLimit) {
     auto group = findGroup(groupId);
     if (!group) return {};
+    checkBalances(groupId);
+    
+    std::vector<std::string> memberIds = group->getMemberIds();
+    std::vector<std::int64_t> cents = balancesInCents(*group, memberIds);
     
     std::vector<DebtSummary> debts;
-    auto balances = group->getMemberBalances();
-    
-    for (const auto& balance : balances) {
-        if (balance.second < 0) { // Debtor
-            for (const auto& otherBalance : balances) {
-                if (otherBalance.second > 0) { // Creditor
-                    double debtAmount = std::min(-balance.second, otherBalance.second);
-                    if (debtAmount > 0.01) { // Avoid tiny amounts
-                        debts.emplace_back(balance.first, otherBalance.first, debtAmount, group->getCurrency());
-                    }
-                }
-            }
-        }
+    for (const auto& transfer : DebtSimplifier::simplify(cents, exactLimit)) {
+        debts.emplace_back(memberIds[transfer.from], memberIds[transfer.to], Money::fromCents(transfer.cents),
+                           group->getCurrency());
     }
-    
     return debts;
 }
 
+std::vector<DebtSummary> SplitwiseApp::getDebtSummary(const std::string& groupId) {
+    return settleGroup(groupId, 0);
+}
+
+std::vector<DebtSummary> SplitwiseApp::getSimplifiedDebts(const std::string& groupId) {
+    return settleGroup(groupId, DebtSimplifier::DEFAULT_EXACT_LIMIT);
+}
+
 std::vector<DebtSummary> SplitwiseApp::getDebtSummaryForUser(const std::string& userId) {
     std::vector<DebtSummary> allDebts;
     auto userGroups = getGroupsForUser(userId);
@@ -346,16 +442,16 @@ std::vector<DebtSummary> SplitwiseApp::getDebtSummaryForUser(const std::string&
     return allDebts;
 }
 
-double SplitwiseApp::getUserBalance(const std::string& userId, const std::string& groupId) {
+Money SplitwiseApp::getUserBalance(const std::string& userId, const std::string& groupId) {
     auto group = findGroup(groupId);
-    if (!group) return 0.0;
+    if (!group) return Money();
     
-    calculateBalances(groupId);
+    checkBalances(groupId);
     return group->getMemberBalance(userId);
 }
 
-double SplitwiseApp::getTotalUserBalance(const std::string& userId) {
-    double total = 0.0;
+Money SplitwiseApp::getTotalUserBalance(const std::string& userId) {
+    Money total;
     auto userGroups = getGroupsForUser(userId);
     
     for (const auto& group : userGroups) {
@@ -368,27 +464,25 @@ double SplitwiseApp::getTotalUserBalance(const std::string& userId) {
 // Reporting and analytics
 GroupSummary SplitwiseApp::getGroupSummary(const std::string& groupId) {
     auto group = findGroup(groupId);
-    if (!group) return GroupSummary("", "", 0, 0, 0, 0, 0);
+    if (!group) return GroupSummary("", "");
     
-    double totalExpenses = 0.0;
-    double totalSettlements = 0.0;
+    Money totalExpenses;
+    Money totalSettlements;
     
     // Calculate total expenses
-    for (const auto& pair : expenses) {
-        if (pair.second->getGroupId() == groupId) {
-            totalExpenses += pair.second->getAmount();
-        }
+    for (const auto& expense : getExpensesForGroup(groupId)) {
+        totalExpenses += expense->getAmount();
     }
     
     // Calculate total settlements
-    for (const auto& pair : settlements) {
-        if (pair.second->getGroupId() == groupId && pair.second->isCompleted()) {
-            totalSettlements += pair.second->getAmount();
+    for (const auto& settlement : getSettlementsForGroup(groupId)) {
+        if (settlement->isCompleted()) {
+            totalSettlements += settlement->getAmount();
         }
     }
     
-    calculateBalances(groupId);
-    double netBalance = group->getTotalGroupBalance();
+    checkBalances(groupId);
+    Money netBalance = group->getTotalGroupBalance();
     
     return GroupSummary(groupId, group->getName(), totalExpenses, totalSettlements, 
                        netBalance, group->getMemberCount(), group->getExpenseCount());
@@ -416,8 +510,8 @@ std::vector<std::shared_ptr<Expense>> SplitwiseApp::getTopExpenses(const std::st
     return groupExpenses;
 }
 
-std::unordered_map<ExpenseCategory, double> SplitwiseApp::getExpenseBreakdown(const std::string& groupId) {
-    std::unordered_map<ExpenseCategory, double> breakdown;
+std::unordered_map<ExpenseCategory, Money> SplitwiseApp::getExpenseBreakdown(const std::string& groupId) {
+    std::unordered_map<ExpenseCategory, Money> breakdown;
     auto groupExpenses = getExpensesForGroup(groupId);
     
     for (const auto& expense : groupExpenses) {
@@ -427,21 +521,21 @@ std::unordered_map<ExpenseCategory, double> SplitwiseApp::getExpenseBreakdown(co
     return breakdown;
 }
 
-std::vector<std::pair<std::string, double>> SplitwiseApp::getTopSpenders(const std::string& groupId, int limit) {
-    std::unordered_map<std::string, double> spending;
+std::vector<std::pair<std::string, Money>> SplitwiseApp::getTopSpenders(const std::string& groupId, int limit) {
+    std::unordered_map<std::string, Money> spending;
     auto groupExpenses = getExpensesForGroup(groupId);
     
     for (const auto& expense : groupExpenses) {
         spending[expense->getPaidBy()] += expense->getAmount();
     }
     
-    std::vector<std::pair<std::string, double>> result;
+    std::vector<std::pair<std::string, Money>> result;
     for (const auto& pair : spending) {
         result.push_back(pair);
     }
     
     std::sort(result.begin(), result.end(),
-              [](const std::pair<std::string, double>& a, const std::pair<std::string, double>& b) {
+              [](const std::pair<std::string, Money>& a, const std::pair<std::string, Money>& b) {
                   return a.second > b.second;
               });
     
@@ -7,7 +7,7 @@
 User::User(const std::string& userId, const std::string& name, const std::string& email,
            const std::string& phone, const std::string& profilePicture, Currency preferredCurrency)
     : userId(userId), name(name), email(email), phone(phone), profilePicture(profilePicture),
-      status(UserStatus::ACTIVE), preferredCurrency(preferredCurrency), totalBalance(0.0) {
+      status(UserStatus::ACTIVE), preferredCurrency(preferredCurrency), totalBalance() {
     
     // Set creation timestamp
     auto now = std::time(nullptr);
@@ -46,7 +46,7 @@ bool User::isFriend(const std::string& friendId) const {
     return std::find(friendIds.begin(), friendIds.end(), friendId) != friendIds.end();
 }
 
-void User::updateBalance(double amount) {
+void User::updateBalance(Money amount) {
     totalBalance += amount;
 }
 